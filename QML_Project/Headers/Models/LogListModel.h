@@ -0,0 +1,119 @@
+#pragma once
+
+#include <QAbstractListModel>
+#include <QSharedPointer>
+#include <QTimer>
+#include <QVector>
+#include <deque>
+
+#include "Services/Logging/LogModelAppender.h"
+#include "Services/Logging/LogRecord.h"
+
+namespace QmlApp
+{
+enum LogDataRole
+{
+    LevelRole = Qt::UserRole + 1,
+    LevelNameRole,
+    CategoryRole,
+    MessageRole,
+    TimestampRole,
+    SequenceRole
+};
+
+/**
+ * @class LogListModel
+ * @brief A list model of recent log records for an in-app log console.
+ *
+ * Records are kept in a fixed-capacity ring, so memory stays bounded and the oldest records are
+ * evicted first. New records are collected by a LogModelAppender and handed to the view at most
+ * once per frame, with a single row removal for evicted records and a single row insertion for
+ * the new ones. Level, category and text filters are applied to new records as they arrive;
+ * narrowing a filter only re-checks the rows that are currently visible.
+ */
+class LogListModel: public QAbstractListModel
+{
+        Q_OBJECT
+        Q_PROPERTY(int capacity READ getCapacity WRITE setCapacity NOTIFY capacityChanged)
+        Q_PROPERTY(int retainedCount READ getRetainedCount NOTIFY retainedCountChanged)
+        Q_PROPERTY(int minimumLevel READ getMinimumLevel WRITE setMinimumLevel NOTIFY filterChanged)
+        Q_PROPERTY(QString categoryFilter READ getCategoryFilter WRITE setCategoryFilter NOTIFY
+                       filterChanged)
+        Q_PROPERTY(QString textFilter READ getTextFilter WRITE setTextFilter NOTIFY filterChanged)
+
+    public:
+        explicit LogListModel(QObject* parent = nullptr, int capacity = 100000);
+        ~LogListModel() override = default;
+
+        [[nodiscard]] auto rowCount(const QModelIndex& parent = QModelIndex()) const
+            -> int override;
+        [[nodiscard]] auto data(const QModelIndex& index,
+                                int role = Qt::DisplayRole) const -> QVariant override;
+        [[nodiscard]] auto roleNames() const -> QHash<int, QByteArray> override;
+
+        // NOLINTBEGIN(modernize-use-trailing-return-type)
+        [[nodiscard]] int getCapacity() const;
+        void setCapacity(int capacity);
+        [[nodiscard]] int getRetainedCount() const;
+
+        [[nodiscard]] int getMinimumLevel() const;
+        void setMinimumLevel(int level);
+        [[nodiscard]] QString getCategoryFilter() const;
+        void setCategoryFilter(const QString& category);
+        [[nodiscard]] QString getTextFilter() const;
+        void setTextFilter(const QString& text);
+
+        Q_INVOKABLE void clear();
+        Q_INVOKABLE void flushPending();
+        // NOLINTEND(modernize-use-trailing-return-type)
+
+        /**
+         * @brief Returns the appender that feeds this model.
+         *
+         * Register it with the Logger to show log records in the model.
+         *
+         * @return The appender of the model.
+         */
+        [[nodiscard]] auto get_appender() const -> QSharedPointer<LogModelAppender>;
+
+        /**
+         * @brief Appends a batch of records to the model.
+         *
+         * @param records The records to append, in logging order.
+         */
+        auto append_records(QList<LogRecord> records) -> void;
+
+        /**
+         * @brief Returns the severity rank of a log level, from 0 (debug) to 4 (fatal).
+         *
+         * @param type The log level.
+         * @return The severity rank.
+         */
+        [[nodiscard]] static auto severity(QtMsgType type) -> int;
+
+    signals:
+        void capacityChanged();
+        void retainedCountChanged();
+        void filterChanged();
+
+    private:
+        [[nodiscard]] auto record_at(quint64 position) const -> const LogRecord&;
+        [[nodiscard]] auto matches(const LogRecord& record) const -> bool;
+        auto apply_filter(bool narrowing) -> void;
+
+    private:
+        QSharedPointer<LogModelAppender> m_appender;
+        QTimer m_flush_timer;
+
+        int m_capacity;
+        QVector<LogRecord> m_ring;
+        quint64 m_first_position = 0;
+        quint64 m_next_position = 0;
+        std::deque<quint64> m_visible;
+
+        int m_minimum_level = 0;
+        QString m_category_filter;
+        QByteArray m_category_filter_utf8;
+        QString m_text_filter;
+};
+}  // namespace QmlApp
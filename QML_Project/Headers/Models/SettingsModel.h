@@ -2,9 +2,11 @@
 
 #include <QAbstractItemModel>
 #include <QVariant>
+#include <memory>
 
 #include "Services/Settings.h"
 #include "SettingsNode.h"
+#include "SettingsNodeArena.h"
 
 namespace QmlApp
 {
@@ -31,6 +33,10 @@ class SettingsModel: public QAbstractItemModel
             -> int override;
         [[nodiscard]] auto columnCount(const QModelIndex& parent = QModelIndex()) const
             -> int override;
+        [[nodiscard]] auto hasChildren(const QModelIndex& parent = QModelIndex()) const
+            -> bool override;
+        [[nodiscard]] auto canFetchMore(const QModelIndex& parent) const -> bool override;
+        auto fetchMore(const QModelIndex& parent) -> void override;
         [[nodiscard]] auto data(const QModelIndex& index,
                                 int role = Qt::DisplayRole) const -> QVariant override;
         auto setData(const QModelIndex& index, const QVariant& value,
@@ -46,25 +52,33 @@ class SettingsModel: public QAbstractItemModel
         Q_INVOKABLE void setValue(const QString& key, const QVariant& value,
                                   const QString& group = "General");
 
-        Q_INVOKABLE void loadFromFile(const QString& file_path);
-        Q_INVOKABLE void saveToFile(const QString& file_path);
+        Q_INVOKABLE void loadFromFile(const QString& file_path,
+                                      QSettings::Format format = QSettings::IniFormat);
+        Q_INVOKABLE void saveToFile(const QString& file_path,
+                                    QSettings::Format format = QSettings::IniFormat);
         // NOLINTEND(modernize-use-trailing-return-type)
 
     private:
         auto load_settings_from_app_settings() -> void;
+        [[nodiscard]] auto build_tree_from_app_settings(SettingsNodeArena& arena) const
+            -> SettingsNode*;
+        auto populate(SettingsNode* group_node) -> void;
+        [[nodiscard]] auto settings_path(const SettingsNode* group_node) const -> QString;
+        [[nodiscard]] auto index_of_node(SettingsNode* node) const -> QModelIndex;
 
         auto create_node(const QString& group, const QString& key, const QVariant& value,
                          SettingsNode* parent = nullptr) -> SettingsNode*;
+        auto find_or_create_group_node(SettingsNode* parent, const QString& group)
+            -> SettingsNode*;
         auto create_or_update_key_node(const QString& key, const QVariant& value,
                                        SettingsNode* group_node) -> SettingsNode*;
-        [[nodiscard]] auto get_leaf_nodes() const -> QList<SettingsNode*>;
-        auto collect_leaf_nodes(SettingsNode* node, QList<SettingsNode*>& leaf_nodes) const -> void;
+        auto write_node_to_settings(const SettingsNode* node) const -> void;
 
         auto reset() -> void;
 
     private:
         Settings* m_settings;
-        bool m_sync_with_app_settings = true;
+        std::unique_ptr<SettingsNodeArena> m_arena = std::make_unique<SettingsNodeArena>();
         SettingsNode* m_root_node;
 };
 }  // namespace QmlApp
@@ -1,19 +1,26 @@
 #pragma once
 
+#include <QHash>
 #include <QString>
 #include <QVariant>
 #include <QVector>
+#include <memory>
 
 namespace QmlApp
 {
+class SettingsNodeArena;
+
 class SettingsNode
 {
     public:
-        explicit SettingsNode(QString group, QString key, QVariant value = QVariant(),
-                              SettingsNode* parent = nullptr);
-        virtual ~SettingsNode();
+        explicit SettingsNode(const QString& group, const QString& key,
+                              QVariant value = QVariant(), SettingsNode* parent = nullptr);
+        ~SettingsNode();
 
         auto append_child(SettingsNode* child) -> void;
+        auto insert_child(int row, SettingsNode* child) -> void;
+        [[nodiscard]] auto take_child(int row) -> SettingsNode*;
+        auto move_child(int from, int to) -> void;
         [[nodiscard]] auto get_child(int row) const -> SettingsNode*;
         [[nodiscard]] auto child_items() const -> QVector<SettingsNode*>;
 
@@ -32,6 +39,9 @@ class SettingsNode
         [[nodiscard]] auto find_node_by_group(const QString& group) const -> SettingsNode*;
         [[nodiscard]] auto find_node_by_key(const QString& key) const -> SettingsNode*;
 
+        [[nodiscard]] auto find_child_by_group(const QString& group) const -> SettingsNode*;
+        [[nodiscard]] auto find_child_by_key(const QString& key) const -> SettingsNode*;
+
         auto set_value(const QVariant& value) -> void;
 
         [[nodiscard]] auto get_group() const -> QString;
@@ -40,13 +50,40 @@ class SettingsNode
 
         [[nodiscard]] auto get_full_group() const -> QString;
 
+        auto set_populated(bool populated) -> void;
+        [[nodiscard]] auto is_populated() const -> bool;
+
+        [[nodiscard]] auto is_in_arena() const -> bool;
+
         auto clear() -> void;
 
     private:
-        QString m_group;
-        QString m_key;
+        friend class SettingsNodeArena;
+
+        struct Branch {
+                QVector<SettingsNode*> child_items;
+                QHash<QString, SettingsNode*> children_by_group;
+                QHash<QString, SettingsNode*> children_by_key;
+        };
+
+        static auto intern(const QString& name) -> const QString*;
+        [[nodiscard]] auto group_name() const -> const QString&;
+        [[nodiscard]] auto key_name() const -> const QString&;
+        [[nodiscard]] auto children() const -> const QVector<SettingsNode*>&;
+        auto branch() -> Branch&;
+
+        auto index_child(SettingsNode* child) -> void;
+        auto unindex_child(SettingsNode* child) -> void;
+        auto renumber_children(int first, int last) -> void;
+
+    private:
+        const QString* m_group;
+        const QString* m_key;
         QVariant m_value;
-        QVector<SettingsNode*> m_child_items;
+        std::unique_ptr<Branch> m_branch;
         SettingsNode* m_parent_item;
+        int m_row = 0;
+        bool m_populated = true;
+        bool m_in_arena = false;
 };
 }  // namespace QmlApp
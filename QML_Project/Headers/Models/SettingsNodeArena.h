@@ -0,0 +1,35 @@
+#pragma once
+
+#include <QString>
+#include <QVariant>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "SettingsNode.h"
+
+namespace QmlApp
+{
+class SettingsNodeArena
+{
+    public:
+        static constexpr qsizetype kNodesPerChunk = 512;
+
+        SettingsNodeArena() = default;
+        ~SettingsNodeArena();
+
+        auto create(const QString& group, const QString& key, const QVariant& value = QVariant(),
+                    SettingsNode* parent = nullptr) -> SettingsNode*;
+        auto release() -> void;
+
+        [[nodiscard]] auto node_count() const -> qsizetype;
+        [[nodiscard]] auto chunk_count() const -> qsizetype;
+
+    private:
+        [[nodiscard]] auto node_at(qsizetype chunk, qsizetype slot) const -> SettingsNode*;
+
+    private:
+        std::vector<std::unique_ptr<std::byte[]>> m_chunks;
+        qsizetype m_used_in_last_chunk = 0;
+};
+}  // namespace QmlApp
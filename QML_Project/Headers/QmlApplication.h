@@ -3,8 +3,12 @@
 #include <QObject>
 #include <QQmlApplicationEngine>
 
+#include "Models/LogListModel.h"
 #include "Models/SettingsModel.h"
+#include "Services/Logging/LogMetricsProvider.h"
+#include "Services/Logging/PrometheusMetricsWriter.h"
 #include "Services/Settings.h"
+#include "Services/SettingsPersister.h"
 #include "Services/Translator.h"
 
 namespace QmlApp
@@ -22,10 +26,19 @@ class QmlApplication: public QObject
 
         auto exec() -> int;
 
+    private:
+        auto load_settings() -> void;
+        auto configure_logging() -> void;
+        auto save_settings() -> void;
+
     private:
         QQmlApplicationEngine m_engine;
         Settings m_settings;
         SettingsModel m_settings_model;
+        SettingsPersister m_settings_persister;
         Translator m_translator;
+        LogMetricsProvider m_log_metrics;
+        PrometheusMetricsWriter m_metrics_writer;
+        LogListModel m_log_model;
 };
 }  // namespace QmlApp
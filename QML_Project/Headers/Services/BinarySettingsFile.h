@@ -0,0 +1,62 @@
+#pragma once
+
+#include <QByteArray>
+#include <QFile>
+#include <QHash>
+#include <QIODevice>
+#include <QSettings>
+#include <QString>
+#include <QVariant>
+
+#include "Services/Settings.h"
+
+namespace QmlApp
+{
+class BinarySettingsFile
+{
+    public:
+        BinarySettingsFile() = default;
+        ~BinarySettingsFile();
+
+        auto open(const QString& file_path) -> bool;
+        auto load(const QByteArray& data) -> bool;
+        auto close() -> void;
+
+        [[nodiscard]] auto is_open() const -> bool;
+        [[nodiscard]] auto key_count() const -> int;
+        [[nodiscard]] auto key_at(int index) const -> QString;
+        [[nodiscard]] auto value_at(int index) const -> QVariant;
+        [[nodiscard]] auto lower_bound(const QString& key) const -> int;
+        [[nodiscard]] auto index_of(const QString& key) const -> int;
+        [[nodiscard]] auto contains(const QString& key) const -> bool;
+        [[nodiscard]] auto value(const QString& key,
+                                 const QVariant& default_value = QVariant()) const -> QVariant;
+        [[nodiscard]] auto decoded_count() const -> int;
+
+        static auto write(QIODevice& device, const SettingsSnapshot& snapshot) -> bool;
+        static auto write(const QString& file_path, const SettingsSnapshot& snapshot) -> bool;
+
+        static auto format() -> QSettings::Format;
+        static auto convert_ini_to_binary(const QString& ini_file_path,
+                                          const QString& binary_file_path) -> bool;
+        static auto convert_binary_to_ini(const QString& binary_file_path,
+                                          const QString& ini_file_path) -> bool;
+
+    private:
+        auto attach(const uchar* data, qint64 size) -> bool;
+        [[nodiscard]] auto read_uint32(qint64 offset) const -> quint32;
+        [[nodiscard]] auto key_bytes(int index) const -> QByteArray;
+        [[nodiscard]] auto decode_value(int index) const -> QVariant;
+
+        static auto read_settings(QIODevice& device, QSettings::SettingsMap& map) -> bool;
+        static auto write_settings(QIODevice& device, const QSettings::SettingsMap& map) -> bool;
+
+    private:
+        QFile m_file;
+        QByteArray m_buffer;
+        const uchar* m_data = nullptr;
+        qint64 m_size = 0;
+        int m_key_count = 0;
+        mutable QHash<int, QVariant> m_decoded_values;
+};
+}  // namespace QmlApp
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <QString>
+
+namespace QmlApp
+{
+/**
+ * @class ConsoleSink
+ * @brief Writes formatted log lines to stderr.
+ *
+ * Lines are written with stdio, and stderr is flushed for warnings and more severe lines. A fatal
+ * line is passed to qFatal, which aborts the process, after the logger has flushed all appenders.
+ *
+ * The sink is meant to be composed with a formatter at compile time in a StaticAppender.
+ */
+class ConsoleSink
+{
+    public:
+        // The name of appenders that write to this sink
+        static constexpr const char* kName = "console";
+
+        /**
+         * @brief Writes a formatted line followed by a line break.
+         *
+         * @param line The formatted line.
+         * @param type The log level of the line.
+         * @return The number of bytes written.
+         */
+        auto write(const QString& line, QtMsgType type) -> qsizetype;
+
+        /**
+         * @brief Flushes stderr.
+         */
+        auto flush() -> void;
+
+        /**
+         * @brief Does nothing, since stderr is not buffered by the sink.
+         */
+        auto emergency_flush() -> void;
+};
+}  // namespace QmlApp
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <QSharedPointer>
+
+#include "Services/Logging/LogAppender.h"
+
+namespace QmlApp
+{
+/**
+ * @class CrashHandler
+ * @brief Writes out buffered log data when the process crashes.
+ *
+ * The handler is installed for SIGSEGV, SIGABRT, SIGFPE and SIGILL (and SIGBUS where it exists).
+ * When one of them is raised, it calls emergency_flush() on every registered appender, writes a
+ * short note to stderr and re-raises the signal with the default action, so the process still
+ * terminates and produces a core dump as usual.
+ *
+ * Registered appenders are kept in a fixed-size array of atomic pointers, so the signal handler
+ * neither locks nor allocates.
+ *
+ * Only data that has reached an appender is written out. Records still staged in the LogBatcher
+ * of the Logger are not: staging buffers are guarded by mutexes and hold QStrings, which cannot
+ * be formatted in a signal handler. These are at most the records of the last batch delay
+ * (2 ms by default); warnings and more severe records are drained without waiting for it, but
+ * may still be lost if the crash follows within the drain.
+ */
+class CrashHandler
+{
+    public:
+        static constexpr int kMaxAppenders = 16;
+
+        /**
+         * @brief Installs the signal handlers.
+         */
+        static auto install() -> void;
+
+        /**
+         * @brief Registers an appender whose buffer is written out on a crash.
+         *
+         * The crash handler keeps the appender alive until it is unregistered.
+         *
+         * @param appender The appender.
+         * @return True if the appender was registered, false if all slots are taken.
+         */
+        static auto register_appender(const QSharedPointer<LogAppender>& appender) -> bool;
+
+        /**
+         * @brief Unregisters all appenders.
+         */
+        static auto unregister_all() -> void;
+
+        /**
+         * @brief Calls emergency_flush() on all registered appenders.
+         *
+         * This is what the signal handler does; it is async-signal-safe.
+         */
+        static auto emergency_flush() -> void;
+
+    private:
+        static auto handle_signal(int signal_number) -> void;
+};
+}  // namespace QmlApp
@@ -1,9 +1,8 @@
 #pragma once
 
-#include <QFile>
 #include <QString>
-#include <QTextStream>
 
+#include "Services/Logging/FileSink.h"
 #include "Services/Logging/LogAppender.h"
 #include "Services/Logging/SimpleFormatter.h"
 
@@ -15,6 +14,11 @@ namespace QmlApp
  *
  * This class is responsible for appending log messages to a file.
  * It uses a provided LogFormatter to format the log messages before writing them to the file.
+ *
+ * By default every message is written through to the file. With a buffer size set, formatted
+ * messages are collected as UTF-8 in a preallocated buffer and written when it is full, when a
+ * warning or a more severe message is appended, or on flush(). The buffer can be written from a
+ * crash signal handler with emergency_flush(). The file output itself is done by a FileSink.
  */
 class FileAppender: public LogAppender
 {
@@ -29,6 +33,41 @@ class FileAppender: public LogAppender
         FileAppender(const QString& file_path = "", const QSharedPointer<LogFormatter>& formatter =
                                                         QSharedPointer<SimpleFormatter>::create());
 
+        /**
+         * @brief Sets the size of the write buffer.
+         *
+         * Must not be called while other threads are appending or a crash handler may run.
+         *
+         * @param bytes The size of the buffer in bytes; 0 writes every message through.
+         */
+        auto set_buffer_size(qsizetype bytes) -> void;
+
+        /**
+         * @brief Returns the size of the write buffer.
+         *
+         * @return The size of the buffer in bytes, or 0 if messages are written through.
+         */
+        [[nodiscard]] auto get_buffer_size() const -> qsizetype;
+
+        /**
+         * @brief Returns the number of bytes in the write buffer.
+         *
+         * @return The number of buffered bytes.
+         */
+        [[nodiscard]] auto get_buffered_bytes() const -> qsizetype;
+
+        /**
+         * @brief Writes the buffered messages to the log file.
+         */
+        auto flush() -> void override;
+
+        /**
+         * @brief Writes the buffered messages to the log file with a plain write() call.
+         *
+         * This is async-signal-safe and meant to be called from a crash signal handler.
+         */
+        auto emergency_flush() -> void override;
+
     private:
         /**
          * @brief Appends the specified log message to the log file.
@@ -42,7 +81,6 @@ class FileAppender: public LogAppender
         void internal_append(const LogMessage& message, const QMessageLogContext& context) override;
 
     private:
-        QFile m_log_file;
-        QTextStream m_log_stream;
+        FileSink m_sink;
 };
 }  // namespace QmlApp
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <QFile>
+#include <QMutex>
+#include <QString>
+#include <atomic>
+#include <memory>
+
+namespace QmlApp
+{
+/**
+ * @class FileSink
+ * @brief Writes formatted log lines to a file, optionally through a crash-safe buffer.
+ *
+ * By default every line is written through to the file. With a buffer size set, lines are
+ * collected as UTF-8 in a preallocated buffer and written when it is full, when a warning or a
+ * more severe line is written, or on flush(). The buffer can be written from a crash signal
+ * handler with emergency_flush().
+ *
+ * The sink is the output stage of FileAppender and can be composed with a formatter at compile
+ * time in a StaticAppender. Writing is thread-safe.
+ */
+class FileSink
+{
+    public:
+        // The name of appenders that write to this sink
+        static constexpr const char* kName = "file";
+
+        /**
+         * @brief Constructs a FileSink object and opens the file for appending.
+         *
+         * @param file_path The path of the log file.
+         * @param buffer_size The size of the write buffer in bytes; 0 writes every line through.
+         */
+        explicit FileSink(const QString& file_path, qsizetype buffer_size = 0);
+
+        /**
+         * @brief Destroys the FileSink object after writing out the buffer.
+         */
+        ~FileSink();
+
+        /**
+         * @brief Returns whether the log file is open.
+         *
+         * @return True if the log file is open, false otherwise.
+         */
+        [[nodiscard]] auto is_open() const -> bool;
+
+        /**
+         * @brief Writes a formatted line followed by a line break.
+         *
+         * @param line The formatted line.
+         * @param type The log level of the line.
+         * @return The number of bytes written or buffered.
+         */
+        auto write(const QString& line, QtMsgType type) -> qsizetype;
+
+        /**
+         * @brief Writes the buffered lines to the log file.
+         */
+        auto flush() -> void;
+
+        /**
+         * @brief Writes the buffered lines to the log file with a plain write() call.
+         *
+         * This is async-signal-safe and meant to be called from a crash signal handler.
+         */
+        auto emergency_flush() -> void;
+
+        /**
+         * @brief Sets the size of the write buffer.
+         *
+         * Must not be called while other threads are writing or a crash handler may run.
+         *
+         * @param bytes The size of the buffer in bytes; 0 writes every line through.
+         */
+        auto set_buffer_size(qsizetype bytes) -> void;
+
+        /**
+         * @brief Returns the size of the write buffer.
+         *
+         * @return The size of the buffer in bytes, or 0 if lines are written through.
+         */
+        [[nodiscard]] auto get_buffer_size() const -> qsizetype;
+
+        /**
+         * @brief Returns the number of bytes in the write buffer.
+         *
+         * @return The number of buffered bytes.
+         */
+        [[nodiscard]] auto get_buffered_bytes() const -> qsizetype;
+
+    private:
+        auto append_to_buffer(const QByteArray& line) -> void;
+        [[nodiscard]] auto write_to_file(const char* data, qsizetype size) const -> qsizetype;
+        auto flush_buffer() -> void;
+
+    private:
+        QFile m_log_file;
+        QMutex m_mutex;
+        int m_file_descriptor = -1;
+        std::unique_ptr<char[]> m_buffer;
+        qsizetype m_buffer_size = 0;
+        // Published after the bytes are copied, so a signal handler only sees complete lines
+        std::atomic<qsizetype> m_buffer_used = 0;
+        // Published after each write() of the buffer, so a signal handler skips written bytes
+        std::atomic<qsizetype> m_buffer_written = 0;
+};
+}  // namespace QmlApp
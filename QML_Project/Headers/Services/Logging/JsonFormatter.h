@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Services/Logging/LogFormatter.h"
+
+namespace QmlApp
+{
+/**
+ * @class JsonFormatter
+ * @brief A log formatter that formats each log message as a single-line JSON object.
+ *
+ * The object contains the keys "time" (ISO 8601 with milliseconds), "level", "category", "file",
+ * "line", "function" and "message". If the message carries stack frames, "image_base" and "stack"
+ * hold the load address of the binary and the raw return addresses as hexadecimal strings, which
+ * Scripts/symbolize_stack_trace.sh resolves offline.
+ */
+class JsonFormatter final: public LogFormatter
+{
+    public:
+        /**
+         * @brief Constructs a JsonFormatter object.
+         */
+        JsonFormatter() = default;
+
+        /**
+         * @brief Formats the log message as a single-line JSON object.
+         *
+         * @param log_message The log message to format.
+         * @param context The context of the log message.
+         * @return The JSON object, without a trailing line break.
+         */
+        [[nodiscard]] auto format(const LogMessage& log_message,
+                                  const QMessageLogContext& context) -> QString override;
+};
+}  // namespace QmlApp
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <QVector>
+#include <QtGlobal>
+#include <array>
+#include <atomic>
+
+namespace QmlApp
+{
+/**
+ * @class LatencyHistogram
+ * @brief A lock-free, log-linear latency histogram in the style of an HDR histogram.
+ *
+ * Values are recorded in nanoseconds. Every power of two is split into eight linear sub-buckets,
+ * so the relative error of a reported percentile is at most 12.5% over the full 64-bit range,
+ * while recording costs a bit scan and one relaxed atomic increment.
+ */
+class LatencyHistogram
+{
+    public:
+        static constexpr int kSubBucketBits = 3;
+        static constexpr int kSubBucketCount = 1 << kSubBucketBits;
+        static constexpr int kBucketCount = (64 - kSubBucketBits + 1) * kSubBucketCount;
+
+        /**
+         * @struct Snapshot
+         * @brief A consistent-enough copy of the histogram counters.
+         */
+        struct Snapshot {
+                QVector<quint64> buckets;
+                quint64 count = 0;
+                quint64 sum_ns = 0;
+                quint64 max_ns = 0;
+
+                /**
+                 * @brief Returns the value below which the given fraction of samples falls.
+                 *
+                 * @param quantile The quantile in the range [0, 1].
+                 * @return The upper bound of the bucket that contains the quantile, in nanoseconds.
+                 */
+                [[nodiscard]] auto percentile(double quantile) const -> quint64;
+
+                /**
+                 * @brief Returns the number of samples less than or equal to the given value.
+                 *
+                 * @param value_ns The value in nanoseconds.
+                 * @return The cumulative sample count at bucket granularity.
+                 */
+                [[nodiscard]] auto count_at_or_below(quint64 value_ns) const -> quint64;
+        };
+
+        /**
+         * @brief Constructs an empty LatencyHistogram object.
+         */
+        LatencyHistogram() = default;
+
+        /**
+         * @brief Records a latency sample.
+         *
+         * @param value_ns The latency in nanoseconds.
+         */
+        auto record(quint64 value_ns) -> void;
+
+        /**
+         * @brief Returns a snapshot of the current counters.
+         *
+         * @return The snapshot.
+         */
+        [[nodiscard]] auto snapshot() const -> Snapshot;
+
+        /**
+         * @brief Resets all counters to zero.
+         */
+        auto reset() -> void;
+
+        /**
+         * @brief Returns the index of the bucket the given value is counted in.
+         *
+         * @param value_ns The value in nanoseconds.
+         * @return The bucket index.
+         */
+        [[nodiscard]] static auto bucket_index(quint64 value_ns) -> int;
+
+        /**
+         * @brief Returns the largest value that is counted in the given bucket.
+         *
+         * @param index The bucket index.
+         * @return The inclusive upper bound of the bucket in nanoseconds.
+         */
+        [[nodiscard]] static auto bucket_upper_bound(int index) -> quint64;
+
+    private:
+        std::array<std::atomic<quint64>, kBucketCount> m_buckets{};
+        std::atomic<quint64> m_count = 0;
+        std::atomic<quint64> m_sum_ns = 0;
+        std::atomic<quint64> m_max_ns = 0;
+};
+}  // namespace QmlApp
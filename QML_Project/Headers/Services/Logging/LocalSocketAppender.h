@@ -0,0 +1,83 @@
+#pragma once
+
+#include <QByteArray>
+#include <QString>
+#include <QThread>
+
+#include "Services/Logging/LocalSocketWorker.h"
+#include "Services/Logging/LogAppender.h"
+#include "Services/Logging/SimpleFormatter.h"
+
+namespace QmlApp
+{
+/**
+ * @class LocalSocketAppender
+ * @brief A log appender that ships log messages to a local collector over a local socket.
+ *
+ * Each formatted message is sent as a frame consisting of a 32-bit big-endian length followed by
+ * the UTF-8 encoded message. Frames are batched and written by a LocalSocketWorker running in its
+ * own thread, so appending a message never blocks on the collector.
+ */
+class LocalSocketAppender: public LogAppender
+{
+    public:
+        /**
+         * @brief Constructs a LocalSocketAppender object.
+         *
+         * @param server_name The name of the local server the collector listens on.
+         * @param formatter The formatter to use for formatting log messages.
+         *                  If no formatter is provided, a default SimpleFormatter is used.
+         * @param max_batch_bytes The number of queued bytes that triggers an immediate write.
+         * @param max_batch_delay_ms The maximum time in milliseconds a frame waits before it is
+         *                           written.
+         * @param max_spill_bytes The maximum number of bytes kept while the collector is down.
+         */
+        LocalSocketAppender(const QString& server_name,
+                            const QSharedPointer<LogFormatter>& formatter =
+                                QSharedPointer<SimpleFormatter>::create(),
+                            qsizetype max_batch_bytes = 64 * 1024, int max_batch_delay_ms = 100,
+                            qsizetype max_spill_bytes = 4 * 1024 * 1024);
+
+        /**
+         * @brief Destroys the LocalSocketAppender object.
+         *
+         * Pending frames are flushed and the worker thread is stopped.
+         */
+        ~LocalSocketAppender() override;
+
+        /**
+         * @brief Returns the number of frames dropped because the spill buffer was full.
+         *
+         * @return The number of dropped frames.
+         */
+        [[nodiscard]] auto get_dropped_count() const -> quint64;
+
+        /**
+         * @brief Returns the number of bytes waiting to be shipped to the collector.
+         *
+         * @return The number of pending bytes.
+         */
+        [[nodiscard]] auto get_pending_bytes() const -> qsizetype;
+
+        /**
+         * @brief Encodes the given payload as a length-prefixed frame.
+         *
+         * @param payload The payload to encode.
+         * @return The payload prefixed with its size as a 32-bit big-endian integer.
+         */
+        [[nodiscard]] static auto encode_frame(const QByteArray& payload) -> QByteArray;
+
+    private:
+        /**
+         * @brief Formats the log message and queues it for shipping.
+         *
+         * @param message The log message to append.
+         * @param context The context of the log message.
+         */
+        void internal_append(const LogMessage& message, const QMessageLogContext& context) override;
+
+    private:
+        QThread m_worker_thread;
+        LocalSocketWorker* m_worker;
+};
+}  // namespace QmlApp
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <QByteArray>
+#include <QLocalSocket>
+#include <QMutex>
+#include <QObject>
+#include <QQueue>
+#include <QString>
+#include <QTimer>
+#include <atomic>
+
+namespace QmlApp
+{
+/**
+ * @class LocalSocketWorker
+ * @brief Ships length-prefixed log frames to a local collector from a dedicated thread.
+ *
+ * Frames are queued by any thread through `enqueue`, which only takes a short lock and never
+ * touches the socket. The worker lives in its own thread where it owns the QLocalSocket, writes
+ * queued frames in batches and reconnects with an exponential backoff while the collector is
+ * unavailable. While disconnected, frames are kept in a bounded spill queue; once the queue is
+ * full the oldest frames are dropped.
+ */
+class LocalSocketWorker: public QObject
+{
+        Q_OBJECT
+
+    public:
+        /**
+         * @brief Constructs a LocalSocketWorker object.
+         *
+         * @param server_name The name of the local server to connect to.
+         * @param max_batch_bytes The number of queued bytes that triggers an immediate write.
+         * @param max_batch_delay_ms The maximum time in milliseconds a frame waits before it is
+         *                           written.
+         * @param max_spill_bytes The maximum number of bytes kept while the collector is down.
+         * @param parent The parent object.
+         */
+        LocalSocketWorker(QString server_name, qsizetype max_batch_bytes, int max_batch_delay_ms,
+                          qsizetype max_spill_bytes, QObject* parent = nullptr);
+        ~LocalSocketWorker() override = default;
+
+        /**
+         * @brief Queues an encoded frame for shipping.
+         *
+         * This method is thread-safe and never blocks on socket I/O.
+         *
+         * @param frame The length-prefixed frame to queue.
+         */
+        auto enqueue(QByteArray frame) -> void;
+
+        /**
+         * @brief Returns the number of frames dropped because the spill queue was full.
+         *
+         * @return The number of dropped frames.
+         */
+        [[nodiscard]] auto get_dropped_count() const -> quint64;
+
+        /**
+         * @brief Returns the number of bytes currently waiting to be shipped.
+         *
+         * @return The number of queued bytes.
+         */
+        [[nodiscard]] auto get_queued_bytes() const -> qsizetype;
+
+    public slots:
+        /**
+         * @brief Creates the socket and timers in the worker thread and connects to the server.
+         */
+        void start();
+
+        /**
+         * @brief Writes all queued frames to the socket if it is connected.
+         */
+        void flush();
+
+        /**
+         * @brief Flushes pending frames, disconnects and releases the socket and timers.
+         */
+        void stop();
+
+    private:
+        auto connect_to_server() -> void;
+        auto schedule_reconnect() -> void;
+        auto request_flush() -> void;
+
+    private:
+        QString m_server_name;
+        qsizetype m_max_batch_bytes;
+        int m_max_batch_delay_ms;
+        qsizetype m_max_spill_bytes;
+
+        QLocalSocket* m_socket = nullptr;
+        QTimer* m_batch_timer = nullptr;
+        QTimer* m_reconnect_timer = nullptr;
+        int m_reconnect_delay_ms;
+
+        mutable QMutex m_mutex;
+        QQueue<QByteArray> m_frames;
+        qsizetype m_queued_bytes = 0;
+
+        std::atomic<bool> m_connected = false;
+        std::atomic<bool> m_flush_requested = false;
+        std::atomic<quint64> m_dropped_count = 0;
+};
+}  // namespace QmlApp
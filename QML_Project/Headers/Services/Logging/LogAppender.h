@@ -2,9 +2,11 @@
 
 #include <QMessageLogContext>
 #include <QSharedPointer>
+#include <atomic>
 
 #include "Services/Logging/LogFormatter.h"
 #include "Services/Logging/LogMessage.h"
+#include "Services/Logging/LogMetrics.h"
 #include "Services/Logging/SimpleFormatter.h"
 
 namespace QmlApp
@@ -18,6 +20,9 @@ namespace QmlApp
 class LogAppender
 {
     public:
+        // By default the latency of every 64th accepted record is measured
+        static constexpr quint32 kDefaultLatencySampleInterval = 64;
+
         /**
          * @brief Constructs a LogAppender object with a default SimpleFormatter.
          */
@@ -40,7 +45,8 @@ class LogAppender
          *
          * This method appends the specified log message to the log appender.
          * The log message is only appended if its type is greater than or equal to
-         * the log level of the appender.
+         * the log level of the appender. Accepted and filtered records are counted in the metrics
+         * of the appender, and the latency of a sample of the appends is recorded there.
          *
          * @param message The log message to append.
          * @param context The context of the log message.
@@ -72,6 +78,62 @@ class LogAppender
          */
         [[nodiscard]] auto get_log_level() const -> QtMsgType;
 
+        /**
+         * @brief Returns the name of the log appender.
+         *
+         * The name identifies the appender in metrics output, e.g. "console" or "file".
+         *
+         * @return The name of the log appender.
+         */
+        [[nodiscard]] auto get_name() const -> QString;
+
+        /**
+         * @brief Sets the name of the log appender.
+         *
+         * @param name The name to set.
+         */
+        auto set_name(const QString& name) -> void;
+
+        /**
+         * @brief Returns the metrics of the log appender.
+         *
+         * @return The metrics of the log appender.
+         */
+        [[nodiscard]] auto get_metrics() const -> const LogMetrics&;
+
+        /**
+         * @brief Sets how often the latency of an append is measured.
+         *
+         * Measuring takes two clock reads per record, so only every n-th accepted record is
+         * timed; the first accepted record always is.
+         *
+         * @param interval The sample interval n; 1 times every record, 0 disables timing.
+         */
+        auto set_latency_sample_interval(quint32 interval) -> void;
+
+        /**
+         * @brief Returns how often the latency of an append is measured.
+         *
+         * @return The sample interval; 0 if timing is disabled.
+         */
+        [[nodiscard]] auto get_latency_sample_interval() const -> quint32;
+
+        /**
+         * @brief Writes out any data the appender has buffered.
+         *
+         * The default implementation does nothing, for appenders that do not buffer.
+         */
+        virtual auto flush() -> void;
+
+        /**
+         * @brief Writes out buffered data from a crash signal handler.
+         *
+         * Implementations must be async-signal-safe: no locks, no allocations and no Qt I/O, only
+         * plain write() calls on data that is already encoded. The default implementation does
+         * nothing.
+         */
+        virtual auto emergency_flush() -> void;
+
     private:
         /**
          * @brief Appends a log message to the log appender.
@@ -89,6 +151,12 @@ class LogAppender
     protected:
         QSharedPointer<LogFormatter> m_formatter;
         QtMsgType m_log_level;
+        QString m_name;
+        LogMetrics m_metrics;
+
+    private:
+        quint32 m_latency_sample_interval = kDefaultLatencySampleInterval;
+        std::atomic<quint64> m_accepted_count = 0;
 };
 
 }  // namespace QmlApp
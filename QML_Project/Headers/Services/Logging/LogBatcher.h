@@ -0,0 +1,127 @@
+#pragma once
+
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Services/Logging/LogRecord.h"
+
+namespace QmlApp
+{
+/**
+ * @class LogBatcher
+ * @brief Collects log records in per-thread staging buffers and hands them to a writer thread.
+ *
+ * Each producer thread appends records to its own staging buffer, which is only contended when
+ * the writer takes it. The writer thread takes all buffers when one of them reaches the batch
+ * size, when a warning or a more severe record is staged, or when the oldest staged record has
+ * waited for the batch delay. The taken batches are merged by sequence number and passed to the
+ * consumer in that order, so records of one drain are dispatched in the order they were logged.
+ *
+ * Staging is thread-safe. The consumer is only called from one thread at a time: the writer
+ * thread, or a thread calling flush().
+ */
+class LogBatcher
+{
+    public:
+        using Consumer = std::function<void(const LogRecord&)>;
+
+        /**
+         * @brief Constructs a LogBatcher object and starts its writer thread.
+         *
+         * @param consumer The function the staged records are passed to.
+         * @param max_batch_size The number of records in a staging buffer that triggers a drain.
+         * @param max_batch_delay_ms The maximum time in milliseconds a record stays staged.
+         */
+        explicit LogBatcher(Consumer consumer, qsizetype max_batch_size = 64,
+                            int max_batch_delay_ms = 2);
+
+        /**
+         * @brief Destroys the LogBatcher object.
+         *
+         * The writer thread is stopped and all staged records are passed to the consumer.
+         */
+        ~LogBatcher();
+
+        /**
+         * @brief Stages a record in the staging buffer of the calling thread.
+         *
+         * @param record The record to stage.
+         */
+        auto stage(LogRecord record) -> void;
+
+        /**
+         * @brief Passes all staged records to the consumer in the calling thread.
+         *
+         * Does nothing if called from the consumer, since the running drain passes the records on.
+         */
+        auto flush() -> void;
+
+        /**
+         * @brief Returns the number of records that were staged but not yet consumed.
+         *
+         * @return The number of pending records.
+         */
+        [[nodiscard]] auto pending_record_count() const -> qsizetype;
+
+        /**
+         * @brief Returns the number of registered staging buffers.
+         *
+         * @return The number of staging buffers.
+         */
+        [[nodiscard]] auto get_staging_buffer_count() const -> qsizetype;
+
+        /**
+         * @brief Returns the number of records in a staging buffer that triggers a drain.
+         *
+         * @return The maximum batch size.
+         */
+        [[nodiscard]] auto get_max_batch_size() const -> qsizetype;
+
+        /**
+         * @brief Returns the maximum time in milliseconds a record stays staged.
+         *
+         * @return The maximum batch delay.
+         */
+        [[nodiscard]] auto get_max_batch_delay_ms() const -> int;
+
+    private:
+        using Batch = std::vector<LogRecord>;
+
+        /**
+         * @struct StagingBuffer
+         * @brief The records staged by one thread.
+         */
+        struct StagingBuffer {
+                QMutex mutex;
+                Batch records;
+        };
+
+        [[nodiscard]] auto staging_buffer() -> StagingBuffer&;
+        auto request_drain() -> void;
+        auto run() -> void;
+        auto drain() -> void;
+
+    private:
+        Consumer m_consumer;
+        qsizetype m_max_batch_size;
+        int m_max_batch_delay_ms;
+        quint64 m_id;
+
+        mutable QMutex m_registry_mutex;
+        std::vector<std::shared_ptr<StagingBuffer>> m_buffers;
+
+        QMutex m_wake_mutex;
+        QWaitCondition m_wake_condition;
+        bool m_stopping = false;
+        std::atomic<bool> m_drain_requested = false;
+
+        QMutex m_drain_mutex;
+        std::atomic<qsizetype> m_pending = 0;
+        std::unique_ptr<QThread> m_writer_thread;
+};
+}  // namespace QmlApp
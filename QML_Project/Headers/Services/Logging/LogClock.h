@@ -0,0 +1,84 @@
+#pragma once
+
+#include <QDateTime>
+#include <QString>
+#include <QtGlobal>
+
+namespace QmlApp
+{
+/**
+ * @class LogClock
+ * @brief A cheap monotonic clock for log timestamps.
+ *
+ * Taking a timestamp only reads a counter: the CPU timestamp counter on x86 processors whose TSC
+ * is invariant, otherwise CLOCK_MONOTONIC_COARSE, CLOCK_MONOTONIC or std::chrono::steady_clock,
+ * whichever is available first. The clock is calibrated against wall time once, the first time a
+ * timestamp is taken, and ticks are converted to calendar time only when a record is formatted or
+ * decoded.
+ *
+ * The TSC rate is first measured over a few milliseconds and refined against the steady clock on
+ * later conversions, at intervals that double from one second on. A refined rate only applies to
+ * ticks taken after the refinement, so a tick always converts to the same calendar time and later
+ * ticks never convert to an earlier one. Since calendar times are derived from the monotonic
+ * counter, they do not follow steps of the system clock made after the calibration.
+ */
+class LogClock
+{
+    public:
+        /**
+         * @enum Source
+         * @brief The counter the clock reads.
+         */
+        enum class Source
+        {
+            Tsc,
+            MonotonicCoarse,
+            Monotonic,
+            SteadyClock
+        };
+
+        /**
+         * @brief Returns the current value of the counter.
+         *
+         * @return The number of ticks; only differences and conversions are meaningful.
+         */
+        [[nodiscard]] static auto now() -> quint64;
+
+        /**
+         * @brief Converts ticks to milliseconds since the Unix epoch.
+         *
+         * @param ticks A value returned by now().
+         * @return The wall time in milliseconds since the epoch.
+         */
+        [[nodiscard]] static auto to_msecs_since_epoch(quint64 ticks) -> qint64;
+
+        /**
+         * @brief Converts ticks to a local date and time.
+         *
+         * @param ticks A value returned by now().
+         * @return The local date and time.
+         */
+        [[nodiscard]] static auto to_date_time(quint64 ticks) -> QDateTime;
+
+        /**
+         * @brief Returns the counter the clock reads.
+         *
+         * @return The source.
+         */
+        [[nodiscard]] static auto source() -> Source;
+
+        /**
+         * @brief Returns a readable name of the counter the clock reads.
+         *
+         * @return The name, e.g. "tsc".
+         */
+        [[nodiscard]] static auto source_name() -> QString;
+
+        /**
+         * @brief Returns the current estimate of the counter rate.
+         *
+         * @return The number of ticks per second.
+         */
+        [[nodiscard]] static auto ticks_per_second() -> double;
+};
+}  // namespace QmlApp
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <QFile>
+#include <QFuture>
+#include <QMutex>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <QVector>
+#include <atomic>
+
+namespace QmlApp
+{
+/**
+ * @class LogFileReader
+ * @brief Provides random access to the lines of a large log file.
+ *
+ * The file is memory-mapped instead of being read into memory. A line index (the offset of every
+ * newline) is built in a background thread, so the first lines are available right after
+ * `open()` while the rest of the file is still being indexed. When following is enabled, the
+ * reader polls the file size and indexes appended data incrementally, similar to `tail -f`.
+ *
+ * All methods must be called from the thread the reader lives in.
+ */
+class LogFileReader: public QObject
+{
+        Q_OBJECT
+
+    public:
+        /**
+         * @brief Constructs a LogFileReader object.
+         *
+         * @param parent The parent object.
+         */
+        explicit LogFileReader(QObject* parent = nullptr);
+
+        /**
+         * @brief Closes the file and stops indexing.
+         */
+        ~LogFileReader() override;
+
+        /**
+         * @brief Opens and maps the given file and starts indexing it.
+         *
+         * @param file_path The path of the log file.
+         * @return True if the file was opened, false otherwise.
+         */
+        auto open(const QString& file_path) -> bool;
+
+        /**
+         * @brief Stops indexing, unmaps and closes the file.
+         */
+        auto close() -> void;
+
+        /**
+         * @brief Returns whether a file is open.
+         *
+         * @return True if a file is open, false otherwise.
+         */
+        [[nodiscard]] auto is_open() const -> bool;
+
+        /**
+         * @brief Returns whether the background index is still being built.
+         *
+         * @return True while indexing, false otherwise.
+         */
+        [[nodiscard]] auto is_indexing() const -> bool;
+
+        /**
+         * @brief Blocks until the background index is complete.
+         */
+        auto wait_for_index() -> void;
+
+        /**
+         * @brief Returns the number of lines indexed so far.
+         *
+         * @return The number of lines.
+         */
+        [[nodiscard]] auto line_count() const -> qint64;
+
+        /**
+         * @brief Returns the raw bytes of the given line without the line terminator.
+         *
+         * @param line_number The zero-based line number.
+         * @return The line, or an empty byte array if the line is not indexed.
+         */
+        [[nodiscard]] auto line_bytes(qint64 line_number) const -> QByteArray;
+
+        /**
+         * @brief Returns the given line decoded as UTF-8 without the line terminator.
+         *
+         * @param line_number The zero-based line number.
+         * @return The line, or an empty string if the line is not indexed.
+         */
+        [[nodiscard]] auto line(qint64 line_number) const -> QString;
+
+        /**
+         * @brief Returns the number of mapped bytes.
+         *
+         * @return The size of the mapped part of the file.
+         */
+        [[nodiscard]] auto get_mapped_size() const -> qint64;
+
+        /**
+         * @brief Enables or disables following the file as it grows.
+         *
+         * @param follow Whether to follow the file.
+         * @param interval_ms The polling interval in milliseconds.
+         */
+        auto set_follow(bool follow, int interval_ms = 250) -> void;
+
+        /**
+         * @brief Returns whether the file is followed as it grows.
+         *
+         * @return True if following, false otherwise.
+         */
+        [[nodiscard]] auto is_following() const -> bool;
+
+        /**
+         * @brief Checks the file size and indexes data appended since the last check.
+         */
+        auto refresh() -> void;
+
+        /**
+         * @brief Finds the first newline in the given range, scanning eight bytes at a time.
+         *
+         * @param begin The start of the range.
+         * @param end The end of the range.
+         * @return A pointer to the first newline, or `end` if the range has none.
+         */
+        [[nodiscard]] static auto find_newline(const uchar* begin, const uchar* end)
+            -> const uchar*;
+
+    signals:
+        void lineCountChanged();
+        void indexingFinished();
+        void fileReset();
+
+    private:
+        auto map_file() -> bool;
+        auto start_indexing(qint64 from, qint64 to) -> void;
+        auto index_range(const uchar* data, qint64 from, qint64 to) -> void;
+        auto on_indexing_finished() -> void;
+
+    private:
+        QFile m_file;
+        uchar* m_data = nullptr;
+        qint64 m_mapped_size = 0;
+
+        mutable QMutex m_mutex;
+        QVector<qint64> m_line_ends;
+        qint64 m_indexed_end = 0;
+
+        QFuture<void> m_index_future;
+        std::atomic<bool> m_indexing = false;
+        std::atomic<bool> m_cancel = false;
+        bool m_refresh_pending = false;
+
+        QTimer m_follow_timer;
+};
+}  // namespace QmlApp
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <QStringView>
+
+#include "Services/Logging/LogRecord.h"
+
+namespace QmlApp
+{
+/**
+ * @class LogLineParser
+ * @brief Parses log files written by the SimpleFormatter or the JsonFormatter back into records.
+ *
+ * SimpleFormatter lines may contain the ANSI color codes the formatter writes; they are removed
+ * before parsing. Their timestamps only have a resolution of one second. JSON lines are the
+ * objects written by the JsonFormatter; the stack frames are not restored, since they are only
+ * meaningful in the process that captured them.
+ */
+class LogLineParser
+{
+    public:
+        /**
+         * @brief Parses a line written by the SimpleFormatter.
+         *
+         * @param line The line, without the line terminator.
+         * @param record The record to fill in.
+         * @return True if the line was parsed, false if it is not a SimpleFormatter line.
+         */
+        [[nodiscard]] static auto parse_text_line(const QString& line, LogRecord& record) -> bool;
+
+        /**
+         * @brief Parses a line written by the JsonFormatter.
+         *
+         * @param line The line, without the line terminator.
+         * @param record The record to fill in.
+         * @return True if the line was parsed, false if it is not a JsonFormatter line.
+         */
+        [[nodiscard]] static auto parse_json_line(const QByteArray& line, LogRecord& record)
+            -> bool;
+
+        /**
+         * @brief Parses all records of a log file.
+         *
+         * Lines starting with '{' are parsed as JSON, all others as SimpleFormatter lines. A text
+         * line that cannot be parsed continues the message of the previous record, as written for
+         * multi-line messages. The records are numbered in file order.
+         *
+         * @param file_path The path of the log file.
+         * @param records The list the parsed records are appended to.
+         * @return True if the file was read, false if it could not be opened.
+         */
+        [[nodiscard]] static auto parse_file(const QString& file_path, QList<LogRecord>& records)
+            -> bool;
+
+        /**
+         * @brief Converts a level name to a message type, ignoring case.
+         *
+         * @param name The level name, e.g. "Warning" or "warning".
+         * @param level The message type to fill in.
+         * @return True if the name is a known level, false otherwise.
+         */
+        [[nodiscard]] static auto parse_level(QStringView name, QtMsgType& level) -> bool;
+
+        /**
+         * @brief Removes ANSI escape sequences from a line.
+         *
+         * @param line The line.
+         * @return The line without escape sequences.
+         */
+        [[nodiscard]] static auto strip_ansi_codes(const QString& line) -> QString;
+};
+}  // namespace QmlApp
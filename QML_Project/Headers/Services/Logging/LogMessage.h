@@ -1,6 +1,8 @@
 #pragma once
 
+#include <QDateTime>
 #include <QDebug>
+#include <QList>
 #include <QString>
 
 namespace QmlApp
@@ -9,7 +11,10 @@ namespace QmlApp
  * @class LogMessage
  * @brief Represents a log message with a type and content.
  *
- * This class encapsulates a log message, including its type and content.
+ * This class encapsulates a log message, including its type and content. Messages logged through
+ * the Logger carry a LogClock timestamp, which is only converted to calendar time when the
+ * message is formatted. Critical and fatal messages also carry the raw return addresses of the
+ * logging call stack.
  */
 class LogMessage
 {
@@ -41,8 +46,56 @@ class LogMessage
          */
         [[nodiscard]] auto get_message() const -> const QString&;
 
+        /**
+         * @brief Sets the raw return addresses of the call stack the message was logged from.
+         *
+         * @param frames The return addresses, innermost first.
+         */
+        auto set_stack_frames(QList<quintptr> frames) -> void;
+
+        /**
+         * @brief Gets the raw return addresses of the call stack the message was logged from.
+         *
+         * @return The return addresses, innermost first, or an empty list if none were captured.
+         */
+        [[nodiscard]] auto get_stack_frames() const -> const QList<quintptr>&;
+
+        /**
+         * @brief Sets the time the message was logged.
+         *
+         * @param ticks A value returned by LogClock::now().
+         */
+        auto set_timestamp(quint64 ticks) -> void;
+
+        /**
+         * @brief Gets the time the message was logged.
+         *
+         * @return The LogClock ticks, or 0 if the message was not stamped.
+         */
+        [[nodiscard]] auto get_timestamp() const -> quint64;
+
+        /**
+         * @brief Gets the time the message was logged as a local date and time.
+         *
+         * @return The converted timestamp, or the current time if the message was not stamped.
+         */
+        [[nodiscard]] auto get_date_time() const -> QDateTime;
+
+        /**
+         * @brief Returns the severity rank of a log level, from 0 (debug) to 4 (fatal).
+         *
+         * QtMsgType values are not ordered by severity (QtInfoMsg has the highest value), so
+         * level filters compare this rank instead.
+         *
+         * @param type The log level.
+         * @return The severity rank.
+         */
+        [[nodiscard]] static auto severity(QtMsgType type) -> int;
+
     private:
         QtMsgType m_type;
         QString m_message;
+        QList<quintptr> m_stack_frames;
+        quint64 m_timestamp = 0;
 };
 }  // namespace QmlApp
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <QString>
+#include <QtGlobal>
+#include <array>
+#include <atomic>
+
+#include "Services/Logging/LatencyHistogram.h"
+
+namespace QmlApp
+{
+/**
+ * @struct LogMetricsSnapshot
+ * @brief A point-in-time copy of the counters of a LogMetrics object.
+ */
+struct LogMetricsSnapshot {
+        static constexpr int kLevelCount = 5;
+
+        std::array<quint64, kLevelCount> records_by_level{};
+        quint64 records_filtered = 0;
+        quint64 bytes_emitted = 0;
+        LatencyHistogram::Snapshot latency;
+
+        /**
+         * @brief Returns the number of accepted records of the given level.
+         *
+         * @param level The log level.
+         * @return The number of records.
+         */
+        [[nodiscard]] auto records(QtMsgType level) const -> quint64;
+
+        /**
+         * @brief Returns the number of accepted records over all levels.
+         *
+         * @return The number of records.
+         */
+        [[nodiscard]] auto total_records() const -> quint64;
+};
+
+/**
+ * @class LogMetrics
+ * @brief Lock-free counters describing what logging costs.
+ *
+ * A LogMetrics object counts accepted records by level, records discarded by the log level filter,
+ * bytes emitted and the latency of the guarded operation. All counters are relaxed atomics and can
+ * be updated from any thread.
+ */
+class LogMetrics
+{
+    public:
+        /**
+         * @brief Constructs a LogMetrics object with all counters set to zero.
+         */
+        LogMetrics() = default;
+
+        /**
+         * @brief Counts an accepted record of the given level.
+         *
+         * @param level The log level of the record.
+         */
+        auto record_accepted(QtMsgType level) -> void;
+
+        /**
+         * @brief Counts a record discarded by the log level filter.
+         */
+        auto record_filtered() -> void;
+
+        /**
+         * @brief Adds the given number of bytes to the emitted bytes counter.
+         *
+         * @param bytes The number of bytes emitted.
+         */
+        auto record_bytes(quint64 bytes) -> void;
+
+        /**
+         * @brief Records a latency sample.
+         *
+         * @param nanoseconds The latency in nanoseconds.
+         */
+        auto record_latency(quint64 nanoseconds) -> void;
+
+        /**
+         * @brief Returns a snapshot of all counters.
+         *
+         * @return The snapshot.
+         */
+        [[nodiscard]] auto snapshot() const -> LogMetricsSnapshot;
+
+        /**
+         * @brief Resets all counters to zero.
+         */
+        auto reset() -> void;
+
+        /**
+         * @brief Returns the lower case name of the given log level.
+         *
+         * @param level The log level.
+         * @return The name of the level, e.g. "debug" or "warning".
+         */
+        [[nodiscard]] static auto level_name(QtMsgType level) -> QString;
+
+    private:
+        std::array<std::atomic<quint64>, LogMetricsSnapshot::kLevelCount> m_records_by_level{};
+        std::atomic<quint64> m_records_filtered = 0;
+        std::atomic<quint64> m_bytes_emitted = 0;
+        LatencyHistogram m_latency;
+};
+}  // namespace QmlApp
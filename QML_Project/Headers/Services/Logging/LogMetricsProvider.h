@@ -0,0 +1,59 @@
+#pragma once
+
+#include <QObject>
+#include <QTimer>
+#include <QVariantList>
+#include <QVariantMap>
+
+#include "Services/Logging/LogMetrics.h"
+
+namespace QmlApp
+{
+/**
+ * @class LogMetricsProvider
+ * @brief Exposes the metrics of the Logger and its appenders to QML.
+ *
+ * The provider keeps a snapshot of the logging metrics as QVariant maps, which QML bindings can
+ * read through the `logger` and `appenders` properties. The snapshot is refreshed on demand via
+ * `refresh()` or periodically when `refreshInterval` is greater than zero.
+ */
+class LogMetricsProvider: public QObject
+{
+        Q_OBJECT
+        Q_PROPERTY(QVariantMap logger READ getLogger NOTIFY metricsChanged)
+        Q_PROPERTY(QVariantList appenders READ getAppenders NOTIFY metricsChanged)
+        Q_PROPERTY(int refreshInterval READ getRefreshInterval WRITE setRefreshInterval NOTIFY
+                       refreshIntervalChanged)
+
+    public:
+        explicit LogMetricsProvider(QObject* parent = nullptr);
+        ~LogMetricsProvider() override = default;
+
+        // NOLINTBEGIN(modernize-use-trailing-return-type)
+        [[nodiscard]] QVariantMap getLogger() const;
+        [[nodiscard]] QVariantList getAppenders() const;
+
+        [[nodiscard]] int getRefreshInterval() const;
+        void setRefreshInterval(int interval_ms);
+
+        Q_INVOKABLE void refresh();
+        // NOLINTEND(modernize-use-trailing-return-type)
+
+        /**
+         * @brief Converts a metrics snapshot into a QVariantMap readable from QML.
+         *
+         * @param snapshot The snapshot to convert.
+         * @return The snapshot as a map of counter names to values.
+         */
+        [[nodiscard]] static auto to_variant_map(const LogMetricsSnapshot& snapshot) -> QVariantMap;
+
+    signals:
+        void metricsChanged();
+        void refreshIntervalChanged();
+
+    private:
+        QTimer m_refresh_timer;
+        QVariantMap m_logger;
+        QVariantList m_appenders;
+};
+}  // namespace QmlApp
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <QList>
+#include <QMutex>
+
+#include "Services/Logging/LogAppender.h"
+#include "Services/Logging/LogRecord.h"
+
+namespace QmlApp
+{
+/**
+ * @class LogModelAppender
+ * @brief A log appender that collects records for an in-app log view.
+ *
+ * Records are captured into a bounded pending list that can be filled from any thread. The
+ * consumer, typically a LogListModel, takes all pending records at once in the GUI thread. When
+ * the consumer falls behind, the oldest pending records are dropped.
+ */
+class LogModelAppender: public LogAppender
+{
+    public:
+        /**
+         * @brief Constructs a LogModelAppender object.
+         *
+         * @param max_pending The maximum number of records kept until they are taken.
+         */
+        explicit LogModelAppender(int max_pending = 100000);
+
+        /**
+         * @brief Takes all pending records.
+         *
+         * @return The pending records in the order they were appended.
+         */
+        [[nodiscard]] auto take_pending() -> QList<LogRecord>;
+
+        /**
+         * @brief Sets the maximum number of records kept until they are taken.
+         *
+         * @param max_pending The maximum number of pending records.
+         */
+        auto set_max_pending(int max_pending) -> void;
+
+    private:
+        /**
+         * @brief Captures the log message into the pending list.
+         *
+         * @param message The log message to append.
+         * @param context The context of the log message.
+         */
+        void internal_append(const LogMessage& message, const QMessageLogContext& context) override;
+
+    private:
+        QMutex m_mutex;
+        QList<LogRecord> m_pending;
+        int m_max_pending;
+};
+}  // namespace QmlApp
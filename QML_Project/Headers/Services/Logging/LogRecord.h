@@ -0,0 +1,79 @@
+#pragma once
+
+#include <QByteArray>
+#include <QList>
+#include <QMessageLogContext>
+#include <QString>
+
+#include "Services/Logging/LogMessage.h"
+
+namespace QmlApp
+{
+/**
+ * @struct LogRecord
+ * @brief A self-contained copy of a log message and its context.
+ *
+ * Unlike QMessageLogContext, which only points to strings owned by the caller, a LogRecord owns
+ * copies of the file, function and category names. It can therefore be stored and processed after
+ * the logging call has returned, e.g. by a model or in another thread.
+ *
+ * Captured records keep the LogClock timestamp of the message; records read back from a log file
+ * only have the calendar time. msecs_since_epoch() returns either.
+ */
+struct LogRecord {
+        quint64 sequence = 0;
+        QtMsgType type = QtDebugMsg;
+        qint64 timestamp_ms = 0;
+        quint64 timestamp_ticks = 0;
+        QByteArray category;
+        QByteArray file;
+        QByteArray function;
+        int line = 0;
+        QString message;
+        QList<quintptr> stack_frames;
+
+        /**
+         * @brief Captures a log message and its context into a record.
+         *
+         * The record keeps the timestamp of the message, or is stamped with the current LogClock
+         * time if the message has none, and gets the next global sequence number.
+         *
+         * @param message The log message.
+         * @param context The context of the log message.
+         * @return The captured record.
+         */
+        [[nodiscard]] static auto capture(const LogMessage& message,
+                                          const QMessageLogContext& context) -> LogRecord;
+
+        /**
+         * @brief Returns the next value of the process-wide record sequence counter.
+         *
+         * @return A sequence number that is strictly greater than all previously returned ones.
+         */
+        [[nodiscard]] static auto next_sequence() -> quint64;
+
+        /**
+         * @brief Returns a message log context pointing to the strings owned by this record.
+         *
+         * The returned context is only valid as long as the record is alive and unchanged.
+         *
+         * @return The message log context.
+         */
+        [[nodiscard]] auto context() const -> QMessageLogContext;
+
+        /**
+         * @brief Returns a log message with the type, text and stack frames of this record.
+         *
+         * @return The log message.
+         */
+        [[nodiscard]] auto to_message() const -> LogMessage;
+
+        /**
+         * @brief Returns the time the record was logged.
+         *
+         * @return The milliseconds since the epoch, converted from the LogClock timestamp if the
+         *         record has one.
+         */
+        [[nodiscard]] auto msecs_since_epoch() const -> qint64;
+};
+}  // namespace QmlApp
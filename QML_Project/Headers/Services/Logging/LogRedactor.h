@@ -0,0 +1,122 @@
+#pragma once
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <array>
+#include <bitset>
+#include <string_view>
+#include <vector>
+
+namespace QmlApp
+{
+/**
+ * @brief A set of bytes, used to extend a redaction match to the left or right of its trigger.
+ */
+using LogRedactionCharClass = std::bitset<256>;
+
+/**
+ * @struct LogRedactionRule
+ * @brief A redaction rule: a literal trigger, optionally extended by character classes.
+ *
+ * A match starts with an occurrence of the trigger. If a left or right class is set, the match is
+ * extended over all adjacent bytes in that class, and at least one such byte is required. The
+ * match is then replaced by the replacement text. With `keep_trigger`, the text up to and
+ * including the trigger is kept and only the right extension is replaced.
+ */
+struct LogRedactionRule {
+        QByteArray trigger;
+        QByteArray replacement;
+        LogRedactionCharClass left_class;
+        LogRedactionCharClass right_class;
+        bool keep_trigger = false;
+};
+
+/**
+ * @class LogRedactor
+ * @brief Scrubs sensitive data such as tokens, email addresses and file paths from log messages.
+ *
+ * All rule triggers are compiled into a single Aho-Corasick automaton with a dense transition
+ * table, so a message is scanned in one pass with one table lookup per byte, regardless of the
+ * number of rules. Matches are rewritten during the same pass. Messages without matches are
+ * returned unchanged without copying.
+ *
+ * A redactor is immutable after construction and can be used from any thread.
+ */
+class LogRedactor
+{
+    public:
+        /**
+         * @brief Constructs a LogRedactor object and compiles the rules.
+         *
+         * @param rules The redaction rules. Rules with an empty trigger are ignored.
+         */
+        explicit LogRedactor(QList<LogRedactionRule> rules = default_rules());
+
+        /**
+         * @brief Returns the message with all matches replaced.
+         *
+         * @param message The message to redact.
+         * @return The redacted message.
+         */
+        [[nodiscard]] auto redact(const QString& message) const -> QString;
+
+        /**
+         * @brief Redacts UTF-8 encoded text.
+         *
+         * @param text The text to redact.
+         * @param output Receives the redacted text if anything was replaced.
+         * @return True if anything was replaced, false otherwise.
+         */
+        auto redact_utf8(const QByteArray& text, QByteArray& output) const -> bool;
+
+        /**
+         * @brief Returns the rules of this redactor.
+         *
+         * @return The rules.
+         */
+        [[nodiscard]] auto get_rules() const -> const QList<LogRedactionRule>&;
+
+        /**
+         * @brief Returns the number of states of the compiled automaton.
+         *
+         * @return The number of states.
+         */
+        [[nodiscard]] auto get_state_count() const -> qsizetype;
+
+        /**
+         * @brief Returns rules for bearer tokens, credentials, email addresses and home paths.
+         *
+         * @return The default rules.
+         */
+        [[nodiscard]] static auto default_rules() -> QList<LogRedactionRule>;
+
+        /**
+         * @brief Creates a character class from ranges such as "A-Za-z0-9._-".
+         *
+         * @param ranges The characters and ranges. A '-' at the start or end is literal.
+         * @param non_ascii Whether all bytes of multi-byte UTF-8 sequences are included.
+         * @return The character class.
+         */
+        [[nodiscard]] static auto char_class(std::string_view ranges, bool non_ascii = false)
+            -> LogRedactionCharClass;
+
+        /**
+         * @brief Creates a character class of all bytes except the given ASCII characters.
+         *
+         * @param excluded The excluded characters.
+         * @return The character class.
+         */
+        [[nodiscard]] static auto char_class_except(std::string_view excluded)
+            -> LogRedactionCharClass;
+
+    private:
+        auto compile() -> void;
+
+    private:
+        QList<LogRedactionRule> m_rules;
+        std::vector<std::array<qint32, 256>> m_transitions;
+        // The rule of the longest trigger ending in each state, or -1
+        std::vector<qint32> m_state_rule;
+};
+}  // namespace QmlApp
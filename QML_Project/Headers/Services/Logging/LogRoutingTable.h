@@ -0,0 +1,131 @@
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QReadWriteLock>
+#include <QSharedPointer>
+#include <QStringList>
+#include <array>
+
+#include "Services/Logging/LogAppender.h"
+
+namespace QmlApp
+{
+/**
+ * @struct LogRoute
+ * @brief A routing rule that sends records of matching categories and levels to some appenders.
+ *
+ * The category pattern is either an exact category name, a prefix followed by '*' (e.g.
+ * "qt.qml.*"), or "*" for all categories. Appenders are referenced by name; "*" stands for all
+ * appenders of the logger.
+ */
+struct LogRoute {
+        QByteArray category;
+        QtMsgType minimum_level = QtDebugMsg;
+        QStringList appenders;
+};
+
+/**
+ * @class LogRoutingTable
+ * @brief Decides which appenders receive a record, based on its category and level.
+ *
+ * The appenders a record is sent to are the union of the appenders of all routes it matches. If
+ * it matches no route, it is sent to all appenders. Routes are resolved to appender bitmasks when
+ * the table is compiled, and the masks for each category are computed once and cached by the
+ * category name (a QByteArray) under a QReadWriteLock. Routing a record therefore takes the read
+ * lock and costs one hash lookup regardless of the number of routes; only the first record of a
+ * new category takes the write lock. Only the first 64 appenders can be routed; later ones
+ * receive every record.
+ *
+ * Routing is thread-safe; compiling the table is not and must not overlap with routing.
+ */
+class LogRoutingTable
+{
+    public:
+        static constexpr int kMaxRoutedAppenders = 64;
+
+        /**
+         * @brief Constructs an empty routing table that sends every record to all appenders.
+         */
+        LogRoutingTable() = default;
+
+        /**
+         * @brief Constructs a routing table with the given routes.
+         *
+         * @param routes The routes.
+         */
+        explicit LogRoutingTable(QList<LogRoute> routes);
+
+        /**
+         * @brief Replaces the routes of the table.
+         *
+         * The table has to be compiled again before the new routes take effect.
+         *
+         * @param routes The routes.
+         */
+        auto set_routes(QList<LogRoute> routes) -> void;
+
+        /**
+         * @brief Resolves the appender names of the routes against the given appenders.
+         *
+         * @param appenders The appenders of the logger; bit i of a mask stands for appender i.
+         */
+        auto compile(const QList<QSharedPointer<LogAppender>>& appenders) -> void;
+
+        /**
+         * @brief Returns the appenders a record of the given category and level is sent to.
+         *
+         * @param category The category of the record; nullptr is treated as "default".
+         * @param type The level of the record.
+         * @return The appender bitmask.
+         */
+        [[nodiscard]] auto route(const char* category, QtMsgType type) const -> quint64;
+
+        /**
+         * @brief Returns whether the table has no routes.
+         *
+         * @return True if every record is sent to all appenders, false otherwise.
+         */
+        [[nodiscard]] auto is_empty() const -> bool;
+
+        /**
+         * @brief Returns the routes of the table.
+         *
+         * @return The routes.
+         */
+        [[nodiscard]] auto get_routes() const -> const QList<LogRoute>&;
+
+        /**
+         * @brief Returns the number of categories whose masks are cached.
+         *
+         * @return The number of cached categories.
+         */
+        [[nodiscard]] auto get_cached_category_count() const -> qsizetype;
+
+    private:
+        // One mask per severity rank, from debug to fatal
+        using LevelMasks = std::array<quint64, 5>;
+
+        /**
+         * @struct CompiledRoute
+         * @brief A route with its category pattern split up and its appenders resolved.
+         */
+        struct CompiledRoute {
+                QByteArray pattern;
+                bool is_prefix = false;
+                int minimum_severity = 0;
+                quint64 mask = 0;
+        };
+
+        [[nodiscard]] auto compute_masks(const char* category) const -> LevelMasks;
+
+    private:
+        QList<LogRoute> m_routes;
+        QList<CompiledRoute> m_compiled_routes;
+        quint64 m_all_appenders = ~quint64{0};
+
+        mutable QReadWriteLock m_cache_lock;
+        mutable QHash<QByteArray, LevelMasks> m_cache;
+};
+}  // namespace QmlApp
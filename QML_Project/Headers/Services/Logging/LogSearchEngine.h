@@ -0,0 +1,150 @@
+#pragma once
+
+#include <QFutureWatcher>
+#include <QList>
+#include <QObject>
+#include <QRegularExpression>
+#include <QString>
+#include <QStringList>
+#include <QVariantList>
+#include <atomic>
+
+namespace QmlApp
+{
+/**
+ * @struct LogSearchMatch
+ * @brief A line of a log file that matched a search.
+ */
+struct LogSearchMatch {
+        QString file_path;
+        qint64 line_number = 0;
+        QString text;
+};
+
+/**
+ * @struct LogSearchTask
+ * @brief A unit of work of a search: a byte range of a log file, or a whole compressed segment.
+ */
+struct LogSearchTask {
+        int segment = 0;
+        QString file_path;
+        qint64 file_size = 0;
+        qint64 begin = 0;
+        qint64 end = 0;
+        bool compressed = false;
+};
+
+/**
+ * @struct LogSearchTaskResult
+ * @brief The matches of a task, with line numbers relative to the start of the task.
+ */
+struct LogSearchTaskResult {
+        QList<LogSearchMatch> matches;
+        qint64 line_count = 0;
+};
+
+/**
+ * @class LogSearchEngine
+ * @brief Searches log files, including rotated and gzip-compressed segments, in parallel.
+ *
+ * Plain files are split into chunks that are scanned with QtConcurrent on all cores; compressed
+ * segments are decompressed and scanned as a stream by a single worker each. Matches are
+ * reported in file and line order through `matchesFound()` as soon as all preceding chunks are
+ * done. If the pattern starts with a literal, lines are only decoded and matched against the
+ * regular expression where that literal occurs.
+ */
+class LogSearchEngine: public QObject
+{
+        Q_OBJECT
+        Q_PROPERTY(bool running READ isRunning NOTIFY runningChanged)
+
+    public:
+        /**
+         * @brief Constructs a LogSearchEngine object.
+         *
+         * @param parent The parent object.
+         */
+        explicit LogSearchEngine(QObject* parent = nullptr);
+
+        /**
+         * @brief Cancels a running search and waits for its workers.
+         */
+        ~LogSearchEngine() override;
+
+        // NOLINTBEGIN(modernize-use-trailing-return-type)
+        [[nodiscard]] bool isRunning() const;
+
+        Q_INVOKABLE bool search(const QStringList& file_paths, const QString& pattern,
+                                bool case_sensitive = true);
+        Q_INVOKABLE void cancel();
+        // NOLINTEND(modernize-use-trailing-return-type)
+
+        /**
+         * @brief Starts searching the given files, cancelling a running search first.
+         *
+         * @param file_paths The files to search, oldest segment first.
+         * @param pattern The regular expression each line is matched against.
+         * @return True if the search was started, false if the pattern is invalid.
+         */
+        auto start(const QStringList& file_paths, const QRegularExpression& pattern) -> bool;
+
+        /**
+         * @brief Blocks until the running search is finished and reports its remaining matches.
+         */
+        auto wait_for_finished() -> void;
+
+        /**
+         * @brief Sets the size of the chunks plain files are split into.
+         *
+         * @param chunk_size The chunk size in bytes.
+         */
+        auto set_chunk_size(qint64 chunk_size) -> void;
+
+        /**
+         * @brief Returns the given log file and its rotated segments, oldest first.
+         *
+         * @param log_file_path The path of the current log file, e.g. "QmlApp.log".
+         * @return The paths of the segments.
+         */
+        [[nodiscard]] static auto rotated_segments(const QString& log_file_path) -> QStringList;
+
+        /**
+         * @brief Returns the literal text every match of the pattern starts with.
+         *
+         * @param pattern The regular expression.
+         * @return The UTF-8 encoded literal prefix, or an empty byte array if there is none.
+         */
+        [[nodiscard]] static auto literal_prefix(const QRegularExpression& pattern) -> QByteArray;
+
+        /**
+         * @brief Converts matches to a list of maps with the keys "file", "line" and "text".
+         *
+         * @param matches The matches.
+         * @return The matches as a variant list for QML.
+         */
+        [[nodiscard]] static auto to_variant_list(const QList<LogSearchMatch>& matches)
+            -> QVariantList;
+
+    signals:
+        void matchesFound(const QVariantList& matches);
+        void finished(bool cancelled);
+        void runningChanged();
+
+    private:
+        auto deliver_ready_results() -> void;
+        auto finish() -> void;
+
+    private:
+        QFutureWatcher<LogSearchTaskResult> m_watcher;
+        QList<LogSearchTask> m_tasks;
+        QRegularExpression m_pattern;
+        QByteArray m_prefix;
+        std::atomic<bool> m_cancel = false;
+        bool m_running = false;
+        qint64 m_chunk_size;
+
+        qsizetype m_next_task = 0;
+        int m_current_segment = -1;
+        qint64 m_line_base = 0;
+};
+}  // namespace QmlApp
@@ -5,8 +5,13 @@
 #include <QList>
 #include <QSharedPointer>
 #include <QString>
+#include <memory>
 
 #include "Services/Logging/LogAppender.h"
+#include "Services/Logging/LogBatcher.h"
+#include "Services/Logging/LogMetrics.h"
+#include "Services/Logging/LogRedactor.h"
+#include "Services/Logging/LogRoutingTable.h"
 
 namespace QmlApp
 {
@@ -65,8 +70,104 @@ class Logger: public CommonLib::Singleton<Logger>
          */
         [[nodiscard]] auto get_log_level() const -> QtMsgType;
 
+        /**
+         * @brief Returns the registered log appenders.
+         *
+         * @return The list of registered log appenders.
+         */
+        [[nodiscard]] auto get_appenders() const -> QList<QSharedPointer<LogAppender>>;
+
+        /**
+         * @brief Enables batched dispatch of log messages.
+         *
+         * Messages are staged in per-thread buffers and dispatched to the appenders by a writer
+         * thread. Warnings and more severe messages trigger an immediate hand-off; fatal messages
+         * are dispatched synchronously. Must not be called while other threads are logging.
+         *
+         * @param max_batch_size The number of staged messages that triggers a hand-off.
+         * @param max_batch_delay_ms The maximum time in milliseconds a message stays staged.
+         */
+        void enable_batching(qsizetype max_batch_size = 64, int max_batch_delay_ms = 2);
+
+        /**
+         * @brief Disables batched dispatch after flushing all staged messages.
+         *
+         * Must not be called while other threads are logging.
+         */
+        void disable_batching();
+
+        /**
+         * @brief Returns whether batched dispatch is enabled.
+         *
+         * @return True if messages are staged for a writer thread, false otherwise.
+         */
+        [[nodiscard]] auto is_batching() const -> bool;
+
+        /**
+         * @brief Dispatches all staged messages and writes out the buffers of all appenders.
+         */
+        void flush();
+
+        /**
+         * @brief Returns the number of staged messages that were not yet dispatched.
+         *
+         * @return The number of pending messages, or 0 if batching is disabled.
+         */
+        [[nodiscard]] auto pending_record_count() const -> qsizetype;
+
+        /**
+         * @brief Sets the routes that decide which appenders receive a record.
+         *
+         * A record is sent to the union of the appenders of all routes matching its category and
+         * level, or to all appenders if no route matches.
+         *
+         * @param routes The routes; an empty list sends every record to all appenders.
+         */
+        void set_routes(const QList<LogRoute>& routes);
+
+        /**
+         * @brief Returns the routing table of the logger.
+         *
+         * @return The routing table.
+         */
+        [[nodiscard]] auto get_routing_table() const -> const LogRoutingTable&;
+
+        /**
+         * @brief Sets the redactor that scrubs sensitive data from messages before they are
+         * dispatched to the appenders.
+         *
+         * @param redactor The redactor, or nullptr to disable redaction.
+         */
+        void set_redactor(const QSharedPointer<const LogRedactor>& redactor);
+
+        /**
+         * @brief Returns the redactor of the logger.
+         *
+         * @return The redactor, or nullptr if redaction is disabled.
+         */
+        [[nodiscard]] auto get_redactor() const -> QSharedPointer<const LogRedactor>;
+
+        /**
+         * @brief Returns the metrics of the logger.
+         *
+         * The logger counts records by level, records discarded by its log level and the latency
+         * of dispatching a record to all appenders. Per-appender metrics are available through
+         * `LogAppender::get_metrics()`.
+         *
+         * @return The metrics of the logger.
+         */
+        [[nodiscard]] auto get_metrics() const -> const LogMetrics&;
+
+    private:
+        auto dispatch(const LogMessage& message, const QMessageLogContext& context) -> void;
+        auto dispatch_routed(const LogMessage& message, const QMessageLogContext& context) -> void;
+
     private:
         QList<QSharedPointer<LogAppender>> m_appenders;
         QtMsgType m_log_level = QtDebugMsg;
+        LogMetrics m_metrics;
+        QSharedPointer<const LogRedactor> m_redactor;
+        LogRoutingTable m_routing_table;
+        std::unique_ptr<LogBatcher> m_batcher;
 };
 }  // namespace QmlApp
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <QList>
+#include <QObject>
+#include <QPair>
+#include <QString>
+#include <QTimer>
+
+#include "Services/Logging/LogMetrics.h"
+
+namespace QmlApp
+{
+/**
+ * @class PrometheusMetricsWriter
+ * @brief Periodically writes the logging metrics to a text file in Prometheus exposition format.
+ *
+ * The file is replaced atomically on every write, so a node exporter textfile collector or any
+ * other scraper never sees a partially written file.
+ */
+class PrometheusMetricsWriter: public QObject
+{
+        Q_OBJECT
+
+    public:
+        /**
+         * @brief Constructs a PrometheusMetricsWriter object.
+         *
+         * @param parent The parent object.
+         */
+        explicit PrometheusMetricsWriter(QObject* parent = nullptr);
+        ~PrometheusMetricsWriter() override = default;
+
+        /**
+         * @brief Starts writing the metrics to the given file periodically.
+         *
+         * @param file_path The path of the file to write.
+         * @param interval_ms The interval between two writes in milliseconds.
+         */
+        auto start(const QString& file_path, int interval_ms = 10000) -> void;
+
+        /**
+         * @brief Stops writing the metrics periodically.
+         */
+        auto stop() -> void;
+
+        /**
+         * @brief Returns whether the metrics are currently written periodically.
+         *
+         * @return True if the writer is running, false otherwise.
+         */
+        [[nodiscard]] auto is_running() const -> bool;
+
+        /**
+         * @brief Writes the current metrics of the Logger and its appenders to the file.
+         *
+         * @return True if the file was written successfully, false otherwise.
+         */
+        auto write_now() -> bool;
+
+        /**
+         * @brief Formats the given snapshots in Prometheus exposition format.
+         *
+         * @param logger_snapshot The metrics snapshot of the logger.
+         * @param appender_snapshots The name and metrics snapshot of each appender.
+         * @return The metrics in Prometheus exposition format.
+         */
+        [[nodiscard]] static auto format_exposition(
+            const LogMetricsSnapshot& logger_snapshot,
+            const QList<QPair<QString, LogMetricsSnapshot>>& appender_snapshots) -> QString;
+
+        /**
+         * @brief Collects the metrics of the Logger and its appenders in exposition format.
+         *
+         * @return The metrics in Prometheus exposition format.
+         */
+        [[nodiscard]] static auto collect_exposition() -> QString;
+
+    private:
+        QTimer m_timer;
+        QString m_file_path;
+};
+}  // namespace QmlApp
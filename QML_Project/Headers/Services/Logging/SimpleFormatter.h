@@ -14,7 +14,7 @@ namespace QmlApp
  * It formats log messages by including the message type, current date and time,
  * the message itself, and the file, line, and function where the log was generated.
  */
-class SimpleFormatter: public LogFormatter
+class SimpleFormatter final: public LogFormatter
 {
     public:
         /**
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <QList>
+#include <QStringList>
+
+namespace QmlApp
+{
+/**
+ * @class StackTrace
+ * @brief Captures raw call stacks for later, offline symbolisation.
+ *
+ * Only the return addresses are captured, which takes a few microseconds, instead of resolving
+ * them to function names at runtime. The addresses are written to the logs together with the
+ * load address of the application binary, and Scripts/symbolize_stack_trace.sh resolves them
+ * against the binary's debug info.
+ *
+ * Capturing uses backtrace() where <execinfo.h> is available and CaptureStackBackTrace() on
+ * Windows. On other platforms no frames are captured.
+ */
+class StackTrace
+{
+    public:
+        static constexpr int kMaxFrames = 32;
+
+        /**
+         * @brief Captures the return addresses of the calling thread's stack.
+         *
+         * @param skip_frames The number of innermost frames to leave out, not counting this
+         *                    function itself.
+         * @return The return addresses, innermost first, at most kMaxFrames of them.
+         */
+        [[nodiscard]] static auto capture(int skip_frames = 0) -> QList<quintptr>;
+
+        /**
+         * @brief Returns the address the application binary is loaded at.
+         *
+         * @return The load address, or 0 if it cannot be determined.
+         */
+        [[nodiscard]] static auto image_base() -> quintptr;
+
+        /**
+         * @brief Returns whether stack traces can be captured on this platform.
+         *
+         * @return True if capture() returns frames, false otherwise.
+         */
+        [[nodiscard]] static auto is_supported() -> bool;
+
+        /**
+         * @brief Formats an address as a hexadecimal string with a "0x" prefix.
+         *
+         * @param address The address.
+         * @return The formatted address.
+         */
+        [[nodiscard]] static auto to_hex(quintptr address) -> QString;
+
+        /**
+         * @brief Formats addresses as hexadecimal strings with a "0x" prefix.
+         *
+         * @param frames The addresses.
+         * @return The formatted addresses.
+         */
+        [[nodiscard]] static auto to_hex(const QList<quintptr>& frames) -> QStringList;
+};
+}  // namespace QmlApp
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <QString>
+#include <utility>
+
+#include "Services/Logging/LogAppender.h"
+
+namespace QmlApp
+{
+/**
+ * @class StaticAppender
+ * @brief A log appender whose formatter and output are composed at compile time.
+ *
+ * A regular appender calls its formatter through a QSharedPointer and a virtual function. Here
+ * the formatter and the sink are members of known type, so the only virtual call per record is
+ * the one into the appender; formatting and writing can be inlined into it.
+ *
+ * The Formatter needs a `format(const LogMessage&, const QMessageLogContext&) -> QString`
+ * function. The Sink needs `write(const QString&, QtMsgType) -> qsizetype` returning the number of
+ * bytes written, `flush()`, `emergency_flush()` and a `kName` constant that names the appender.
+ * The formatter set with set_formatter() is not used.
+ *
+ * @tparam Formatter The formatter type, e.g. SimpleFormatter.
+ * @tparam Sink The output type, e.g. ConsoleSink or FileSink.
+ */
+template <typename Formatter, typename Sink>
+class StaticAppender final: public LogAppender
+{
+    public:
+        /**
+         * @brief Constructs a StaticAppender object, passing the arguments to the sink.
+         *
+         * @param sink_args The arguments of the sink's constructor.
+         */
+        template <typename... SinkArgs>
+        explicit StaticAppender(SinkArgs&&... sink_args)
+            : m_sink(std::forward<SinkArgs>(sink_args)...)
+        {
+            m_name = QString::fromLatin1(Sink::kName);
+        }
+
+        /**
+         * @brief Returns the formatter.
+         *
+         * @return The formatter.
+         */
+        [[nodiscard]] auto get_static_formatter() -> Formatter&
+        {
+            return m_static_formatter;
+        }
+
+        /**
+         * @brief Returns the sink.
+         *
+         * @return The sink.
+         */
+        [[nodiscard]] auto get_sink() -> Sink&
+        {
+            return m_sink;
+        }
+
+        /**
+         * @brief Writes out the data buffered by the sink.
+         */
+        auto flush() -> void override
+        {
+            m_sink.flush();
+        }
+
+        /**
+         * @brief Writes out the data buffered by the sink from a crash signal handler.
+         */
+        auto emergency_flush() -> void override
+        {
+            m_sink.emergency_flush();
+        }
+
+    private:
+        /**
+         * @brief Formats the log message and writes it to the sink.
+         *
+         * @param message The log message to append.
+         * @param context The context of the log message.
+         */
+        auto internal_append(const LogMessage& message, const QMessageLogContext& context)
+            -> void override
+        {
+            qsizetype written_bytes =
+                m_sink.write(m_static_formatter.format(message, context), message.get_type());
+            m_metrics.record_bytes(static_cast<quint64>(written_bytes));
+        }
+
+    private:
+        Formatter m_static_formatter;
+        Sink m_sink;
+};
+}  // namespace QmlApp
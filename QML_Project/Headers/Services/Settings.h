@@ -1,10 +1,21 @@
 #pragma once
 
+#include <QHash>
+#include <QList>
 #include <QObject>
+#include <QPair>
+#include <QReadWriteLock>
+#include <QSet>
 #include <QSettings>
+#include <atomic>
+#include <memory>
 
 namespace QmlApp
 {
+class BinarySettingsFile;
+
+using SettingsSnapshot = QList<QPair<QString, QVariant>>;
+
 class Settings: public QObject
 {
         Q_OBJECT
@@ -16,8 +27,18 @@ class Settings: public QObject
         // NOLINTBEGIN(modernize-use-trailing-return-type)
         [[nodiscard]] Q_INVOKABLE QVariant
         getValue(const QString& key, const QVariant& default_value = QVariant()) const;
-        [[nodiscard]] Q_INVOKABLE QVariant getValue(const QString& group, const QString& key,
-                                                    const QVariant& default_value = QVariant());
+        [[nodiscard]] Q_INVOKABLE QVariant
+        getValue(const QString& group, const QString& key,
+                 const QVariant& default_value = QVariant()) const;
+
+        [[nodiscard]] Q_INVOKABLE int getInt(const QString& group, const QString& key,
+                                             int default_value = 0) const;
+        [[nodiscard]] Q_INVOKABLE bool getBool(const QString& group, const QString& key,
+                                               bool default_value = false) const;
+        [[nodiscard]] Q_INVOKABLE double getDouble(const QString& group, const QString& key,
+                                                   double default_value = 0.0) const;
+        [[nodiscard]] Q_INVOKABLE QString getString(const QString& group, const QString& key,
+                                                    const QString& default_value = QString()) const;
 
         Q_INVOKABLE void setValue(const QString& key, const QVariant& value);
         Q_INVOKABLE void setValue(const QString& group, const QString& key, const QVariant& value);
@@ -27,8 +48,8 @@ class Settings: public QObject
         [[nodiscard]] Q_INVOKABLE QStringList childKeys(const QString& group);
         [[nodiscard]] Q_INVOKABLE QStringList allKeys() const;
 
-        [[nodiscard]] Q_INVOKABLE bool contains(const QString& key);
-        [[nodiscard]] Q_INVOKABLE bool contains(const QString& group, const QString& key);
+        [[nodiscard]] Q_INVOKABLE bool contains(const QString& key) const;
+        [[nodiscard]] Q_INVOKABLE bool contains(const QString& group, const QString& key) const;
 
         Q_INVOKABLE void loadFromFile(const QString& file_path,
                                       QSettings::Format format = QSettings::IniFormat);
@@ -38,10 +59,52 @@ class Settings: public QObject
         Q_INVOKABLE void clear();
         // NOLINTEND(modernize-use-trailing-return-type)
 
+        [[nodiscard]] auto snapshot() const -> SettingsSnapshot;
+
+        [[nodiscard]] auto get_cache_hit_count() const -> qint64;
+        [[nodiscard]] auto get_cache_miss_count() const -> qint64;
+        [[nodiscard]] auto get_unsaved_key_count() const -> qsizetype;
+        [[nodiscard]] auto get_last_save_key_count() const -> qsizetype;
+
+        static auto read_snapshot(const QSettings& source) -> SettingsSnapshot;
+        static auto write_snapshot(const SettingsSnapshot& snapshot, QSettings& destination)
+            -> void;
+
+    signals:
+        void settingsChanged();
+
     private:
-        void copy_settings(QSettings& source, QSettings& destination);
+        struct CachedValue {
+                QVariant value;
+                bool exists = false;
+        };
+
+        // State shared by all Settings objects on the same store, guarded by its lock
+        struct Store {
+                QReadWriteLock lock;
+                QHash<QString, CachedValue> cache;
+                QSet<QString> unsaved_keys;
+                QString file_path;
+                QSettings::Format file_format = QSettings::IniFormat;
+                // Mapped binary settings file below the native store, decoded on first access
+                std::shared_ptr<BinarySettingsFile> base_file;
+        };
+
+        [[nodiscard]] auto cached_value(const QString& group, const QString& key) const
+            -> CachedValue;
+        auto invalidate(const QString& group, const QString& key) -> void;
+        auto mark_unsaved(const QString& group, const QString& key) -> void;
+        auto append_base_children(const QString& group, bool groups, QStringList& result) const
+            -> void;
+        static auto key_path(const QString& group, const QString& key) -> QString;
+        static auto cache_key(const QString& group, const QString& key) -> QString;
+        static auto shared_store(const QString& name) -> std::shared_ptr<Store>;
 
     private:
         QSettings m_settings;
+        std::shared_ptr<Store> m_store;
+        mutable std::atomic<qint64> m_cache_hits = 0;
+        mutable std::atomic<qint64> m_cache_misses = 0;
+        qsizetype m_last_save_key_count = 0;
 };
 }  // namespace QmlApp
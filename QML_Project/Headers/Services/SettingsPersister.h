@@ -0,0 +1,44 @@
+#pragma once
+
+#include <QObject>
+#include <QString>
+#include <QThreadPool>
+#include <QTimer>
+#include <atomic>
+
+#include "Services/Settings.h"
+
+namespace QmlApp
+{
+class SettingsPersister: public QObject
+{
+        Q_OBJECT
+
+    public:
+        explicit SettingsPersister(Settings* settings, QString file_path,
+                                   QObject* parent = nullptr);
+        ~SettingsPersister() override;
+
+        auto set_delays(int idle_delay_ms, int max_delay_ms) -> void;
+        [[nodiscard]] auto get_file_path() const -> QString;
+        [[nodiscard]] auto is_dirty() const -> bool;
+        [[nodiscard]] auto get_write_count() const -> int;
+
+        auto mark_dirty() -> void;
+        auto flush() -> void;
+        auto save_now() -> bool;
+        auto wait_for_pending_writes() -> void;
+
+    signals:
+        void saved(bool success);
+
+    private:
+        Settings* m_settings;
+        QString m_file_path;
+        QTimer m_idle_timer;
+        QTimer m_max_delay_timer;
+        QThreadPool m_write_pool;
+        bool m_dirty = false;
+        std::atomic<int> m_write_count = 0;
+};
+}  // namespace QmlApp
@@ -0,0 +1,447 @@
+/**
+ * @file LogListModel.cpp
+ * @brief This file contains the implementation of the LogListModel class.
+ */
+
+#include "Models/LogListModel.h"
+
+#include <QDateTime>
+#include <algorithm>
+
+#include "Services/Logging/LogMetrics.h"
+
+namespace QmlApp
+{
+namespace
+{
+// Roughly one display frame at 60 Hz.
+constexpr int kFrameIntervalMs = 16;
+}  // namespace
+
+/**
+ * @brief Constructs a LogListModel object with the given parent and capacity.
+ *
+ * The model starts polling its appender once per frame. Register the appender returned by
+ * `get_appender()` with the Logger to feed the model.
+ *
+ * @param parent The parent object.
+ * @param capacity The maximum number of records the model retains.
+ */
+LogListModel::LogListModel(QObject* parent, int capacity)
+    : QAbstractListModel(parent),
+      m_appender(QSharedPointer<LogModelAppender>::create(qMax(capacity, 1))),
+      m_capacity(qMax(capacity, 1))
+{
+    m_flush_timer.setInterval(kFrameIntervalMs);
+    connect(&m_flush_timer, &QTimer::timeout, this, &LogListModel::flushPending);
+    m_flush_timer.start();
+}
+
+/**
+ * @brief Returns the number of visible records.
+ *
+ * @param parent The parent index. Only the invalid root index has rows.
+ * @return The number of rows.
+ */
+auto LogListModel::rowCount(const QModelIndex& parent) const -> int
+{
+    return parent.isValid() ? 0 : static_cast<int>(m_visible.size());
+}
+
+/**
+ * @brief Returns the data for the specified index and role.
+ *
+ * @param index The index of the item.
+ * @param role The role of the data.
+ * @return The data for the index and role.
+ */
+auto LogListModel::data(const QModelIndex& index, int role) const -> QVariant
+{
+    QVariant result;
+
+    if (index.isValid() && index.row() >= 0 && index.row() < static_cast<int>(m_visible.size()))
+    {
+        const LogRecord& record = record_at(m_visible[index.row()]);
+
+        switch (role)
+        {
+        case Qt::DisplayRole:
+        case MessageRole:
+            result = record.message;
+            break;
+        case LevelRole:
+            result = static_cast<int>(record.type);
+            break;
+        case LevelNameRole:
+            result = LogMetrics::level_name(record.type);
+            break;
+        case CategoryRole:
+            result = QString::fromUtf8(record.category);
+            break;
+        case TimestampRole:
+            result = QDateTime::fromMSecsSinceEpoch(record.msecs_since_epoch());
+            break;
+        case SequenceRole:
+            result = record.sequence;
+            break;
+        default:
+            break;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the role names for the model
+ *
+ * @return The role names for the model
+ */
+auto LogListModel::roleNames() const -> QHash<int, QByteArray>
+{
+    QHash<int, QByteArray> names;
+    names[LevelRole] = "Level";
+    names[LevelNameRole] = "LevelName";
+    names[CategoryRole] = "Category";
+    names[MessageRole] = "Message";
+    names[TimestampRole] = "Timestamp";
+    names[SequenceRole] = "Sequence";
+    names[Qt::DisplayRole] = "Display";
+
+    return names;
+}
+
+// NOLINTBEGIN(modernize-use-trailing-return-type)
+
+/**
+ * @brief Returns the maximum number of records the model retains.
+ *
+ * @return The capacity of the model.
+ */
+int LogListModel::getCapacity() const
+{
+    return m_capacity;
+}
+
+/**
+ * @brief Sets the maximum number of records the model retains.
+ *
+ * The newest records that fit into the new capacity are kept. This resets the model.
+ *
+ * @param capacity The new capacity.
+ */
+void LogListModel::setCapacity(int capacity)
+{
+    capacity = qMax(capacity, 1);
+
+    if (capacity != m_capacity)
+    {
+        beginResetModel();
+
+        quint64 keep = qMin<quint64>(m_next_position - m_first_position, capacity);
+        QVector<LogRecord> ring;
+        ring.reserve(static_cast<qsizetype>(keep));
+
+        for (quint64 position = m_next_position - keep; position < m_next_position; position++)
+        {
+            ring.append(record_at(position));
+        }
+
+        m_ring = std::move(ring);
+        m_capacity = capacity;
+        m_first_position = 0;
+        m_next_position = keep;
+        m_appender->set_max_pending(capacity);
+
+        m_visible.clear();
+
+        for (quint64 position = m_first_position; position < m_next_position; position++)
+        {
+            if (matches(record_at(position)))
+            {
+                m_visible.push_back(position);
+            }
+        }
+
+        endResetModel();
+
+        emit capacityChanged();
+        emit retainedCountChanged();
+    }
+}
+
+/**
+ * @brief Returns the number of retained records, including the ones hidden by the filters.
+ *
+ * @return The number of retained records.
+ */
+int LogListModel::getRetainedCount() const
+{
+    return static_cast<int>(m_next_position - m_first_position);
+}
+
+/**
+ * @brief Returns the minimum severity of visible records.
+ *
+ * @return The severity rank as returned by `severity()`.
+ */
+int LogListModel::getMinimumLevel() const
+{
+    return m_minimum_level;
+}
+
+/**
+ * @brief Sets the minimum severity of visible records.
+ *
+ * @param level The severity rank, from 0 (debug) to 4 (fatal).
+ */
+void LogListModel::setMinimumLevel(int level)
+{
+    if (level != m_minimum_level)
+    {
+        bool narrowing = level > m_minimum_level;
+        m_minimum_level = level;
+        apply_filter(narrowing);
+    }
+}
+
+/**
+ * @brief Returns the category prefix visible records must start with.
+ *
+ * @return The category filter, or an empty string if records of all categories are visible.
+ */
+QString LogListModel::getCategoryFilter() const
+{
+    return m_category_filter;
+}
+
+/**
+ * @brief Sets the category prefix visible records must start with.
+ *
+ * @param category The category prefix, e.g. "qt.qml".
+ */
+void LogListModel::setCategoryFilter(const QString& category)
+{
+    if (category != m_category_filter)
+    {
+        bool narrowing = category.startsWith(m_category_filter);
+        m_category_filter = category;
+        m_category_filter_utf8 = category.toUtf8();
+        apply_filter(narrowing);
+    }
+}
+
+/**
+ * @brief Returns the text visible records must contain.
+ *
+ * @return The text filter, or an empty string if no text filter is set.
+ */
+QString LogListModel::getTextFilter() const
+{
+    return m_text_filter;
+}
+
+/**
+ * @brief Sets the text visible records must contain, ignoring case.
+ *
+ * @param text The text to search for in the message.
+ */
+void LogListModel::setTextFilter(const QString& text)
+{
+    if (text != m_text_filter)
+    {
+        bool narrowing = text.contains(m_text_filter, Qt::CaseInsensitive);
+        m_text_filter = text;
+        apply_filter(narrowing);
+    }
+}
+
+/**
+ * @brief Removes all records from the model, including pending ones.
+ */
+void LogListModel::clear()
+{
+    beginResetModel();
+    (void)m_appender->take_pending();
+    m_ring.clear();
+    m_visible.clear();
+    m_first_position = 0;
+    m_next_position = 0;
+    endResetModel();
+
+    emit retainedCountChanged();
+}
+
+/**
+ * @brief Moves all records pending in the appender into the model.
+ *
+ * This is called once per frame by the model itself, but can be called directly to update the
+ * model immediately.
+ */
+void LogListModel::flushPending()
+{
+    QList<LogRecord> records = m_appender->take_pending();
+
+    if (!records.isEmpty())
+    {
+        append_records(std::move(records));
+    }
+}
+
+// NOLINTEND(modernize-use-trailing-return-type)
+
+/**
+ * @brief Returns the appender that feeds this model.
+ *
+ * @return The appender of the model.
+ */
+auto LogListModel::get_appender() const -> QSharedPointer<LogModelAppender>
+{
+    return m_appender;
+}
+
+/**
+ * @brief Appends a batch of records to the model.
+ *
+ * Records that no longer fit into the ring evict the oldest ones. Evicted visible rows are removed
+ * from the front with one `beginRemoveRows`/`endRemoveRows` pair, and the new visible records are
+ * inserted at the end with one `beginInsertRows`/`endInsertRows` pair. Only the new records are
+ * checked against the filters.
+ *
+ * @param records The records to append, in logging order.
+ */
+auto LogListModel::append_records(QList<LogRecord> records) -> void
+{
+    if (records.isEmpty())
+    {
+        return;
+    }
+
+    // Only the newest `capacity` records of the batch can survive
+    qsizetype skip = qMax<qsizetype>(records.size() - m_capacity, 0);
+    auto incoming = static_cast<quint64>(records.size() - skip);
+    quint64 retained = m_next_position - m_first_position;
+    quint64 capacity = static_cast<quint64>(m_capacity);
+
+    if (retained + incoming > capacity)
+    {
+        quint64 new_first_position = m_first_position + (retained + incoming - capacity);
+        auto evicted_end = std::lower_bound(m_visible.begin(), m_visible.end(), new_first_position);
+        auto evicted_rows = static_cast<int>(std::distance(m_visible.begin(), evicted_end));
+
+        if (evicted_rows > 0)
+        {
+            beginRemoveRows(QModelIndex(), 0, evicted_rows - 1);
+            m_visible.erase(m_visible.begin(), evicted_end);
+            endRemoveRows();
+        }
+
+        m_first_position = new_first_position;
+    }
+
+    QVector<quint64> added;
+
+    for (qsizetype i = skip; i < records.size(); i++)
+    {
+        quint64 position = m_next_position++;
+        auto slot = static_cast<qsizetype>(position % capacity);
+
+        if (slot < m_ring.size())
+        {
+            m_ring[slot] = std::move(records[i]);
+        }
+        else
+        {
+            m_ring.append(std::move(records[i]));
+        }
+
+        if (matches(m_ring[slot]))
+        {
+            added.append(position);
+        }
+    }
+
+    if (!added.isEmpty())
+    {
+        auto first_row = static_cast<int>(m_visible.size());
+        beginInsertRows(QModelIndex(), first_row, first_row + static_cast<int>(added.size()) - 1);
+        m_visible.insert(m_visible.end(), added.cbegin(), added.cend());
+        endInsertRows();
+    }
+
+    emit retainedCountChanged();
+}
+
+/**
+ * @brief Returns the severity rank of a log level, from 0 (debug) to 4 (fatal).
+ *
+ * Forwards to LogMessage::severity(), which the routing table uses as well.
+ *
+ * @param type The log level.
+ * @return The severity rank.
+ */
+auto LogListModel::severity(QtMsgType type) -> int
+{
+    return LogMessage::severity(type);
+}
+
+/**
+ * @brief Returns the retained record at the given ring position.
+ *
+ * @param position The absolute position of the record.
+ * @return The record.
+ */
+auto LogListModel::record_at(quint64 position) const -> const LogRecord&
+{
+    return m_ring[static_cast<qsizetype>(position % static_cast<quint64>(m_capacity))];
+}
+
+/**
+ * @brief Checks whether the record passes the level, category and text filters.
+ *
+ * @param record The record to check.
+ * @return True if the record is visible, false otherwise.
+ */
+auto LogListModel::matches(const LogRecord& record) const -> bool
+{
+    return severity(record.type) >= m_minimum_level &&
+           (m_category_filter_utf8.isEmpty() ||
+            record.category.startsWith(m_category_filter_utf8)) &&
+           (m_text_filter.isEmpty() || record.message.contains(m_text_filter, Qt::CaseInsensitive));
+}
+
+/**
+ * @brief Re-evaluates the visible rows after a filter change.
+ *
+ * If the new filter is at least as strict as the old one, only the currently visible rows are
+ * checked. Otherwise all retained records are checked again.
+ *
+ * @param narrowing Whether the new filter only hides records the old one showed.
+ */
+auto LogListModel::apply_filter(bool narrowing) -> void
+{
+    beginResetModel();
+
+    if (narrowing)
+    {
+        std::erase_if(m_visible,
+                      [this](quint64 position) { return !matches(record_at(position)); });
+    }
+    else
+    {
+        m_visible.clear();
+
+        for (quint64 position = m_first_position; position < m_next_position; position++)
+        {
+            if (matches(record_at(position)))
+            {
+                m_visible.push_back(position);
+            }
+        }
+    }
+
+    endResetModel();
+
+    emit filterChanged();
+}
+}  // namespace QmlApp
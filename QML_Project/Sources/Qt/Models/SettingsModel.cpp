@@ -5,6 +5,8 @@
 
 #include "Models/SettingsModel.h"
 
+#include <utility>
+
 namespace QmlApp
 {
 /**
@@ -21,16 +23,18 @@ SettingsModel::SettingsModel(Settings* settings, QObject* parent)
 {
     Q_ASSERT(settings != nullptr);
 
-    m_root_node = new SettingsNode("Root", "");
+    m_root_node = m_arena->create("Root", "");
     load_settings_from_app_settings();
 }
 
 /**
  * @brief Destroys the SettingsModel object and frees any allocated memory.
+ *
+ * All nodes are released together with the arena they were created in.
  */
 SettingsModel::~SettingsModel()
 {
-    delete m_root_node;
+    m_arena->release();
 }
 
 // NOLINTBEGIN(modernize-use-trailing-return-type)
@@ -120,6 +124,51 @@ auto SettingsModel::rowCount(const QModelIndex& parent) const -> int
     return parent_node->child_count();
 }
 
+/**
+ * @brief Checks if the specified parent index has children.
+ *
+ * Groups that have not been populated yet always have children, since QSettings only knows
+ * groups that contain keys.
+ *
+ * @param parent The parent index.
+ * @return True if the parent has or will have children, false otherwise.
+ */
+auto SettingsModel::hasChildren(const QModelIndex& parent) const -> bool
+{
+    SettingsNode* parent_node = parent.isValid()
+                                    ? static_cast<SettingsNode*>(parent.internalPointer())
+                                    : m_root_node;
+
+    return !parent_node->is_populated() || parent_node->has_children();
+}
+
+/**
+ * @brief Checks if the children of the specified parent index can be fetched.
+ *
+ * @param parent The parent index.
+ * @return True if the parent is a group that has not been populated yet, false otherwise.
+ */
+auto SettingsModel::canFetchMore(const QModelIndex& parent) const -> bool
+{
+    return parent.isValid() &&
+           !static_cast<SettingsNode*>(parent.internalPointer())->is_populated();
+}
+
+/**
+ * @brief Creates the children of the specified parent index from the Settings object.
+ *
+ * Views call this when a group is expanded for the first time.
+ *
+ * @param parent The parent index.
+ */
+auto SettingsModel::fetchMore(const QModelIndex& parent) -> void
+{
+    if (canFetchMore(parent))
+    {
+        populate(static_cast<SettingsNode*>(parent.internalPointer()));
+    }
+}
+
 /**
  * @brief Returns the number of columns under the specified parent index.
  *
@@ -203,18 +252,7 @@ auto SettingsModel::setData(const QModelIndex& index, const QVariant& value, int
     {
         auto node = static_cast<SettingsNode*>(index.internalPointer());
         node->set_data(index.column(), value);
-
-        if (m_sync_with_app_settings)
-        {
-            QStringList groups = node->get_full_group().split('/');
-            groups.takeFirst();  // root
-            QString group = groups.takeFirst();
-            QString key =
-                (groups.size() > 1) ? groups.join("/") + "/" + node->get_key() : node->get_key();
-            QVariant value = node->get_value();
-            m_settings->setValue(group, key, value);
-        }
-
+        write_node_to_settings(node);
         emit dataChanged(index, index, {role});
     }
 
@@ -274,6 +312,11 @@ QVariant SettingsModel::getValue(const QString& key, const QString& group,
  * If the group does not exist, it will be created. If the key does not exist, it will be added.
  * If the key already exists, its value will be updated.
  *
+ * The group and every subgroup of the key are looked up among the children of the previous path
+ * segment only, so each segment takes constant time and same-named groups elsewhere in the tree
+ * are never matched. Keys below a group that has not been expanded yet are only written to the
+ * Settings object. An empty group places the key below the root, without a group.
+ *
  * @param key The key of the value.
  * @param value The value to set.
  * @param group The group of the value.
@@ -281,117 +324,180 @@ QVariant SettingsModel::getValue(const QString& key, const QString& group,
 void SettingsModel::setValue(const QString& key, const QVariant& value, const QString& group)
 {
     QStringList key_parts = key.split('/');
-    QString current_group_name = group;
-    SettingsNode* parent_node = m_root_node;
-    SettingsNode* group_node = parent_node->find_node_by_group(current_group_name);
-    SettingsNode* sub_group_node = nullptr;
-
-    // If the root group node does not exist, create it.
-    if (group_node == nullptr)
-    {
-        group_node = create_node(current_group_name, "", QVariant(""), parent_node);
-    }
+    SettingsNode* group_node =
+        group.isEmpty() ? m_root_node : find_or_create_group_node(m_root_node, group);
 
-    // Create or update the key if the group is a root group
-    if (key_parts.size() == 1)
+    // Create subgroups if they do not exist
+    for (int i = 0; i < key_parts.size() - 1; i++)
     {
-        create_or_update_key_node(key, value, group_node);
+        group_node = find_or_create_group_node(group_node, key_parts[i]);
     }
-    else
-    {
-        // Create subgroups if they do not exist
-        for (int i = 0; i < key_parts.size() - 1; i++)
-        {
-            current_group_name = key_parts[i];
-            sub_group_node = group_node->find_node_by_group(current_group_name);
 
-            // If the subgroup does not exist, create it
-            if (sub_group_node == nullptr)
-            {
-                sub_group_node = create_node(current_group_name, "", QVariant(""), group_node);
-            }
-
-            group_node = sub_group_node;
-        }
-
-        // Create or update the key in the last subgroup
-        create_or_update_key_node(key_parts.last(), value, group_node);
-    }
-
-    if (m_sync_with_app_settings)
-    {
-        m_settings->setValue(group, key, value);
-    }
+    // Create or update the key in the last subgroup
+    create_or_update_key_node(key_parts.last(), value, group_node);
+    m_settings->setValue(group, key, value);
 }
 
 /**
  * @brief Loads the settings from the specified file.
  *
  * This function clears the existing settings and loads the settings from the specified file.
+ * The node tree is replaced in a single model reset.
  *
  * @param file_path The file path of the settings file to load.
+ * @param format The format of the settings file.
  */
-void SettingsModel::loadFromFile(const QString& file_path)
+void SettingsModel::loadFromFile(const QString& file_path, QSettings::Format format)
 {
-    reset();
-    m_settings->loadFromFile(file_path);
+    m_settings->loadFromFile(file_path, format);
     load_settings_from_app_settings();
 }
 
 /**
  * @brief Saves the settings to the specified file.
  *
- * This function saves the current settings to the specified file.
+ * This function saves the current settings to the specified file. Every change made through the
+ * model has already been written to the Settings object, which keeps track of the keys changed
+ * since the last save. Saving again to the same file therefore only writes those keys, including
+ * keys below groups that have not been expanded and thus have no nodes.
  *
  * @param file_path The file path of the settings file to save.
+ * @param format The format of the settings file.
+ */
+void SettingsModel::saveToFile(const QString& file_path, QSettings::Format format)
+{
+    m_settings->saveToFile(file_path, format);
+}
+
+// NOLINTEND(modernize-use-trailing-return-type)
+
+/**
+ * @brief Loads the settings from the Settings object.
+ *
+ * Only the top-level groups are created; their contents are read from the Settings object when
+ * they are first expanded, see fetchMore(). The new nodes are created in a new arena and replace
+ * the current tree in a single model reset; the old tree is then freed with its arena. Nothing is
+ * written back to the Settings object.
  */
-void SettingsModel::saveToFile(const QString& file_path)
+auto SettingsModel::load_settings_from_app_settings() -> void
 {
-    if (!m_sync_with_app_settings)
+    auto arena = std::make_unique<SettingsNodeArena>();
+    SettingsNode* root_node = build_tree_from_app_settings(*arena);
+
+    beginResetModel();
+    std::swap(m_arena, arena);
+    m_root_node = root_node;
+    endResetModel();
+
+    arena->release();
+}
+
+/**
+ * @brief Builds a node tree with the top-level groups and keys of the Settings object.
+ *
+ * Keys without a group become key nodes below the root, so they are written back without a group
+ * and are not mixed up with the keys of a group named "General". The group nodes are not
+ * populated yet. The tree is not part of the model, so no signals are emitted.
+ *
+ * @param arena The arena the nodes are created in.
+ * @return The root node of the new tree. It belongs to the arena.
+ */
+auto SettingsModel::build_tree_from_app_settings(SettingsNodeArena& arena) const -> SettingsNode*
+{
+    SettingsNode* root_node = arena.create("Root", "");
+
+    for (const QString& group: m_settings->childGroups())
     {
-        // Sync the settings with the Settings object before saving
-        QList<SettingsNode*> leaf_nodes = get_leaf_nodes();
+        SettingsNode* group_node = arena.create(group, "", QVariant(""), root_node);
+        group_node->set_populated(false);
+        root_node->append_child(group_node);
+    }
 
-        for (const SettingsNode* node: leaf_nodes)
-        {
-            QStringList groups = node->get_full_group().split('/');
-            qDebug() << "Groups: " << groups;
-            groups.takeFirst();  // root
-            QString group = groups.takeFirst();
-            QString key =
-                (groups.size() > 1) ? groups.join("/") + "/" + node->get_key() : node->get_key();
-            QVariant value = node->get_value();
-            m_settings->setValue(
-                group, key, value);  // todo: Alternatively create a new Settings object to save
-                                     // the settings directly ( avoids saving the settings twice )
-        }
+    for (const QString& key: m_settings->childKeys(""))
+    {
+        root_node->append_child(arena.create("", key, m_settings->getValue(key), root_node));
     }
 
-    m_settings->saveToFile(file_path);
+    return root_node;
 }
 
-// NOLINTEND(modernize-use-trailing-return-type)
+/**
+ * @brief Creates the child nodes of a group node from the Settings object.
+ *
+ * The child groups are created unpopulated, so only one level is read. All children are created
+ * in a row, so they lie next to each other in the arena.
+ *
+ * @param group_node The group node.
+ */
+auto SettingsModel::populate(SettingsNode* group_node) -> void
+{
+    QString path = settings_path(group_node);
+    QList<SettingsNode*> children;
+
+    for (const QString& group: m_settings->childGroups(path))
+    {
+        SettingsNode* child = m_arena->create(group, "", QVariant(""), group_node);
+        child->set_populated(false);
+        children.append(child);
+    }
+
+    for (const QString& key: m_settings->childKeys(path))
+    {
+        children.append(m_arena->create("", key, m_settings->getValue(path, key), group_node));
+    }
+
+    group_node->set_populated(true);
+
+    if (!children.isEmpty())
+    {
+        int first = group_node->child_count();
+        beginInsertRows(index_of_node(group_node), first,
+                        first + static_cast<int>(children.size()) - 1);
+
+        for (SettingsNode* child: children)
+        {
+            group_node->append_child(child);
+        }
+
+        endInsertRows();
+    }
+}
 
 /**
- * @brief Loads the settings from the Settings object.
+ * @brief Returns the path of a group node in the Settings object.
+ *
+ * @param group_node The group node.
+ * @return The groups from the top level down to the node, separated by '/'.
  */
-auto SettingsModel::load_settings_from_app_settings() -> void
+auto SettingsModel::settings_path(const SettingsNode* group_node) const -> QString
 {
-    QStringList all_keys = m_settings->allKeys();
+    QStringList groups;
 
-    for (const QString key: all_keys)
+    for (const SettingsNode* node = group_node; node != nullptr && node != m_root_node;
+         node = node->get_parent_item())
     {
-        QStringList key_parts = key.split('/');
-        QString group = key_parts.takeFirst();
-        QString key_name = key_parts.join('/');
-        QVariant value = m_settings->getValue(group, key_name);
-        setValue(key_name, value, group);
+        groups.prepend(node->get_group());
     }
+
+    return groups.join('/');
+}
+
+/**
+ * @brief Returns the model index of the first column of a node.
+ *
+ * @param node The node.
+ * @return The index, or an invalid index for the root node.
+ */
+auto SettingsModel::index_of_node(SettingsNode* node) const -> QModelIndex
+{
+    return (node == m_root_node) ? QModelIndex() : createIndex(node->row(), 0, node);
 }
 
 /**
  * @brief Creates a new node with the specified group, key, value, and parent node.
  *
+ * The node is created in the arena of the model and lives until the model is reset.
+ *
  * @param group The group of the node.
  * @param key The key of the node.
  * @param value The value of the node.
@@ -405,9 +511,8 @@ auto SettingsModel::create_node(const QString& group, const QString& key, const
 
     if (parent != nullptr)
     {
-        beginInsertRows(createIndex(parent->row(), 0, parent), parent->child_count(),
-                        parent->child_count());
-        result = new SettingsNode(group, key, value, parent);
+        beginInsertRows(index_of_node(parent), parent->child_count(), parent->child_count());
+        result = m_arena->create(group, key, value, parent);
         parent->append_child(result);
         endInsertRows();
     }
@@ -415,36 +520,66 @@ auto SettingsModel::create_node(const QString& group, const QString& key, const
     return result;
 }
 
+/**
+ * @brief Returns the child group node with the specified name, creating it if it does not exist.
+ *
+ * If the parent has not been populated yet, no node is created: the value is in the Settings
+ * object and is read from there when the parent is expanded.
+ *
+ * @param parent The parent node, or nullptr.
+ * @param group The name of the group.
+ * @return The group node, or nullptr if the parent is nullptr or not populated.
+ */
+auto SettingsModel::find_or_create_group_node(SettingsNode* parent,
+                                              const QString& group) -> SettingsNode*
+{
+    SettingsNode* group_node = nullptr;
+
+    if (parent != nullptr && parent->is_populated())
+    {
+        group_node = parent->find_child_by_group(group);
+
+        if (group_node == nullptr)
+        {
+            group_node = create_node(group, "", QVariant(""), parent);
+        }
+    }
+
+    return group_node;
+}
+
 /**
  * @brief Creates or updates a key node with the specified key, value, and parent group node.
  *
  * This function creates a new key node with the specified key and value if it does not already
- * exist in the parent group node. If the key node already exists, its value is updated.
+ * exist in the parent group node. If the key node already exists, its value is updated and
+ * dataChanged() is emitted for its value column. Only the direct children of the group node are
+ * considered. Like find_or_create_group_node(), this does nothing if the group node has not been
+ * populated yet.
  *
  * @param key The key of the key node.
  * @param value The value to set.
- * @param group_node The parent group node.
- * @return The created or updated key node.
+ * @param group_node The parent group node, or nullptr.
+ * @return The created or updated key node, or nullptr if no node was created.
  */
 auto SettingsModel::create_or_update_key_node(const QString& key, const QVariant& value,
                                               SettingsNode* group_node) -> SettingsNode*
 {
     SettingsNode* key_node = nullptr;
-    QModelIndex key_node_model_index;
 
-    if (group_node != nullptr)
+    if (group_node != nullptr && group_node->is_populated())
     {
-        key_node = group_node->find_node_by_key(key);
+        key_node = group_node->find_child_by_key(key);
 
         if (key_node == nullptr)
         {
-            create_node("", key, value, group_node);
+            key_node = create_node("", key, value, group_node);
         }
         else
         {
-            key_node_model_index = index(key_node->row(), key_node->column_count(),
-                                         createIndex(group_node->row(), 0, group_node));
-            setData(key_node_model_index, value, Qt::EditRole);
+            key_node->set_value(value);
+            QModelIndex value_index = createIndex(key_node->row(), 2, key_node);
+            emit dataChanged(value_index, value_index, {Qt::DisplayRole, Qt::EditRole, ValueRole});
         }
     }
 
@@ -452,44 +587,32 @@ auto SettingsModel::create_or_update_key_node(const QString& key, const QVariant
 }
 
 /**
- * @brief Returns a list of leaf nodes in the model.
- */
-auto SettingsModel::get_leaf_nodes() const -> QList<SettingsNode*>
-{
-    QList<SettingsNode*> leaf_nodes;
-    collect_leaf_nodes(m_root_node, leaf_nodes);
-    return leaf_nodes;
-}
-
-/**
- * @brief Collects all the leaf nodes in the model.
+ * @brief Writes the value of a key node to the Settings object.
+ *
+ * The first group below the root is the settings group; the groups below it and the key of the
+ * node form the key. Key nodes directly below the root are written without a group.
  *
- * @param node The node to start collecting from.
- * @param leaf_nodes The list of leaf nodes to populate.
+ * @param node The key node.
  */
-auto SettingsModel::collect_leaf_nodes(SettingsNode* node,
-                                       QList<SettingsNode*>& leaf_nodes) const -> void
+auto SettingsModel::write_node_to_settings(const SettingsNode* node) const -> void
 {
-    if (node->child_count() == 0)
-    {
-        leaf_nodes.append(node);
-    }
-    else
-    {
-        for (int i = 0; i < node->child_count(); i++)
-        {
-            collect_leaf_nodes(node->get_child(i), leaf_nodes);
-        }
-    }
+    QStringList groups = node->get_full_group().split('/');
+    groups.takeFirst();  // root
+    QString group = groups.isEmpty() ? QString() : groups.takeFirst();
+    groups.append(node->get_key());
+    m_settings->setValue(group, groups.join('/'), node->get_value());
 }
 
 /**
  * @brief Resets the model by clearing all the settings.
+ *
+ * All nodes are freed at once by releasing the arena, and a new root node is created.
  */
 auto SettingsModel::reset() -> void
 {
     beginResetModel();
-    m_root_node->clear();
+    m_arena->release();
+    m_root_node = m_arena->create("Root", "");
     endResetModel();
 }
 
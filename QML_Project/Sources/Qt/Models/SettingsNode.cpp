@@ -5,43 +5,120 @@
 
 #include "Models/SettingsNode.h"
 
+#include <QMutex>
+#include <QMutexLocker>
+#include <unordered_set>
+#include <utility>
+
 namespace QmlApp
 {
 /**
  * @brief Constructs a SettingsNode object with the specified group, key, value, and parent node.
  *
  * This constructor initializes a SettingsNode object with the provided group, key, value, and
- * parent node.
+ * parent node. The group and key are interned, and the child list and indexes are only allocated
+ * once the node gets children, so a key node stores little more than its value.
  *
  * @param group The group of the node.
  * @param key The key of the node.
  * @param value The value of the node.
  * @param parent The parent node.
  */
-SettingsNode::SettingsNode(QString group, QString key, QVariant value, SettingsNode* parent)
-    : m_group(std::move(group)),
-      m_key(std::move(key)),
-      m_value(std::move(value)),
-      m_parent_item(parent)
+SettingsNode::SettingsNode(const QString& group, const QString& key, QVariant value,
+                           SettingsNode* parent)
+    : m_group(intern(group)), m_key(intern(key)), m_value(std::move(value)), m_parent_item(parent)
 {}
 
 /**
  * @brief Destroys the SettingsNode object and frees any allocated memory.
+ *
+ * The children of a node created by a SettingsNodeArena belong to the arena and are not deleted.
  */
 SettingsNode::~SettingsNode()
 {
-    qDeleteAll(m_child_items);
+    if (!m_in_arena)
+    {
+        qDeleteAll(children());
+    }
 }
 
 /**
  * @brief Appends a child SettingsNode to the current node.
  *
+ * The child is added to the group and key index of this node.
+ *
  * @param child The child SettingsNode to append.
  */
 void SettingsNode::append_child(SettingsNode* child)
 {
-    m_child_items.append(child);
+    branch().child_items.append(child);
+    child->m_parent_item = this;
+    child->m_row = child_count() - 1;
+    index_child(child);
+}
+
+/**
+ * @brief Inserts a child SettingsNode at the specified row.
+ *
+ * The rows of the following children are updated.
+ *
+ * @param row The row to insert at; it is clamped to the valid range.
+ * @param child The child SettingsNode to insert.
+ */
+auto SettingsNode::insert_child(int row, SettingsNode* child) -> void
+{
+    int insert_row = qBound(0, row, child_count());
+
+    branch().child_items.insert(insert_row, child);
     child->m_parent_item = this;
+    renumber_children(insert_row, child_count() - 1);
+    index_child(child);
+}
+
+/**
+ * @brief Removes the child at the specified row without deleting it.
+ *
+ * The rows of the following children are updated. The caller takes ownership of the child.
+ *
+ * @param row The row of the child.
+ * @return The removed child, or nullptr if no child exists at that row.
+ */
+auto SettingsNode::take_child(int row) -> SettingsNode*
+{
+    SettingsNode* child = get_child(row);
+
+    if (child != nullptr)
+    {
+        m_branch->child_items.removeAt(row);
+        unindex_child(child);
+        renumber_children(row, child_count() - 1);
+        child->m_parent_item = nullptr;
+        child->m_row = 0;
+    }
+
+    return child;
+}
+
+/**
+ * @brief Moves the child at one row to another row.
+ *
+ * The rows of all children between the two rows are updated.
+ *
+ * @param from The current row of the child.
+ * @param to The new row of the child.
+ */
+auto SettingsNode::move_child(int from, int to) -> void
+{
+    if (from != to && from >= 0 && to >= 0 && from < child_count() && to < child_count())
+    {
+        SettingsNode* child = m_branch->child_items.at(from);
+        m_branch->child_items.move(from, to);
+        renumber_children(qMin(from, to), qMax(from, to));
+
+        // Which of several same-named children comes first may have changed
+        unindex_child(child);
+        index_child(child);
+    }
 }
 
 /**
@@ -53,7 +130,7 @@ void SettingsNode::append_child(SettingsNode* child)
  */
 auto SettingsNode::get_child(int row) const -> SettingsNode*
 {
-    return m_child_items.value(row);
+    return children().value(row);
 }
 
 /**
@@ -63,7 +140,7 @@ auto SettingsNode::get_child(int row) const -> SettingsNode*
  */
 auto SettingsNode::child_items() const -> QVector<SettingsNode*>
 {
-    return m_child_items;
+    return children();
 }
 
 /**
@@ -73,7 +150,7 @@ auto SettingsNode::child_items() const -> QVector<SettingsNode*>
  */
 auto SettingsNode::child_count() const -> int
 {
-    return m_child_items.count();
+    return static_cast<int>(children().size());
 }
 
 /**
@@ -98,11 +175,11 @@ auto SettingsNode::data(int column) const -> QVariant
 
     if (column == 0)
     {
-        result = m_group;
+        result = get_group();
     }
     else if (column == 1)
     {
-        result = m_key;
+        result = get_key();
     }
     else if (column == 2)
     {
@@ -115,40 +192,49 @@ auto SettingsNode::data(int column) const -> QVariant
 /**
  * @brief Sets the data for the specified column.
  *
+ * If the group or key changes, the index of the parent node is updated.
+ *
  * @param column The column index.
  * @param value The value to set.
  */
 auto SettingsNode::set_data(int column, const QVariant& value) -> void
 {
+    bool renamed = (column == 0 || column == 1) && m_parent_item != nullptr;
+
+    if (renamed)
+    {
+        m_parent_item->unindex_child(this);
+    }
+
     if (column == 0)
     {
-        m_group = value.toString();
+        m_group = intern(value.toString());
     }
     else if (column == 1)
     {
-        m_key = value.toString();
+        m_key = intern(value.toString());
     }
     else if (column == 2)
     {
         m_value = value;
     }
+
+    if (renamed)
+    {
+        m_parent_item->index_child(this);
+    }
 }
 
 /**
  * @brief Returns the row index of the node.
  *
+ * The row is stored in the node and kept up to date by the parent, so this takes constant time.
+ *
  * @return The row index of the node.
  */
 auto SettingsNode::row() const -> int
 {
-    int row = 0;
-
-    if (m_parent_item)
-    {
-        row = m_parent_item->m_child_items.indexOf(const_cast<SettingsNode*>(this));
-    }
-
-    return row;
+    return m_row;
 }
 
 /**
@@ -178,7 +264,7 @@ auto SettingsNode::has_parent() const -> bool
  */
 auto SettingsNode::has_children() const -> bool
 {
-    return !m_child_items.isEmpty();
+    return !children().isEmpty();
 }
 
 /**
@@ -190,13 +276,13 @@ auto SettingsNode::has_children() const -> bool
 auto SettingsNode::find_node_by_group(const QString& group) const -> SettingsNode*
 {
     // Check if the current node matches the group
-    if (m_group == group)
+    if (group_name() == group)
     {
         return const_cast<SettingsNode*>(this);
     }
 
     // Iterate through the child nodes
-    for (const auto& child: m_child_items)
+    for (const auto& child: children())
     {
         // Recursively search for the group in each child node
         SettingsNode* found_node = child->find_node_by_group(group);
@@ -221,13 +307,13 @@ auto SettingsNode::find_node_by_group(const QString& group) const -> SettingsNod
 auto SettingsNode::find_node_by_key(const QString& key) const -> SettingsNode*
 {
     // Check if the current node matches the key
-    if (m_key == key)
+    if (key_name() == key)
     {
         return const_cast<SettingsNode*>(this);
     }
 
     // Iterate through the child nodes
-    for (const auto& child: m_child_items)
+    for (const auto& child: children())
     {
         // Recursively search for the key in each child node
         SettingsNode* found_node = child->find_node_by_key(key);
@@ -243,6 +329,35 @@ auto SettingsNode::find_node_by_key(const QString& key) const -> SettingsNode*
     return nullptr;
 }
 
+/**
+ * @brief Finds the direct child with the specified group.
+ *
+ * Unlike find_node_by_group(), this only looks at the children of this node and uses the group
+ * index, so it takes constant time and never matches a same-named group elsewhere in the tree.
+ * If several children have the group, the first one is returned.
+ *
+ * @param group The group to search for.
+ * @return The child with the specified group, or nullptr if not found.
+ */
+auto SettingsNode::find_child_by_group(const QString& group) const -> SettingsNode*
+{
+    return (m_branch != nullptr) ? m_branch->children_by_group.value(group, nullptr) : nullptr;
+}
+
+/**
+ * @brief Finds the direct child with the specified key.
+ *
+ * Unlike find_node_by_key(), this only looks at the children of this node and uses the key index,
+ * so it takes constant time. If several children have the key, the first one is returned.
+ *
+ * @param key The key to search for.
+ * @return The child with the specified key, or nullptr if not found.
+ */
+auto SettingsNode::find_child_by_key(const QString& key) const -> SettingsNode*
+{
+    return (m_branch != nullptr) ? m_branch->children_by_key.value(key, nullptr) : nullptr;
+}
+
 /**
  * @brief Sets the value of the node.
  *
@@ -260,7 +375,7 @@ auto SettingsNode::set_value(const QVariant& value) -> void
  */
 auto SettingsNode::get_group() const -> QString
 {
-    return m_group;
+    return group_name();
 }
 
 /**
@@ -270,7 +385,7 @@ auto SettingsNode::get_group() const -> QString
  */
 auto SettingsNode::get_key() const -> QString
 {
-    return m_key;
+    return key_name();
 }
 
 /**
@@ -310,12 +425,205 @@ auto SettingsNode::get_full_group() const -> QString
     return result;
 }
 
+/**
+ * @brief Sets whether the children of the node have been created.
+ *
+ * @param populated false if the children are still to be read from the settings, true otherwise.
+ */
+auto SettingsNode::set_populated(bool populated) -> void
+{
+    m_populated = populated;
+}
+
+/**
+ * @brief Checks if the children of the node have been created.
+ *
+ * @return true if the node is populated, false if its children are still to be read.
+ */
+auto SettingsNode::is_populated() const -> bool
+{
+    return m_populated;
+}
+
+/**
+ * @brief Checks if the node was created by a SettingsNodeArena.
+ *
+ * @return true if the node belongs to an arena and must not be deleted, false otherwise.
+ */
+auto SettingsNode::is_in_arena() const -> bool
+{
+    return m_in_arena;
+}
+
 /**
  * @brief Clears the node and its child nodes.
+ *
+ * Children created by a SettingsNodeArena are only detached; they are destroyed when the arena is
+ * released.
  */
 auto SettingsNode::clear() -> void
 {
-    qDeleteAll(m_child_items);
-    m_child_items.clear();
+    if (!m_in_arena)
+    {
+        qDeleteAll(children());
+    }
+
+    m_branch.reset();
+}
+
+/**
+ * @brief Returns the interned copy of a group or key name.
+ *
+ * Every distinct name is stored once for the lifetime of the application and shared by all nodes
+ * with that name, which saves memory for names like "width" or "enabled" that occur in many
+ * groups, and lets nodes compare names by pointer. The table is guarded by a mutex.
+ *
+ * @param name The name.
+ * @return The interned name, or nullptr if the name is empty.
+ */
+auto SettingsNode::intern(const QString& name) -> const QString*
+{
+    static QMutex mutex;
+    static std::unordered_set<QString> names;
+    const QString* result = nullptr;
+
+    if (!name.isEmpty())
+    {
+        QMutexLocker locker(&mutex);
+        result = &*names.insert(name).first;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the group of the node without copying it.
+ *
+ * @return The group, or an empty string.
+ */
+auto SettingsNode::group_name() const -> const QString&
+{
+    static const QString kEmpty;
+    return (m_group != nullptr) ? *m_group : kEmpty;
+}
+
+/**
+ * @brief Returns the key of the node without copying it.
+ *
+ * @return The key, or an empty string.
+ */
+auto SettingsNode::key_name() const -> const QString&
+{
+    static const QString kEmpty;
+    return (m_key != nullptr) ? *m_key : kEmpty;
+}
+
+/**
+ * @brief Returns the child nodes without copying them.
+ *
+ * @return The child nodes; empty if the node has never had children.
+ */
+auto SettingsNode::children() const -> const QVector<SettingsNode*>&
+{
+    static const QVector<SettingsNode*> kEmpty;
+    return (m_branch != nullptr) ? m_branch->child_items : kEmpty;
+}
+
+/**
+ * @brief Returns the data only nodes with children need, creating it on first use.
+ *
+ * @return The branch data.
+ */
+auto SettingsNode::branch() -> Branch&
+{
+    if (m_branch == nullptr)
+    {
+        m_branch = std::make_unique<Branch>();
+    }
+
+    return *m_branch;
+}
+
+/**
+ * @brief Adds a child to the group and key index.
+ *
+ * Empty groups and keys are not indexed. An existing entry is only replaced by a child in an
+ * earlier row, so the index always refers to the first child with a given name.
+ *
+ * @param child The child node.
+ */
+auto SettingsNode::index_child(SettingsNode* child) -> void
+{
+    Branch& data = branch();
+
+    if (child->m_group != nullptr)
+    {
+        SettingsNode*& by_group = data.children_by_group[*child->m_group];
+
+        if (by_group == nullptr || by_group->m_row > child->m_row)
+        {
+            by_group = child;
+        }
+    }
+
+    if (child->m_key != nullptr)
+    {
+        SettingsNode*& by_key = data.children_by_key[*child->m_key];
+
+        if (by_key == nullptr || by_key->m_row > child->m_row)
+        {
+            by_key = child;
+        }
+    }
+}
+
+/**
+ * @brief Removes a child from the group and key index.
+ *
+ * If another child has the same name, it takes over the index entry.
+ *
+ * @param child The child node.
+ */
+auto SettingsNode::unindex_child(SettingsNode* child) -> void
+{
+    Branch& data = branch();
+    bool group_removed = child->m_group != nullptr &&
+                         data.children_by_group.value(*child->m_group) == child;
+    bool key_removed = child->m_key != nullptr &&
+                       data.children_by_key.value(*child->m_key) == child;
+
+    if (group_removed)
+    {
+        data.children_by_group.remove(*child->m_group);
+    }
+
+    if (key_removed)
+    {
+        data.children_by_key.remove(*child->m_key);
+    }
+
+    // Interned names are equal if and only if they are the same object
+    for (SettingsNode* sibling: data.child_items)
+    {
+        if (sibling != child && ((group_removed && sibling->m_group == child->m_group) ||
+                                 (key_removed && sibling->m_key == child->m_key)))
+        {
+            index_child(sibling);
+        }
+    }
+}
+
+/**
+ * @brief Stores the current row in each child of the given range.
+ *
+ * @param first The first row to update.
+ * @param last The last row to update.
+ */
+auto SettingsNode::renumber_children(int first, int last) -> void
+{
+    for (int row = first; row <= last; ++row)
+    {
+        m_branch->child_items[row]->m_row = row;
+    }
 }
 }  // namespace QmlApp
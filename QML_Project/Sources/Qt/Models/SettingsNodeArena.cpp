@@ -0,0 +1,109 @@
+/**
+ * @file SettingsNodeArena.cpp
+ * @brief This file contains the implementation of the SettingsNodeArena class.
+ */
+
+#include "Models/SettingsNodeArena.h"
+
+#include <new>
+
+namespace QmlApp
+{
+static_assert(alignof(SettingsNode) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+              "Chunks must be suitably aligned for SettingsNode");
+
+/**
+ * @brief Destroys the SettingsNodeArena object and all nodes created by it.
+ */
+SettingsNodeArena::~SettingsNodeArena()
+{
+    release();
+}
+
+/**
+ * @brief Creates a node in the arena.
+ *
+ * Nodes are placed one after the other in chunks of kNodesPerChunk nodes, so nodes created in a
+ * row, such as the children of a group, lie next to each other in memory. A node never moves, so
+ * pointers to it, like the internal pointer of a QModelIndex, stay valid until the arena is
+ * released. The node does not own its children; they must be created by the same arena.
+ *
+ * @param group The group of the node.
+ * @param key The key of the node.
+ * @param value The value of the node.
+ * @param parent The parent node.
+ * @return The new node. It must not be deleted; it is destroyed by release().
+ */
+auto SettingsNodeArena::create(const QString& group, const QString& key, const QVariant& value,
+                               SettingsNode* parent) -> SettingsNode*
+{
+    if (m_chunks.empty() || m_used_in_last_chunk == kNodesPerChunk)
+    {
+        m_chunks.push_back(std::make_unique<std::byte[]>(kNodesPerChunk * sizeof(SettingsNode)));
+        m_used_in_last_chunk = 0;
+    }
+
+    std::byte* slot = m_chunks.back().get() + m_used_in_last_chunk * sizeof(SettingsNode);
+    auto node = new (slot) SettingsNode(group, key, value, parent);
+    node->m_in_arena = true;
+    ++m_used_in_last_chunk;
+
+    return node;
+}
+
+/**
+ * @brief Destroys all nodes created by the arena and frees its memory.
+ *
+ * The nodes are destroyed in a single pass over the chunks instead of a walk through the tree,
+ * and each chunk is freed with a single deallocation. All pointers to the nodes become invalid.
+ */
+auto SettingsNodeArena::release() -> void
+{
+    for (qsizetype chunk = 0; chunk < chunk_count(); ++chunk)
+    {
+        qsizetype used = (chunk == chunk_count() - 1) ? m_used_in_last_chunk : kNodesPerChunk;
+
+        for (qsizetype slot = 0; slot < used; ++slot)
+        {
+            node_at(chunk, slot)->~SettingsNode();
+        }
+    }
+
+    m_chunks.clear();
+    m_used_in_last_chunk = 0;
+}
+
+/**
+ * @brief Returns the number of nodes created since the arena was last released.
+ *
+ * @return The number of nodes.
+ */
+auto SettingsNodeArena::node_count() const -> qsizetype
+{
+    return m_chunks.empty() ? 0 : (chunk_count() - 1) * kNodesPerChunk + m_used_in_last_chunk;
+}
+
+/**
+ * @brief Returns the number of allocated chunks.
+ *
+ * @return The number of chunks.
+ */
+auto SettingsNodeArena::chunk_count() const -> qsizetype
+{
+    return static_cast<qsizetype>(m_chunks.size());
+}
+
+/**
+ * @brief Returns the node in a slot of a chunk.
+ *
+ * @param chunk The index of the chunk.
+ * @param slot The index of the slot within the chunk.
+ * @return The node in the slot.
+ */
+auto SettingsNodeArena::node_at(qsizetype chunk, qsizetype slot) const -> SettingsNode*
+{
+    std::byte* address =
+        m_chunks[static_cast<std::size_t>(chunk)].get() + slot * sizeof(SettingsNode);
+    return std::launder(reinterpret_cast<SettingsNode*>(address));
+}
+}  // namespace QmlApp
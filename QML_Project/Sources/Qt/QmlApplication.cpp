@@ -7,36 +7,156 @@
 
 #include <QApplication>
 #include <QDebug>
+#include <QFileInfo>
 #include <QQmlContext>
 #include <QString>
 
+#include "Services/BinarySettingsFile.h"
+#include "Services/Logging/CrashHandler.h"
+#include "Services/Logging/FileSink.h"
+#include "Services/Logging/JsonFormatter.h"
+#include "Services/Logging/LogRedactor.h"
+#include "Services/Logging/LogSearchEngine.h"
+#include "Services/Logging/Logger.h"
+#include "Services/Logging/StaticAppender.h"
+
 namespace QmlApp
 {
 /**
  * @brief Constructs a QmlApplication object with the given parent.
  *
+ * If the setting `Logging/metrics_file` is set, the logging metrics are written to that file in
+ * Prometheus exposition format every `Logging/metrics_interval_ms` milliseconds. The optional
+ * logging outputs are set up from the settings as well, see configure_logging(). The log model is
+ * registered as an appender with the Logger, so it shows every record logged from now on.
+ * Changed settings are written to `settings.bin` shortly after they change, so a crash loses at
+ * most the last few seconds of changes.
+ *
  * @param parent The parent object.
  */
 QmlApplication::QmlApplication(QObject* parent)
-    : QObject(parent), m_engine(), m_settings(), m_settings_model(&m_settings), m_translator()
+    : QObject(parent),
+      m_engine(),
+      m_settings(),
+      m_settings_model(&m_settings),
+      m_settings_persister(&m_settings, QStringLiteral("settings.bin")),
+      m_translator(),
+      m_log_metrics(),
+      m_metrics_writer(),
+      m_log_model()
 {
     qmlRegisterType<SettingsModel>("QmlApp.Models.SettingsModel", 1, 0, "SettingsModel");
+    qmlRegisterType<LogListModel>("QmlApp.Models.LogListModel", 1, 0, "LogListModel");
     qmlRegisterType<Settings>("QmlApp.Services.Settings", 1, 0, "Settings");
     qmlRegisterType<Translator>("QmlApp.Services.Translator", 1, 0, "Translator");
+    qmlRegisterType<LogSearchEngine>("QmlApp.Services.LogSearchEngine", 1, 0, "LogSearchEngine");
+    qmlRegisterType<LogMetricsProvider>("QmlApp.Services.LogMetricsProvider", 1, 0,
+                                        "LogMetricsProvider");
     m_engine.rootContext()->setContextProperty(QStringLiteral("settings_model"), &m_settings_model);
     m_engine.rootContext()->setContextProperty(QStringLiteral("translator"), &m_translator);
+    m_engine.rootContext()->setContextProperty(QStringLiteral("log_metrics"), &m_log_metrics);
+    m_engine.rootContext()->setContextProperty(QStringLiteral("log_model"), &m_log_model);
+
+    Logger::get_instance().add_appender(m_log_model.get_appender());
 
     // Load settings on startup
-    m_settings_model.loadFromFile("settings.ini");
+    load_settings();
+    configure_logging();
+
+    // Export logging metrics if configured
+    QString metrics_file = m_settings.getValue("Logging", "metrics_file").toString();
+
+    if (!metrics_file.isEmpty())
+    {
+        int interval_ms = m_settings.getValue("Logging", "metrics_interval_ms", 10000).toInt();
+        m_metrics_writer.start(metrics_file, interval_ms);
+    }
 
     // Save settings on application exit
-    connect(qApp, &QApplication::aboutToQuit,
-            [this]() { m_settings_model.saveToFile("settings.ini"); });
+    connect(qApp, &QApplication::aboutToQuit, [this]() { save_settings(); });
 
     connect(&m_translator, &Translator::languageChanged, this,
             [this]() { m_engine.retranslate(); });
 }
 
+/**
+ * @brief Loads the settings file.
+ *
+ * The binary copy `settings.bin` is loaded if it is at least as new as `settings.ini`, since it
+ * needs no text parsing: it is mapped and its values are decoded on first access. If
+ * `settings.ini` was edited after the last save, or the binary copy is missing or invalid,
+ * `settings.ini` is loaded instead.
+ */
+auto QmlApplication::load_settings() -> void
+{
+    QFileInfo ini_file_info(QStringLiteral("settings.ini"));
+    QFileInfo binary_file_info(QStringLiteral("settings.bin"));
+    bool binary_file_current = binary_file_info.exists() &&
+                               (!ini_file_info.exists() ||
+                                binary_file_info.lastModified() >= ini_file_info.lastModified());
+
+    m_settings_model.loadFromFile(binary_file_current ? binary_file_info.filePath()
+                                                      : ini_file_info.filePath(),
+                                  binary_file_current ? BinarySettingsFile::format()
+                                                      : QSettings::IniFormat);
+
+    if (binary_file_current && m_settings.childGroups().isEmpty() &&
+        m_settings.childKeys(QString()).isEmpty() && ini_file_info.exists())
+    {
+        m_settings_model.loadFromFile(ini_file_info.filePath());
+    }
+}
+
+/**
+ * @brief Enables the optional logging stages configured in the settings.
+ *
+ * If `Logging/redact` is true, tokens, credentials, email addresses and home paths are scrubbed
+ * from every message before any appender sees it. If `Logging/json_file` is set, a structured log
+ * with the raw stack traces of critical records is written to that file, see
+ * _symbolize_stack_trace. Both are off by default. The JSON appender is put before the appenders
+ * set up in main(), so it has a fatal message before the console aborts.
+ */
+auto QmlApplication::configure_logging() -> void
+{
+    Logger& logger = Logger::get_instance();
+
+    if (m_settings.getBool("Logging", "redact"))
+    {
+        logger.set_redactor(QSharedPointer<const LogRedactor>::create());
+    }
+
+    QString json_file = m_settings.getString("Logging", "json_file");
+
+    if (!json_file.isEmpty())
+    {
+        auto json_appender =
+            QSharedPointer<StaticAppender<JsonFormatter, FileSink>>::create(json_file, 64 * 1024);
+        json_appender->set_name(QStringLiteral("json"));
+
+        QList<QSharedPointer<LogAppender>> appenders = logger.get_appenders();
+        logger.clear_appenders();
+        logger.add_appender(json_appender);
+
+        for (const auto& appender: appenders)
+        {
+            logger.add_appender(appender);
+        }
+
+        CrashHandler::register_appender(json_appender);
+    }
+}
+
+/**
+ * @brief Saves the settings to `settings.ini` and its binary copy `settings.bin`.
+ *
+ * The binary copy is written last, so it is not older than the INI file on the next start.
+ */
+auto QmlApplication::save_settings() -> void
+{
+    m_settings_model.saveToFile(QStringLiteral("settings.ini"));
+    m_settings_persister.save_now();
+}
+
 /**
  * @brief Loads the QML file from the specified URL.
  *
@@ -0,0 +1,605 @@
+/**
+ * @file BinarySettingsFile.cpp
+ * @brief This file contains the implementation of the BinarySettingsFile class.
+ */
+
+#include "Services/BinarySettingsFile.h"
+
+#include <QDataStream>
+#include <QDebug>
+#include <QSaveFile>
+#include <QtEndian>
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace QmlApp
+{
+namespace
+{
+/**
+ * @brief The file layout.
+ *
+ * All integers are unsigned 32-bit little-endian values and all offsets are relative to the start
+ * of the file:
+ *
+ * - Header: magic, version, key count, reserved.
+ * - Index: one entry per key, sorted by the UTF-8 bytes of the key: key offset, key length, value
+ *   offset, value length.
+ * - Key table: the UTF-8 encoded keys.
+ * - Value table: every value serialised with QDataStream.
+ */
+constexpr quint32 kMagic = 0x42534151;  // "QASB"
+constexpr quint32 kVersion = 1;
+constexpr qint64 kHeaderSize = 16;
+constexpr qint64 kIndexEntrySize = 16;
+constexpr QDataStream::Version kStreamVersion = QDataStream::Qt_6_0;
+
+/**
+ * @brief Appends a 32-bit little-endian value to a byte array.
+ *
+ * @param bytes The byte array.
+ * @param value The value.
+ */
+auto append_uint32(QByteArray& bytes, quint32 value) -> void
+{
+    char buffer[4];
+    qToLittleEndian(value, buffer);
+    bytes.append(buffer, 4);
+}
+}  // namespace
+
+/**
+ * @brief Destroys the BinarySettingsFile object and unmaps the file.
+ */
+BinarySettingsFile::~BinarySettingsFile()
+{
+    close();
+}
+
+/**
+ * @brief Opens a binary settings file and maps it into memory.
+ *
+ * Only the header and the index are checked; no value is decoded. If the file cannot be mapped,
+ * it is read into memory instead.
+ *
+ * @param file_path The path of the file.
+ * @return True if the file was opened and is valid, false otherwise.
+ */
+auto BinarySettingsFile::open(const QString& file_path) -> bool
+{
+    bool result = false;
+    close();
+    m_file.setFileName(file_path);
+
+    if (m_file.open(QIODevice::ReadOnly))
+    {
+        qint64 size = m_file.size();
+        const uchar* data = (size > 0) ? m_file.map(0, size) : nullptr;
+
+        if (data == nullptr)
+        {
+            m_buffer = m_file.readAll();
+            data = reinterpret_cast<const uchar*>(m_buffer.constData());
+            size = m_buffer.size();
+        }
+
+        result = attach(data, size);
+    }
+
+    if (!result)
+    {
+        qWarning() << "Invalid binary settings file:" << file_path;
+        close();
+    }
+
+    return result;
+}
+
+/**
+ * @brief Loads binary settings from memory.
+ *
+ * @param data The content of a binary settings file.
+ * @return True if the data is valid, false otherwise.
+ */
+auto BinarySettingsFile::load(const QByteArray& data) -> bool
+{
+    close();
+    m_buffer = data;
+    bool result = attach(reinterpret_cast<const uchar*>(m_buffer.constData()), m_buffer.size());
+
+    if (!result)
+    {
+        close();
+    }
+
+    return result;
+}
+
+/**
+ * @brief Closes the file and discards all decoded values.
+ */
+auto BinarySettingsFile::close() -> void
+{
+    if (m_file.isOpen())
+    {
+        m_file.close();
+    }
+
+    m_buffer.clear();
+    m_data = nullptr;
+    m_size = 0;
+    m_key_count = 0;
+    m_decoded_values.clear();
+}
+
+/**
+ * @brief Checks if a file or data is loaded.
+ *
+ * @return True if a file or data is loaded, false otherwise.
+ */
+auto BinarySettingsFile::is_open() const -> bool
+{
+    return m_data != nullptr;
+}
+
+/**
+ * @brief Returns the number of keys.
+ *
+ * @return The number of keys.
+ */
+auto BinarySettingsFile::key_count() const -> int
+{
+    return m_key_count;
+}
+
+/**
+ * @brief Returns the key at the specified index.
+ *
+ * The keys are sorted by their UTF-8 encoding.
+ *
+ * @param index The index of the key.
+ * @return The key, or an empty string if the index is out of range.
+ */
+auto BinarySettingsFile::key_at(int index) const -> QString
+{
+    QString result;
+
+    if (index >= 0 && index < m_key_count)
+    {
+        result = QString::fromUtf8(key_bytes(index));
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the value at the specified index.
+ *
+ * The value is decoded on first access and cached. The cache makes this method unsafe to call
+ * from several threads at once.
+ *
+ * @param index The index of the value.
+ * @return The value, or an invalid QVariant if the index is out of range.
+ */
+auto BinarySettingsFile::value_at(int index) const -> QVariant
+{
+    QVariant result;
+
+    if (index >= 0 && index < m_key_count)
+    {
+        auto it = m_decoded_values.constFind(index);
+
+        if (it != m_decoded_values.constEnd())
+        {
+            result = it.value();
+        }
+        else
+        {
+            result = decode_value(index);
+            m_decoded_values.insert(index, result);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the index of the first key that is not less than the specified key.
+ *
+ * Keys are compared by their UTF-8 bytes. Since the key table is sorted, all keys that start
+ * with a prefix follow the index returned for that prefix.
+ *
+ * @param key The key.
+ * @return The index of the first key that is not less than the key, or key_count() if there is
+ * none.
+ */
+auto BinarySettingsFile::lower_bound(const QString& key) const -> int
+{
+    QByteArray key_utf8 = key.toUtf8();
+    int first = 0;
+    int count = m_key_count;
+
+    while (count > 0)
+    {
+        int step = count / 2;
+
+        if (key_bytes(first + step) < key_utf8)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    return first;
+}
+
+/**
+ * @brief Returns the index of the specified key.
+ *
+ * The key table is sorted, so this is a binary search.
+ *
+ * @param key The key.
+ * @return The index of the key, or -1 if the key does not exist.
+ */
+auto BinarySettingsFile::index_of(const QString& key) const -> int
+{
+    int index = lower_bound(key);
+    return (index < m_key_count && key_bytes(index) == key.toUtf8()) ? index : -1;
+}
+
+/**
+ * @brief Checks if the specified key exists.
+ *
+ * @param key The key.
+ * @return True if the key exists, false otherwise.
+ */
+auto BinarySettingsFile::contains(const QString& key) const -> bool
+{
+    return index_of(key) >= 0;
+}
+
+/**
+ * @brief Returns the value of the specified key.
+ *
+ * @param key The key.
+ * @param default_value The value to return if the key does not exist.
+ * @return The value of the key, or the default value if the key does not exist.
+ */
+auto BinarySettingsFile::value(const QString& key, const QVariant& default_value) const
+    -> QVariant
+{
+    int index = index_of(key);
+    return (index >= 0) ? value_at(index) : default_value;
+}
+
+/**
+ * @brief Returns the number of values that have been decoded so far.
+ *
+ * @return The number of decoded values.
+ */
+auto BinarySettingsFile::decoded_count() const -> int
+{
+    return static_cast<int>(m_decoded_values.size());
+}
+
+/**
+ * @brief Writes settings in the binary format to a device.
+ *
+ * If a key occurs more than once, the last value is written.
+ *
+ * @param device The device, opened for writing.
+ * @param snapshot The full keys with their values.
+ * @return True if the settings were written, false if the device failed or the file would exceed
+ * 4 GiB.
+ */
+auto BinarySettingsFile::write(QIODevice& device, const SettingsSnapshot& snapshot) -> bool
+{
+    QList<QPair<QByteArray, QByteArray>> entries;
+    entries.reserve(snapshot.size());
+
+    for (const auto& [key, value]: snapshot)
+    {
+        QByteArray value_bytes;
+        QDataStream stream(&value_bytes, QIODevice::WriteOnly);
+        stream.setVersion(kStreamVersion);
+        stream << value;
+        entries.append(qMakePair(key.toUtf8(), value_bytes));
+    }
+
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const auto& left, const auto& right) { return left.first < right.first; });
+
+    // Keep the last of several entries with the same key
+    QList<QPair<QByteArray, QByteArray>> unique_entries;
+    unique_entries.reserve(entries.size());
+
+    for (qsizetype i = 0; i < entries.size(); i++)
+    {
+        if (i + 1 == entries.size() || entries[i + 1].first != entries[i].first)
+        {
+            unique_entries.append(std::move(entries[i]));
+        }
+    }
+
+    qint64 key_offset = kHeaderSize + unique_entries.size() * kIndexEntrySize;
+    qint64 value_offset = key_offset;
+
+    for (const auto& [key, value]: unique_entries)
+    {
+        value_offset += key.size();
+    }
+
+    qint64 total_size = value_offset;
+
+    for (const auto& [key, value]: unique_entries)
+    {
+        total_size += value.size();
+    }
+
+    bool result = total_size <= std::numeric_limits<quint32>::max();
+
+    if (result)
+    {
+        QByteArray bytes;
+        bytes.reserve(total_size);
+        append_uint32(bytes, kMagic);
+        append_uint32(bytes, kVersion);
+        append_uint32(bytes, static_cast<quint32>(unique_entries.size()));
+        append_uint32(bytes, 0);
+
+        for (const auto& [key, value]: unique_entries)
+        {
+            append_uint32(bytes, static_cast<quint32>(key_offset));
+            append_uint32(bytes, static_cast<quint32>(key.size()));
+            append_uint32(bytes, static_cast<quint32>(value_offset));
+            append_uint32(bytes, static_cast<quint32>(value.size()));
+            key_offset += key.size();
+            value_offset += value.size();
+        }
+
+        for (const auto& [key, value]: unique_entries)
+        {
+            bytes.append(key);
+        }
+
+        for (const auto& [key, value]: unique_entries)
+        {
+            bytes.append(value);
+        }
+
+        result = device.write(bytes) == bytes.size();
+    }
+
+    return result;
+}
+
+/**
+ * @brief Writes settings in the binary format to a file.
+ *
+ * The file is written through a QSaveFile, so it is replaced atomically.
+ *
+ * @param file_path The path of the file.
+ * @param snapshot The full keys with their values.
+ * @return True if the file was written, false otherwise.
+ */
+auto BinarySettingsFile::write(const QString& file_path, const SettingsSnapshot& snapshot) -> bool
+{
+    QSaveFile file(file_path);
+    bool result = file.open(QIODevice::WriteOnly) && write(file, snapshot) && file.commit();
+
+    if (!result)
+    {
+        qWarning() << "Failed to write binary settings file:" << file_path;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the QSettings format for binary settings files, registering it on first use.
+ *
+ * QSettings needs all values up front, so reading through QSettings decodes every value. Open
+ * the file with a BinarySettingsFile to decode values on first access instead;
+ * Settings::loadFromFile() does this when it is given this format.
+ *
+ * @return The format, or QSettings::InvalidFormat if it could not be registered.
+ */
+auto BinarySettingsFile::format() -> QSettings::Format
+{
+    static const QSettings::Format kFormat =
+        QSettings::registerFormat(QStringLiteral("bin"), read_settings, write_settings);
+    return kFormat;
+}
+
+/**
+ * @brief Converts an INI settings file to a binary settings file.
+ *
+ * @param ini_file_path The path of the INI file.
+ * @param binary_file_path The path of the binary file to write.
+ * @return True if the file was converted, false otherwise.
+ */
+auto BinarySettingsFile::convert_ini_to_binary(const QString& ini_file_path,
+                                               const QString& binary_file_path) -> bool
+{
+    bool result = false;
+
+    if (QFile::exists(ini_file_path))
+    {
+        QSettings ini_settings(ini_file_path, QSettings::IniFormat);
+        result = ini_settings.status() == QSettings::NoError &&
+                 write(binary_file_path, Settings::read_snapshot(ini_settings));
+    }
+
+    return result;
+}
+
+/**
+ * @brief Converts a binary settings file to an INI settings file.
+ *
+ * An existing INI file is replaced.
+ *
+ * @param binary_file_path The path of the binary file.
+ * @param ini_file_path The path of the INI file to write.
+ * @return True if the file was converted, false otherwise.
+ */
+auto BinarySettingsFile::convert_binary_to_ini(const QString& binary_file_path,
+                                               const QString& ini_file_path) -> bool
+{
+    BinarySettingsFile binary_file;
+    bool result = binary_file.open(binary_file_path);
+
+    if (result)
+    {
+        QFile::remove(ini_file_path);
+        QSettings ini_settings(ini_file_path, QSettings::IniFormat);
+
+        for (int index = 0; index < binary_file.key_count(); index++)
+        {
+            ini_settings.setValue(binary_file.key_at(index), binary_file.decode_value(index));
+        }
+
+        ini_settings.sync();
+        result = ini_settings.status() == QSettings::NoError;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Checks the header and the index and makes the data available.
+ *
+ * Every index entry must lie within the data and the keys must be sorted, so later lookups need
+ * no further checks.
+ *
+ * @param data The data.
+ * @param size The size of the data in bytes.
+ * @return True if the data is valid, false otherwise.
+ */
+auto BinarySettingsFile::attach(const uchar* data, qint64 size) -> bool
+{
+    m_data = data;
+    m_size = size;
+    bool result = data != nullptr && size >= kHeaderSize && read_uint32(0) == kMagic &&
+                  read_uint32(4) == kVersion;
+
+    if (result)
+    {
+        qint64 key_count = read_uint32(8);
+        result = key_count <= std::numeric_limits<int>::max() &&
+                 kHeaderSize + key_count * kIndexEntrySize <= size;
+        m_key_count = result ? static_cast<int>(key_count) : 0;
+    }
+
+    for (int index = 0; result && index < m_key_count; index++)
+    {
+        qint64 entry = kHeaderSize + index * kIndexEntrySize;
+        qint64 key_end = qint64(read_uint32(entry)) + read_uint32(entry + 4);
+        qint64 value_end = qint64(read_uint32(entry + 8)) + read_uint32(entry + 12);
+        result = key_end <= size && value_end <= size &&
+                 (index == 0 || key_bytes(index - 1) < key_bytes(index));
+    }
+
+    if (!result)
+    {
+        m_data = nullptr;
+        m_size = 0;
+        m_key_count = 0;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Reads a 32-bit little-endian value.
+ *
+ * @param offset The offset of the value.
+ * @return The value.
+ */
+auto BinarySettingsFile::read_uint32(qint64 offset) const -> quint32
+{
+    return qFromLittleEndian<quint32>(m_data + offset);
+}
+
+/**
+ * @brief Returns the UTF-8 encoded key at the specified index without copying it.
+ *
+ * @param index The index of the key.
+ * @return The key; it refers to the mapped data.
+ */
+auto BinarySettingsFile::key_bytes(int index) const -> QByteArray
+{
+    qint64 entry = kHeaderSize + index * kIndexEntrySize;
+    return QByteArray::fromRawData(reinterpret_cast<const char*>(m_data + read_uint32(entry)),
+                                   read_uint32(entry + 4));
+}
+
+/**
+ * @brief Decodes the value at the specified index without caching it.
+ *
+ * @param index The index of the value.
+ * @return The value, or an invalid QVariant if it cannot be decoded.
+ */
+auto BinarySettingsFile::decode_value(int index) const -> QVariant
+{
+    qint64 entry = kHeaderSize + index * kIndexEntrySize;
+    QByteArray bytes = QByteArray::fromRawData(
+        reinterpret_cast<const char*>(m_data + read_uint32(entry + 8)), read_uint32(entry + 12));
+    QDataStream stream(bytes);
+    stream.setVersion(kStreamVersion);
+    QVariant result;
+    stream >> result;
+
+    if (stream.status() != QDataStream::Ok)
+    {
+        result = QVariant();
+    }
+
+    return result;
+}
+
+/**
+ * @brief Reads binary settings for QSettings.
+ *
+ * @param device The device to read from.
+ * @param map The map to fill with the full keys and their values.
+ * @return True if the settings were read, false if the data is invalid.
+ */
+auto BinarySettingsFile::read_settings(QIODevice& device, QSettings::SettingsMap& map) -> bool
+{
+    BinarySettingsFile binary_file;
+    bool result = binary_file.load(device.readAll());
+
+    for (int index = 0; index < binary_file.key_count(); index++)
+    {
+        map.insert(binary_file.key_at(index), binary_file.decode_value(index));
+    }
+
+    return result;
+}
+
+/**
+ * @brief Writes binary settings for QSettings.
+ *
+ * @param device The device to write to.
+ * @param map The full keys and their values.
+ * @return True if the settings were written, false otherwise.
+ */
+auto BinarySettingsFile::write_settings(QIODevice& device, const QSettings::SettingsMap& map)
+    -> bool
+{
+    SettingsSnapshot snapshot;
+    snapshot.reserve(map.size());
+
+    for (auto it = map.constBegin(); it != map.constEnd(); ++it)
+    {
+        snapshot.append(qMakePair(it.key(), it.value()));
+    }
+
+    return write(device, snapshot);
+}
+}  // namespace QmlApp
@@ -7,24 +7,32 @@
 
 #include <QDebug>
 
+#include "Services/Logging/Logger.h"
+
 namespace QmlApp
 {
 /**
  * @brief Constructs a ConsoleAppender object with the given formatter.
  *
- * This constructor initializes the ConsoleAppender object with the provided LogFormatter object.
+ * This constructor initializes the ConsoleAppender object with the provided LogFormatter object
+ * and names it "console".
  *
  * @param formatter The LogFormatter object to use for formatting log messages.
  */
 ConsoleAppender::ConsoleAppender(const QSharedPointer<LogFormatter>& formatter)
     : LogAppender(formatter)
-{}
+{
+    m_name = QStringLiteral("console");
+}
 
 /**
  * @brief Appends the specified log message to the console.
  *
  * This function formats the log message using the provided formatter and outputs it to the console
- * using the appropriate Qt logging function based on the message type.
+ * using the appropriate Qt logging function based on the message type. The size of the formatted
+ * message in the local 8-bit encoding, which the Qt message handler writes, plus the line break
+ * is counted as emitted bytes, so the count matches the bytes on the console. Before a fatal
+ * message is passed to qFatal, which aborts the process, the logger flushes all appenders.
  *
  * @param message The log message to append to the console.
  * @param context The context of the log message.
@@ -32,6 +40,7 @@ ConsoleAppender::ConsoleAppender(const QSharedPointer<LogFormatter>& formatter)
 void ConsoleAppender::internal_append(const LogMessage& message, const QMessageLogContext& context)
 {
     QString formatted_message = m_formatter->format(message, context);
+    m_metrics.record_bytes(static_cast<quint64>(formatted_message.toLocal8Bit().size()) + 1);
 
     switch (message.get_type())
     {
@@ -48,6 +57,8 @@ void ConsoleAppender::internal_append(const LogMessage& message, const QMessageL
         qCritical().nospace().noquote() << formatted_message;
         break;
     case QtFatalMsg:
+        // qFatal aborts, so everything the other appenders still buffer has to be written first
+        Logger::get_instance().flush();
         qFatal().nospace().noquote() << formatted_message;
         break;
     default:
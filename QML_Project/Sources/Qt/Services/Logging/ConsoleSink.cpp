@@ -0,0 +1,58 @@
+/**
+ * @file ConsoleSink.cpp
+ * @brief This file contains the implementation of the ConsoleSink class.
+ */
+
+#include "Services/Logging/ConsoleSink.h"
+
+#include <QByteArray>
+#include <cstdio>
+
+#include "Services/Logging/Logger.h"
+
+namespace QmlApp
+{
+/**
+ * @brief Writes a formatted line followed by a line break.
+ *
+ * The line is written in the local 8-bit encoding, like ConsoleAppender does through qDebug().
+ *
+ * @param line The formatted line.
+ * @param type The log level of the line.
+ * @return The number of bytes written.
+ */
+auto ConsoleSink::write(const QString& line, QtMsgType type) -> qsizetype
+{
+    QByteArray bytes = line.toLocal8Bit();
+
+    if (type == QtFatalMsg)
+    {
+        // qFatal aborts, so everything the other appenders still buffer has to be written first
+        Logger::get_instance().flush();
+        qFatal("%s", bytes.constData());
+    }
+
+    bytes.append('\n');
+    std::fwrite(bytes.constData(), 1, static_cast<size_t>(bytes.size()), stderr);
+
+    if (type != QtDebugMsg && type != QtInfoMsg)
+    {
+        std::fflush(stderr);
+    }
+
+    return bytes.size();
+}
+
+/**
+ * @brief Flushes stderr.
+ */
+auto ConsoleSink::flush() -> void
+{
+    std::fflush(stderr);
+}
+
+/**
+ * @brief Does nothing, since stderr is not buffered by the sink.
+ */
+auto ConsoleSink::emergency_flush() -> void {}
+}  // namespace QmlApp
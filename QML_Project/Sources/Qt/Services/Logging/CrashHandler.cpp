@@ -0,0 +1,164 @@
+/**
+ * @file CrashHandler.cpp
+ * @brief This file contains the implementation of the CrashHandler class.
+ */
+
+#include "Services/Logging/CrashHandler.h"
+
+#include <QList>
+#include <QMutex>
+#include <array>
+#include <atomic>
+#include <csignal>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace QmlApp
+{
+namespace
+{
+// Read by the signal handler; constant-initialized and never destroyed
+std::array<std::atomic<LogAppender*>, CrashHandler::kMaxAppenders> g_crash_appenders{};
+std::atomic<bool> g_crash_handled = false;
+
+/**
+ * @struct CrashAppenderOwners
+ * @brief Keeps the registered appenders alive and clears the slots when it is destroyed.
+ */
+struct CrashAppenderOwners {
+        QMutex mutex;
+        QList<QSharedPointer<LogAppender>> appenders;
+
+        ~CrashAppenderOwners()
+        {
+            for (auto& slot: g_crash_appenders)
+            {
+                slot.store(nullptr);
+            }
+        }
+};
+
+auto owners() -> CrashAppenderOwners&
+{
+    static CrashAppenderOwners instance;
+    return instance;
+}
+
+/**
+ * @brief Writes a string literal to stderr with a plain write() call.
+ *
+ * @param text The text.
+ */
+template <size_t N>
+auto write_to_stderr(const char (&text)[N]) -> void
+{
+#ifdef Q_OS_WIN
+    [[maybe_unused]] auto written = _write(2, text, N - 1);
+#else
+    [[maybe_unused]] auto written = ::write(STDERR_FILENO, text, N - 1);
+#endif
+}
+}  // namespace
+
+/**
+ * @brief Installs the signal handlers.
+ *
+ * The owner registry is created here, outside of any signal handler.
+ */
+auto CrashHandler::install() -> void
+{
+    owners();
+
+    for (int signal_number: {SIGSEGV, SIGABRT, SIGFPE, SIGILL})
+    {
+        std::signal(signal_number, &CrashHandler::handle_signal);
+    }
+
+#ifdef SIGBUS
+    std::signal(SIGBUS, &CrashHandler::handle_signal);
+#endif
+}
+
+/**
+ * @brief Registers an appender whose buffer is written out on a crash.
+ *
+ * @param appender The appender.
+ * @return True if the appender was registered, false if all slots are taken.
+ */
+auto CrashHandler::register_appender(const QSharedPointer<LogAppender>& appender) -> bool
+{
+    bool registered = false;
+    CrashAppenderOwners& registry = owners();
+    QMutexLocker locker(&registry.mutex);
+
+    for (auto& slot: g_crash_appenders)
+    {
+        if (appender != nullptr && slot.load() == nullptr)
+        {
+            registry.appenders.append(appender);
+            slot.store(appender.data());
+            registered = true;
+            break;
+        }
+    }
+
+    return registered;
+}
+
+/**
+ * @brief Unregisters all appenders.
+ *
+ * The slots are cleared before the appenders are released.
+ */
+auto CrashHandler::unregister_all() -> void
+{
+    CrashAppenderOwners& registry = owners();
+    QMutexLocker locker(&registry.mutex);
+
+    for (auto& slot: g_crash_appenders)
+    {
+        slot.store(nullptr);
+    }
+
+    registry.appenders.clear();
+}
+
+/**
+ * @brief Calls emergency_flush() on all registered appenders.
+ */
+auto CrashHandler::emergency_flush() -> void
+{
+    for (auto& slot: g_crash_appenders)
+    {
+        LogAppender* appender = slot.load();
+
+        if (appender != nullptr)
+        {
+            appender->emergency_flush();
+        }
+    }
+}
+
+/**
+ * @brief Flushes the registered appenders and re-raises the signal with the default action.
+ *
+ * If a second crash happens while flushing, the flush is not attempted again.
+ *
+ * @param signal_number The signal.
+ */
+auto CrashHandler::handle_signal(int signal_number) -> void
+{
+    if (!g_crash_handled.exchange(true))
+    {
+        emergency_flush();
+        write_to_stderr("Fatal signal received, buffered log data was written out\n");
+    }
+
+    std::signal(signal_number, SIG_DFL);
+    std::raise(signal_number);
+}
+}  // namespace QmlApp
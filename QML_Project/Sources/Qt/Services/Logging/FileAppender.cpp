@@ -13,30 +13,72 @@ namespace QmlApp
  * @brief Constructs a FileAppender object with the given file path and formatter.
  *
  * This constructor initializes the FileAppender object with the provided file path and formatter.
- * It attempts to open the log file in append mode. If the file cannot be opened, a warning is
- * logged.
+ * The sink opens the log file in append mode and logs a warning if it cannot be opened. The
+ * appender is named "file".
  *
  * @param file_path The path of the log file.
  * @param formatter The formatter to use for formatting log messages.
  */
 FileAppender::FileAppender(const QString& file_path, const QSharedPointer<LogFormatter>& formatter)
-    : m_log_file(file_path), LogAppender(formatter)
+    : LogAppender(formatter), m_sink(file_path)
 {
-    if (m_log_file.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text))
-    {
-        m_log_stream.setDevice(&m_log_file);
-    }
-    else
-    {
-        qWarning() << "Failed to open log file:" << file_path;
-    }
+    m_name = QStringLiteral("file");
+}
+
+/**
+ * @brief Sets the size of the write buffer.
+ *
+ * @param bytes The size of the buffer in bytes; 0 writes every message through.
+ */
+auto FileAppender::set_buffer_size(qsizetype bytes) -> void
+{
+    m_sink.set_buffer_size(bytes);
+}
+
+/**
+ * @brief Returns the size of the write buffer.
+ *
+ * @return The size of the buffer in bytes, or 0 if messages are written through.
+ */
+auto FileAppender::get_buffer_size() const -> qsizetype
+{
+    return m_sink.get_buffer_size();
+}
+
+/**
+ * @brief Returns the number of bytes in the write buffer.
+ *
+ * @return The number of buffered bytes.
+ */
+auto FileAppender::get_buffered_bytes() const -> qsizetype
+{
+    return m_sink.get_buffered_bytes();
+}
+
+/**
+ * @brief Writes the buffered messages to the log file.
+ */
+auto FileAppender::flush() -> void
+{
+    m_sink.flush();
+}
+
+/**
+ * @brief Writes the buffered messages to the log file with a plain write() call.
+ *
+ * This is async-signal-safe and meant to be called from a crash signal handler.
+ */
+auto FileAppender::emergency_flush() -> void
+{
+    m_sink.emergency_flush();
 }
 
 /**
  * @brief Appends a log message to the log file.
  *
  * This function formats the log message using the provided formatter and writes it to the log file.
- * If the log file is not open, a warning is logged.
+ * If the log file is not open, a warning is logged. The number of bytes written or buffered,
+ * including the line break, is counted as emitted bytes.
  *
  * @param message The log message to append.
  * @param context The context of the log message.
@@ -45,9 +87,10 @@ void FileAppender::internal_append(const LogMessage& message, const QMessageLogC
 {
     QString formatted_message = m_formatter->format(message, context);
 
-    if (m_log_file.isOpen())
+    if (m_sink.is_open())
     {
-        m_log_stream << formatted_message << Qt::endl;
+        qsizetype written_bytes = m_sink.write(formatted_message, message.get_type());
+        m_metrics.record_bytes(static_cast<quint64>(written_bytes));
     }
     else
     {
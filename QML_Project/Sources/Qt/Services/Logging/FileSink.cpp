@@ -0,0 +1,257 @@
+/**
+ * @file FileSink.cpp
+ * @brief This file contains the implementation of the FileSink class.
+ */
+
+#include "Services/Logging/FileSink.h"
+
+#include <QDebug>
+#include <cstring>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace QmlApp
+{
+/**
+ * @brief Constructs a FileSink object and opens the file for appending.
+ *
+ * If the file cannot be opened, a warning is logged.
+ *
+ * @param file_path The path of the log file.
+ * @param buffer_size The size of the write buffer in bytes; 0 writes every line through.
+ */
+FileSink::FileSink(const QString& file_path, qsizetype buffer_size): m_log_file(file_path)
+{
+    if (m_log_file.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text))
+    {
+        m_file_descriptor = m_log_file.handle();
+    }
+    else
+    {
+        qWarning() << "Failed to open log file:" << file_path;
+    }
+
+    set_buffer_size(buffer_size);
+}
+
+/**
+ * @brief Destroys the FileSink object after writing out the buffer.
+ */
+FileSink::~FileSink()
+{
+    flush();
+}
+
+/**
+ * @brief Returns whether the log file is open.
+ *
+ * @return True if the log file is open, false otherwise.
+ */
+auto FileSink::is_open() const -> bool
+{
+    return m_log_file.isOpen();
+}
+
+/**
+ * @brief Writes a formatted line followed by a line break.
+ *
+ * Without a buffer, the line is written and the file flushed right away. With a buffer, the line
+ * is buffered, and the buffer is written out for warnings and more severe lines.
+ *
+ * @param line The formatted line.
+ * @param type The log level of the line.
+ * @return The number of bytes written or buffered, 0 if the file is not open.
+ */
+auto FileSink::write(const QString& line, QtMsgType type) -> qsizetype
+{
+    qsizetype result = 0;
+
+    if (m_log_file.isOpen())
+    {
+        QByteArray bytes = line.toUtf8();
+        bytes.append('\n');
+
+        QMutexLocker locker(&m_mutex);
+
+        if (m_buffer_size > 0)
+        {
+            append_to_buffer(bytes);
+
+            if (type != QtDebugMsg && type != QtInfoMsg)
+            {
+                flush_buffer();
+            }
+        }
+        else
+        {
+            m_log_file.write(bytes);
+            m_log_file.flush();
+        }
+
+        result = bytes.size();
+    }
+
+    return result;
+}
+
+/**
+ * @brief Writes the buffered lines to the log file.
+ */
+auto FileSink::flush() -> void
+{
+    QMutexLocker locker(&m_mutex);
+    flush_buffer();
+}
+
+/**
+ * @brief Writes the buffered lines to the log file with a plain write() call.
+ *
+ * Only the bytes between m_buffer_written and m_buffer_used are written: a line that was being
+ * copied when the crash happened is left out rather than written half, and lines that a running
+ * flush already wrote are not written twice. m_buffer_written is read first; flush_buffer()
+ * resets m_buffer_used before it, so a reset seen here is seen in both. The buffer is not reset,
+ * since the process is about to die anyway.
+ */
+auto FileSink::emergency_flush() -> void
+{
+    qsizetype written = m_buffer_written.load(std::memory_order_acquire);
+    qsizetype used = m_buffer_used.load(std::memory_order_acquire);
+    const char* data = m_buffer.get();
+
+    while (m_file_descriptor >= 0 && data != nullptr && written < used)
+    {
+        qsizetype count = write_to_file(data + written, used - written);
+
+        if (count <= 0)
+        {
+            break;
+        }
+
+        written += count;
+    }
+}
+
+/**
+ * @brief Sets the size of the write buffer.
+ *
+ * Buffered lines are written out first. The buffer is allocated once here, so writing never
+ * allocates it and a signal handler never sees it move.
+ *
+ * @param bytes The size of the buffer in bytes; 0 writes every line through.
+ */
+auto FileSink::set_buffer_size(qsizetype bytes) -> void
+{
+    QMutexLocker locker(&m_mutex);
+    flush_buffer();
+
+    m_buffer_size = qMax<qsizetype>(bytes, 0);
+    m_buffer = (m_buffer_size > 0) ? std::make_unique<char[]>(m_buffer_size) : nullptr;
+}
+
+/**
+ * @brief Returns the size of the write buffer.
+ *
+ * @return The size of the buffer in bytes, or 0 if lines are written through.
+ */
+auto FileSink::get_buffer_size() const -> qsizetype
+{
+    return m_buffer_size;
+}
+
+/**
+ * @brief Returns the number of bytes in the write buffer.
+ *
+ * @return The number of buffered bytes.
+ */
+auto FileSink::get_buffered_bytes() const -> qsizetype
+{
+    return m_buffer_used.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Copies a line into the buffer, writing the buffer out first if the line does not fit.
+ *
+ * Lines larger than the whole buffer are written directly. The caller must hold m_mutex.
+ *
+ * @param line The UTF-8 encoded line.
+ */
+auto FileSink::append_to_buffer(const QByteArray& line) -> void
+{
+    qsizetype used = m_buffer_used.load(std::memory_order_relaxed);
+
+    if (used + line.size() > m_buffer_size)
+    {
+        flush_buffer();
+        used = 0;
+    }
+
+    if (line.size() > m_buffer_size)
+    {
+        m_log_file.write(line);
+        m_log_file.flush();
+    }
+    else
+    {
+        std::memcpy(m_buffer.get() + used, line.constData(), line.size());
+        m_buffer_used.store(used + line.size(), std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Writes the buffer to the log file and empties it.
+ *
+ * The buffer is written with plain write() calls, like emergency_flush() does, and the number of
+ * written bytes is published after each call. A crash during the flush therefore only writes the
+ * rest of the buffer, apart from the bytes of the one call in flight. Lines that were written
+ * through QFile are flushed before, so the order of the lines is kept. The caller must hold
+ * m_mutex.
+ */
+auto FileSink::flush_buffer() -> void
+{
+    qsizetype used = m_buffer_used.load(std::memory_order_relaxed);
+    qsizetype written = 0;
+
+    if (m_log_file.isOpen() && used > 0)
+    {
+        m_log_file.flush();
+
+        while (written < used)
+        {
+            qsizetype count = write_to_file(m_buffer.get() + written, used - written);
+
+            // Logging the error here would reenter the logger while m_mutex is held
+            if (count <= 0)
+            {
+                break;
+            }
+
+            written += count;
+            m_buffer_written.store(written, std::memory_order_release);
+        }
+
+        m_buffer_used.store(0, std::memory_order_release);
+        m_buffer_written.store(0, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Writes bytes to the log file with one plain write() call, which is async-signal-safe.
+ *
+ * @param data The bytes.
+ * @param size The number of bytes.
+ * @return The number of bytes written, which may be less than size, or -1 on an error.
+ */
+auto FileSink::write_to_file(const char* data, qsizetype size) const -> qsizetype
+{
+#ifdef Q_OS_WIN
+    return static_cast<qsizetype>(
+        _write(m_file_descriptor, data, static_cast<unsigned int>(size)));
+#else
+    return static_cast<qsizetype>(::write(m_file_descriptor, data, static_cast<size_t>(size)));
+#endif
+}
+}  // namespace QmlApp
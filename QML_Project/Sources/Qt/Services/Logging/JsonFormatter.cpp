@@ -0,0 +1,49 @@
+/**
+ * @file JsonFormatter.cpp
+ * @brief This file contains the implementation of the JsonFormatter class.
+ */
+
+#include "Services/Logging/JsonFormatter.h"
+
+#include <QDateTime>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "Services/Logging/LogMetrics.h"
+#include "Services/Logging/StackTrace.h"
+
+namespace QmlApp
+{
+/**
+ * @brief Formats the log message as a single-line JSON object.
+ *
+ * Null context strings are written as empty strings. The stack keys are only present if the
+ * message carries stack frames.
+ *
+ * @param log_message The log message to format.
+ * @param context The context of the log message.
+ * @return The JSON object, without a trailing line break.
+ */
+auto JsonFormatter::format(const LogMessage& log_message,
+                           const QMessageLogContext& context) -> QString
+{
+    QJsonObject object;
+    object.insert(QStringLiteral("time"), log_message.get_date_time().toString(Qt::ISODateWithMs));
+    object.insert(QStringLiteral("level"), LogMetrics::level_name(log_message.get_type()));
+    object.insert(QStringLiteral("category"), QString::fromUtf8(context.category));
+    object.insert(QStringLiteral("file"), QString::fromUtf8(context.file));
+    object.insert(QStringLiteral("line"), context.line);
+    object.insert(QStringLiteral("function"), QString::fromUtf8(context.function));
+    object.insert(QStringLiteral("message"), log_message.get_message());
+
+    if (!log_message.get_stack_frames().isEmpty())
+    {
+        object.insert(QStringLiteral("image_base"), StackTrace::to_hex(StackTrace::image_base()));
+        object.insert(QStringLiteral("stack"), QJsonArray::fromStringList(StackTrace::to_hex(
+                                                   log_message.get_stack_frames())));
+    }
+
+    return QString::fromUtf8(QJsonDocument(object).toJson(QJsonDocument::Compact));
+}
+}  // namespace QmlApp
@@ -0,0 +1,179 @@
+/**
+ * @file LatencyHistogram.cpp
+ * @brief This file contains the implementation of the LatencyHistogram class.
+ */
+
+#include "Services/Logging/LatencyHistogram.h"
+
+#include <bit>
+#include <cmath>
+
+namespace QmlApp
+{
+/**
+ * @brief Returns the value below which the given fraction of samples falls.
+ *
+ * The result is the upper bound of the bucket that contains the requested rank, clamped to the
+ * largest recorded value.
+ *
+ * @param quantile The quantile in the range [0, 1].
+ * @return The latency at the given quantile in nanoseconds, or 0 if no samples were recorded.
+ */
+auto LatencyHistogram::Snapshot::percentile(double quantile) const -> quint64
+{
+    quint64 result = 0;
+
+    if (count > 0)
+    {
+        auto rank = static_cast<quint64>(std::ceil(qBound(0.0, quantile, 1.0) * count));
+        rank = qMax<quint64>(rank, 1);
+        quint64 cumulative = 0;
+
+        for (int i = 0; i < buckets.size(); i++)
+        {
+            cumulative += buckets[i];
+
+            if (cumulative >= rank)
+            {
+                result = qMin(LatencyHistogram::bucket_upper_bound(i), max_ns);
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the number of samples less than or equal to the given value.
+ *
+ * Only buckets whose upper bound does not exceed the value are counted, so the result is exact
+ * at bucket boundaries and a lower bound otherwise.
+ *
+ * @param value_ns The value in nanoseconds.
+ * @return The cumulative sample count.
+ */
+auto LatencyHistogram::Snapshot::count_at_or_below(quint64 value_ns) const -> quint64
+{
+    quint64 result = 0;
+
+    for (int i = 0; i < buckets.size() && LatencyHistogram::bucket_upper_bound(i) <= value_ns; i++)
+    {
+        result += buckets[i];
+    }
+
+    return result;
+}
+
+/**
+ * @brief Records a latency sample.
+ *
+ * @param value_ns The latency in nanoseconds.
+ */
+auto LatencyHistogram::record(quint64 value_ns) -> void
+{
+    m_buckets[bucket_index(value_ns)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sum_ns.fetch_add(value_ns, std::memory_order_relaxed);
+
+    quint64 current_max = m_max_ns.load(std::memory_order_relaxed);
+
+    while (value_ns > current_max &&
+           !m_max_ns.compare_exchange_weak(current_max, value_ns, std::memory_order_relaxed))
+    {
+    }
+}
+
+/**
+ * @brief Returns a snapshot of the current counters.
+ *
+ * The counters are read one by one without stopping writers, so a snapshot taken under load may
+ * be off by the samples recorded while it was taken.
+ *
+ * @return The snapshot.
+ */
+auto LatencyHistogram::snapshot() const -> Snapshot
+{
+    Snapshot result;
+    result.buckets.resize(kBucketCount);
+
+    for (int i = 0; i < kBucketCount; i++)
+    {
+        result.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+    }
+
+    result.count = m_count.load(std::memory_order_relaxed);
+    result.sum_ns = m_sum_ns.load(std::memory_order_relaxed);
+    result.max_ns = m_max_ns.load(std::memory_order_relaxed);
+
+    return result;
+}
+
+/**
+ * @brief Resets all counters to zero.
+ */
+auto LatencyHistogram::reset() -> void
+{
+    for (auto& bucket: m_buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+
+    m_count.store(0, std::memory_order_relaxed);
+    m_sum_ns.store(0, std::memory_order_relaxed);
+    m_max_ns.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the index of the bucket the given value is counted in.
+ *
+ * Values below `kSubBucketCount` get a bucket each. Larger values are grouped by their highest
+ * set bit, and each group is split linearly by the next `kSubBucketBits` bits.
+ *
+ * @param value_ns The value in nanoseconds.
+ * @return The bucket index.
+ */
+auto LatencyHistogram::bucket_index(quint64 value_ns) -> int
+{
+    int result = 0;
+
+    if (value_ns < kSubBucketCount)
+    {
+        result = static_cast<int>(value_ns);
+    }
+    else
+    {
+        int exponent = std::bit_width(value_ns) - 1;
+        int shift = exponent - kSubBucketBits;
+        auto sub_bucket = static_cast<int>((value_ns >> shift) & (kSubBucketCount - 1));
+        result = (shift + 1) * kSubBucketCount + sub_bucket;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the largest value that is counted in the given bucket.
+ *
+ * @param index The bucket index.
+ * @return The inclusive upper bound of the bucket in nanoseconds.
+ */
+auto LatencyHistogram::bucket_upper_bound(int index) -> quint64
+{
+    quint64 result = 0;
+
+    if (index < kSubBucketCount)
+    {
+        result = static_cast<quint64>(index);
+    }
+    else
+    {
+        int shift = index / kSubBucketCount - 1;
+        auto sub_bucket = static_cast<quint64>(index % kSubBucketCount);
+        quint64 lower_bound = (kSubBucketCount + sub_bucket) << shift;
+        result = lower_bound + ((quint64{1} << shift) - 1);
+    }
+
+    return result;
+}
+}  // namespace QmlApp
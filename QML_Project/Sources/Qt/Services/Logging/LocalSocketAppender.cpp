@@ -0,0 +1,105 @@
+/**
+ * @file LocalSocketAppender.cpp
+ * @brief This file contains the implementation of the LocalSocketAppender class.
+ */
+
+#include "Services/Logging/LocalSocketAppender.h"
+
+#include <QtEndian>
+
+namespace QmlApp
+{
+/**
+ * @brief Constructs a LocalSocketAppender object.
+ *
+ * This constructor moves a LocalSocketWorker into a dedicated thread and starts it. The worker
+ * connects to the collector asynchronously, so the constructor returns immediately even if no
+ * collector is running yet. The appender is named "local_socket".
+ *
+ * @param server_name The name of the local server the collector listens on.
+ * @param formatter The formatter to use for formatting log messages.
+ * @param max_batch_bytes The number of queued bytes that triggers an immediate write.
+ * @param max_batch_delay_ms The maximum time in milliseconds a frame waits before it is written.
+ * @param max_spill_bytes The maximum number of bytes kept while the collector is down.
+ */
+LocalSocketAppender::LocalSocketAppender(const QString& server_name,
+                                         const QSharedPointer<LogFormatter>& formatter,
+                                         qsizetype max_batch_bytes, int max_batch_delay_ms,
+                                         qsizetype max_spill_bytes)
+    : LogAppender(formatter),
+      m_worker(new LocalSocketWorker(server_name, max_batch_bytes, max_batch_delay_ms,
+                                     max_spill_bytes))
+{
+    m_name = QStringLiteral("local_socket");
+    m_worker_thread.setObjectName(QStringLiteral("LocalSocketAppender"));
+    m_worker->moveToThread(&m_worker_thread);
+    m_worker_thread.start();
+    QMetaObject::invokeMethod(m_worker, &LocalSocketWorker::start, Qt::QueuedConnection);
+}
+
+/**
+ * @brief Destroys the LocalSocketAppender object.
+ *
+ * The worker is stopped inside its own thread so that the socket and timers are released by the
+ * thread that owns them. Afterwards the thread is shut down and the worker is deleted.
+ */
+LocalSocketAppender::~LocalSocketAppender()
+{
+    QMetaObject::invokeMethod(m_worker, &LocalSocketWorker::stop, Qt::BlockingQueuedConnection);
+    m_worker_thread.quit();
+    m_worker_thread.wait();
+    delete m_worker;
+}
+
+/**
+ * @brief Returns the number of frames dropped because the spill buffer was full.
+ *
+ * @return The number of dropped frames.
+ */
+auto LocalSocketAppender::get_dropped_count() const -> quint64
+{
+    return m_worker->get_dropped_count();
+}
+
+/**
+ * @brief Returns the number of bytes waiting to be shipped to the collector.
+ *
+ * @return The number of pending bytes.
+ */
+auto LocalSocketAppender::get_pending_bytes() const -> qsizetype
+{
+    return m_worker->get_queued_bytes();
+}
+
+/**
+ * @brief Encodes the given payload as a length-prefixed frame.
+ *
+ * @param payload The payload to encode.
+ * @return The payload prefixed with its size as a 32-bit big-endian integer.
+ */
+auto LocalSocketAppender::encode_frame(const QByteArray& payload) -> QByteArray
+{
+    QByteArray frame(sizeof(quint32), Qt::Uninitialized);
+    qToBigEndian<quint32>(static_cast<quint32>(payload.size()), frame.data());
+    frame.append(payload);
+    return frame;
+}
+
+/**
+ * @brief Formats the log message and queues it for shipping.
+ *
+ * The message is formatted and encoded in the calling thread; the socket I/O happens in the
+ * worker thread. The frame size is counted as emitted bytes, even if the frame is later dropped
+ * from the spill buffer.
+ *
+ * @param message The log message to append.
+ * @param context The context of the log message.
+ */
+void LocalSocketAppender::internal_append(const LogMessage& message,
+                                          const QMessageLogContext& context)
+{
+    QByteArray frame = encode_frame(m_formatter->format(message, context).toUtf8());
+    m_metrics.record_bytes(static_cast<quint64>(frame.size()));
+    m_worker->enqueue(std::move(frame));
+}
+}  // namespace QmlApp
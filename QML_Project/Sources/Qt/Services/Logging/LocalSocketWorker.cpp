@@ -0,0 +1,241 @@
+/**
+ * @file LocalSocketWorker.cpp
+ * @brief This file contains the implementation of the LocalSocketWorker class.
+ */
+
+#include "Services/Logging/LocalSocketWorker.h"
+
+#include <QMutexLocker>
+
+namespace QmlApp
+{
+namespace
+{
+constexpr int kInitialReconnectDelayMs = 100;
+constexpr int kMaxReconnectDelayMs = 5000;
+constexpr int kShutdownWriteTimeoutMs = 200;
+}  // namespace
+
+/**
+ * @brief Constructs a LocalSocketWorker object.
+ *
+ * The socket and the timers are not created here, but in `start()`, so that they are owned by the
+ * thread the worker has been moved to.
+ *
+ * @param server_name The name of the local server to connect to.
+ * @param max_batch_bytes The number of queued bytes that triggers an immediate write.
+ * @param max_batch_delay_ms The maximum time in milliseconds a frame waits before it is written.
+ * @param max_spill_bytes The maximum number of bytes kept while the collector is down.
+ * @param parent The parent object.
+ */
+LocalSocketWorker::LocalSocketWorker(QString server_name, qsizetype max_batch_bytes,
+                                     int max_batch_delay_ms, qsizetype max_spill_bytes,
+                                     QObject* parent)
+    : QObject(parent),
+      m_server_name(std::move(server_name)),
+      m_max_batch_bytes(max_batch_bytes),
+      m_max_batch_delay_ms(max_batch_delay_ms),
+      m_max_spill_bytes(max_spill_bytes),
+      m_reconnect_delay_ms(kInitialReconnectDelayMs)
+{}
+
+/**
+ * @brief Queues an encoded frame for shipping.
+ *
+ * The frame is appended to the spill queue. If the queue would exceed its capacity, the oldest
+ * frames are dropped first. When a full batch is queued and the socket is connected, a flush is
+ * posted to the worker thread; at most one flush request is outstanding at any time.
+ *
+ * @param frame The length-prefixed frame to queue.
+ */
+auto LocalSocketWorker::enqueue(QByteArray frame) -> void
+{
+    bool batch_ready = false;
+
+    {
+        QMutexLocker locker(&m_mutex);
+
+        if (frame.size() > m_max_spill_bytes)
+        {
+            m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        while (!m_frames.isEmpty() && m_queued_bytes + frame.size() > m_max_spill_bytes)
+        {
+            m_queued_bytes -= m_frames.dequeue().size();
+            m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        m_queued_bytes += frame.size();
+        m_frames.enqueue(std::move(frame));
+        batch_ready = m_queued_bytes >= m_max_batch_bytes;
+    }
+
+    if (batch_ready && m_connected.load(std::memory_order_relaxed))
+    {
+        request_flush();
+    }
+}
+
+/**
+ * @brief Returns the number of frames dropped because the spill queue was full.
+ *
+ * @return The number of dropped frames.
+ */
+auto LocalSocketWorker::get_dropped_count() const -> quint64
+{
+    return m_dropped_count.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of bytes currently waiting to be shipped.
+ *
+ * @return The number of queued bytes.
+ */
+auto LocalSocketWorker::get_queued_bytes() const -> qsizetype
+{
+    QMutexLocker locker(&m_mutex);
+    return m_queued_bytes;
+}
+
+/**
+ * @brief Creates the socket and timers in the worker thread and connects to the server.
+ *
+ * The batch timer flushes queued frames every `max_batch_delay_ms` milliseconds. Socket errors
+ * and disconnects schedule a reconnect attempt with exponential backoff.
+ */
+void LocalSocketWorker::start()
+{
+    m_socket = new QLocalSocket(this);
+
+    m_batch_timer = new QTimer(this);
+    m_batch_timer->setInterval(m_max_batch_delay_ms);
+    connect(m_batch_timer, &QTimer::timeout, this, &LocalSocketWorker::flush);
+
+    m_reconnect_timer = new QTimer(this);
+    m_reconnect_timer->setSingleShot(true);
+    connect(m_reconnect_timer, &QTimer::timeout, this, &LocalSocketWorker::connect_to_server);
+
+    connect(m_socket, &QLocalSocket::connected, this, [this]() {
+        m_connected.store(true, std::memory_order_relaxed);
+        m_reconnect_delay_ms = kInitialReconnectDelayMs;
+        flush();
+    });
+    connect(m_socket, &QLocalSocket::disconnected, this, [this]() {
+        m_connected.store(false, std::memory_order_relaxed);
+        schedule_reconnect();
+    });
+    connect(m_socket, &QLocalSocket::errorOccurred, this, [this](QLocalSocket::LocalSocketError) {
+        m_connected.store(false, std::memory_order_relaxed);
+        schedule_reconnect();
+    });
+
+    m_batch_timer->start();
+    connect_to_server();
+}
+
+/**
+ * @brief Writes all queued frames to the socket if it is connected.
+ *
+ * The queued frames are concatenated into one batch and handed to the socket with a single write.
+ * While the socket still has more than one batch of unwritten data, the frames stay in the spill
+ * queue so that a slow collector cannot grow the socket buffer without bound.
+ */
+void LocalSocketWorker::flush()
+{
+    m_flush_requested.store(false, std::memory_order_relaxed);
+
+    if (m_socket == nullptr || m_socket->state() != QLocalSocket::ConnectedState ||
+        m_socket->bytesToWrite() >= m_max_batch_bytes)
+    {
+        return;
+    }
+
+    QByteArray batch;
+
+    {
+        QMutexLocker locker(&m_mutex);
+        batch.reserve(m_queued_bytes);
+
+        while (!m_frames.isEmpty())
+        {
+            batch.append(m_frames.dequeue());
+        }
+
+        m_queued_bytes = 0;
+    }
+
+    if (!batch.isEmpty())
+    {
+        m_socket->write(batch);
+        m_socket->flush();
+    }
+}
+
+/**
+ * @brief Flushes pending frames, disconnects and releases the socket and timers.
+ *
+ * Pending data is given a short grace period to reach the collector. This is the only place
+ * where the worker waits on the socket, and it is only called on shutdown.
+ */
+void LocalSocketWorker::stop()
+{
+    flush();
+
+    delete m_batch_timer;
+    m_batch_timer = nullptr;
+    delete m_reconnect_timer;
+    m_reconnect_timer = nullptr;
+
+    if (m_socket != nullptr)
+    {
+        m_socket->disconnect(this);
+
+        if (m_socket->state() == QLocalSocket::ConnectedState)
+        {
+            m_socket->waitForBytesWritten(kShutdownWriteTimeoutMs);
+            m_socket->disconnectFromServer();
+        }
+
+        delete m_socket;
+        m_socket = nullptr;
+    }
+
+    m_connected.store(false, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Starts a non-blocking connection attempt if the socket is not connected.
+ */
+auto LocalSocketWorker::connect_to_server() -> void
+{
+    if (m_socket != nullptr && m_socket->state() == QLocalSocket::UnconnectedState)
+    {
+        m_socket->connectToServer(m_server_name);
+    }
+}
+
+/**
+ * @brief Schedules the next connection attempt and doubles the backoff delay.
+ */
+auto LocalSocketWorker::schedule_reconnect() -> void
+{
+    if (m_reconnect_timer != nullptr && !m_reconnect_timer->isActive())
+    {
+        m_reconnect_timer->start(m_reconnect_delay_ms);
+        m_reconnect_delay_ms = qMin(m_reconnect_delay_ms * 2, kMaxReconnectDelayMs);
+    }
+}
+
+/**
+ * @brief Posts a flush to the worker thread unless one is already pending.
+ */
+auto LocalSocketWorker::request_flush() -> void
+{
+    if (!m_flush_requested.exchange(true, std::memory_order_relaxed))
+    {
+        QMetaObject::invokeMethod(this, &LocalSocketWorker::flush, Qt::QueuedConnection);
+    }
+}
+}  // namespace QmlApp
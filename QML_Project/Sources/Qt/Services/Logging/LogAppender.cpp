@@ -1,5 +1,7 @@
 #include "Services/Logging/LogAppender.h"
 
+#include <chrono>
+
 namespace QmlApp
 {
 /**
@@ -28,7 +30,10 @@ LogAppender::LogAppender(const QSharedPointer<LogFormatter>& formatter)
  * @brief Appends a log message to the log appender.
  *
  * This method checks if the log message type is greater than or equal to the log level
- * of the appender. If it is, the message is appended by calling the internal_append method.
+ * of the appender. If it is, the message is appended by calling the internal_append method. For
+ * every n-th accepted message, n being the latency sample interval, the time spent in
+ * internal_append is recorded in the latency histogram of the appender; the other messages do not
+ * read the clock. Otherwise the message is counted as filtered.
  *
  * @param message The log message to append.
  * @param context The context of the log message.
@@ -37,7 +42,27 @@ auto LogAppender::append(const LogMessage& message, const QMessageLogContext& co
 {
     if (message.get_type() >= m_log_level)
     {
-        internal_append(message, context);
+        quint64 accepted = m_accepted_count.fetch_add(1, std::memory_order_relaxed);
+        bool timed = m_latency_sample_interval != 0 && accepted % m_latency_sample_interval == 0;
+
+        if (timed)
+        {
+            auto start = std::chrono::steady_clock::now();
+            internal_append(message, context);
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            m_metrics.record_latency(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+        else
+        {
+            internal_append(message, context);
+        }
+
+        m_metrics.record_accepted(message.get_type());
+    }
+    else
+    {
+        m_metrics.record_filtered();
     }
 }
 
@@ -78,4 +103,68 @@ auto LogAppender::get_log_level() const -> QtMsgType
     return m_log_level;
 }
 
+/**
+ * @brief Returns the name of the log appender.
+ *
+ * @return The name of the log appender.
+ */
+auto LogAppender::get_name() const -> QString
+{
+    return m_name;
+}
+
+/**
+ * @brief Sets the name of the log appender.
+ *
+ * @param name The name to set.
+ */
+auto LogAppender::set_name(const QString& name) -> void
+{
+    m_name = name;
+}
+
+/**
+ * @brief Returns the metrics of the log appender.
+ *
+ * @return The metrics of the log appender.
+ */
+auto LogAppender::get_metrics() const -> const LogMetrics&
+{
+    return m_metrics;
+}
+
+/**
+ * @brief Sets how often the latency of an append is measured.
+ *
+ * @param interval The sample interval; 1 times every record, 0 disables timing.
+ */
+auto LogAppender::set_latency_sample_interval(quint32 interval) -> void
+{
+    m_latency_sample_interval = interval;
+}
+
+/**
+ * @brief Returns how often the latency of an append is measured.
+ *
+ * @return The sample interval; 0 if timing is disabled.
+ */
+auto LogAppender::get_latency_sample_interval() const -> quint32
+{
+    return m_latency_sample_interval;
+}
+
+/**
+ * @brief Writes out any data the appender has buffered.
+ *
+ * The default implementation does nothing, for appenders that do not buffer.
+ */
+auto LogAppender::flush() -> void {}
+
+/**
+ * @brief Writes out buffered data from a crash signal handler.
+ *
+ * The default implementation does nothing. Appenders that buffer encoded data override this with
+ * an async-signal-safe implementation.
+ */
+auto LogAppender::emergency_flush() -> void {}
 }  // namespace QmlApp
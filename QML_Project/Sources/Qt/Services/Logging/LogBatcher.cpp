@@ -0,0 +1,288 @@
+/**
+ * @file LogBatcher.cpp
+ * @brief This file contains the implementation of the LogBatcher class.
+ */
+
+#include "Services/Logging/LogBatcher.h"
+
+#include <queue>
+#include <utility>
+
+namespace QmlApp
+{
+namespace
+{
+std::atomic<quint64> g_next_batcher_id = 1;
+
+// The batcher whose records the calling thread is passing to the consumer
+thread_local const LogBatcher* t_draining_batcher = nullptr;
+}  // namespace
+
+/**
+ * @brief Constructs a LogBatcher object and starts its writer thread.
+ *
+ * @param consumer The function the staged records are passed to.
+ * @param max_batch_size The number of records in a staging buffer that triggers a drain.
+ * @param max_batch_delay_ms The maximum time in milliseconds a record stays staged.
+ */
+LogBatcher::LogBatcher(Consumer consumer, qsizetype max_batch_size, int max_batch_delay_ms)
+    : m_consumer(std::move(consumer)),
+      m_max_batch_size(qMax<qsizetype>(1, max_batch_size)),
+      m_max_batch_delay_ms(qMax(1, max_batch_delay_ms)),
+      m_id(g_next_batcher_id.fetch_add(1, std::memory_order_relaxed)),
+      m_writer_thread(QThread::create([this]() { run(); }))
+{
+    m_writer_thread->setObjectName(QStringLiteral("LogBatcher"));
+    m_writer_thread->start();
+}
+
+/**
+ * @brief Destroys the LogBatcher object.
+ *
+ * The writer thread is stopped and all staged records are passed to the consumer.
+ */
+LogBatcher::~LogBatcher()
+{
+    {
+        QMutexLocker locker(&m_wake_mutex);
+        m_stopping = true;
+        m_wake_condition.wakeOne();
+    }
+
+    m_writer_thread->wait();
+    drain();
+}
+
+/**
+ * @brief Stages a record in the staging buffer of the calling thread.
+ *
+ * Only the buffer of the calling thread is locked, so concurrent producers do not contend with
+ * each other. The writer is woken immediately if the buffer reached the batch size or the record
+ * is a warning or more severe, and otherwise only when the first record after an idle period
+ * starts the batch delay.
+ *
+ * @param record The record to stage.
+ */
+auto LogBatcher::stage(LogRecord record) -> void
+{
+    bool urgent = (record.type != QtDebugMsg && record.type != QtInfoMsg);
+    StagingBuffer& buffer = staging_buffer();
+    qsizetype previous_pending = m_pending.fetch_add(1, std::memory_order_relaxed);
+    qsizetype staged = 0;
+
+    {
+        QMutexLocker locker(&buffer.mutex);
+        buffer.records.push_back(std::move(record));
+        staged = static_cast<qsizetype>(buffer.records.size());
+    }
+
+    if (urgent || staged >= m_max_batch_size)
+    {
+        request_drain();
+    }
+    else if (previous_pending == 0)
+    {
+        QMutexLocker locker(&m_wake_mutex);
+        m_wake_condition.wakeOne();
+    }
+}
+
+/**
+ * @brief Passes all staged records to the consumer in the calling thread.
+ *
+ * Records staged by other threads while the flush is running may be left for the writer.
+ * A consumer that flushes, e.g. before a fatal message, is already inside a drain, so the call
+ * returns without draining again; the running drain passes the remaining records on.
+ */
+auto LogBatcher::flush() -> void
+{
+    if (t_draining_batcher != this)
+    {
+        drain();
+    }
+}
+
+/**
+ * @brief Returns the number of records that were staged but not yet consumed.
+ *
+ * @return The number of pending records.
+ */
+auto LogBatcher::pending_record_count() const -> qsizetype
+{
+    return m_pending.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of registered staging buffers.
+ *
+ * Buffers of threads that have finished are removed on the next drain.
+ *
+ * @return The number of staging buffers.
+ */
+auto LogBatcher::get_staging_buffer_count() const -> qsizetype
+{
+    QMutexLocker locker(&m_registry_mutex);
+    return static_cast<qsizetype>(m_buffers.size());
+}
+
+/**
+ * @brief Returns the number of records in a staging buffer that triggers a drain.
+ *
+ * @return The maximum batch size.
+ */
+auto LogBatcher::get_max_batch_size() const -> qsizetype
+{
+    return m_max_batch_size;
+}
+
+/**
+ * @brief Returns the maximum time in milliseconds a record stays staged.
+ *
+ * @return The maximum batch delay.
+ */
+auto LogBatcher::get_max_batch_delay_ms() const -> int
+{
+    return m_max_batch_delay_ms;
+}
+
+/**
+ * @brief Returns the staging buffer of the calling thread, registering it on first use.
+ *
+ * The buffer is owned jointly by the thread and the registry, so records staged shortly before
+ * a thread finishes are still drained.
+ *
+ * @return The staging buffer.
+ */
+auto LogBatcher::staging_buffer() -> StagingBuffer&
+{
+    thread_local quint64 t_batcher_id = 0;
+    thread_local std::shared_ptr<StagingBuffer> t_buffer;
+
+    if (t_batcher_id != m_id)
+    {
+        t_buffer = std::make_shared<StagingBuffer>();
+        t_buffer->records.reserve(m_max_batch_size);
+        t_batcher_id = m_id;
+
+        QMutexLocker locker(&m_registry_mutex);
+        m_buffers.push_back(t_buffer);
+    }
+
+    return *t_buffer;
+}
+
+/**
+ * @brief Wakes the writer to drain all staging buffers without waiting for the batch delay.
+ */
+auto LogBatcher::request_drain() -> void
+{
+    if (!m_drain_requested.exchange(true))
+    {
+        QMutexLocker locker(&m_wake_mutex);
+        m_wake_condition.wakeOne();
+    }
+}
+
+/**
+ * @brief The loop of the writer thread.
+ *
+ * The writer sleeps while nothing is staged. Once a record is staged, it waits for the batch
+ * delay or a drain request, whichever comes first, and then drains all staging buffers.
+ */
+auto LogBatcher::run() -> void
+{
+    bool stopping = false;
+
+    while (!stopping)
+    {
+        {
+            QMutexLocker locker(&m_wake_mutex);
+
+            while (!m_stopping && !m_drain_requested.load() && m_pending.load() == 0)
+            {
+                m_wake_condition.wait(&m_wake_mutex);
+            }
+
+            if (!m_stopping && !m_drain_requested.load())
+            {
+                m_wake_condition.wait(&m_wake_mutex,
+                                      static_cast<unsigned long>(m_max_batch_delay_ms));
+            }
+
+            stopping = m_stopping;
+        }
+
+        m_drain_requested.store(false);
+        drain();
+    }
+}
+
+/**
+ * @brief Takes the records of all staging buffers and passes them to the consumer.
+ *
+ * The records of each buffer are already ordered by sequence number, so the batches are merged
+ * with a k-way merge instead of being sorted.
+ */
+auto LogBatcher::drain() -> void
+{
+    QMutexLocker drain_locker(&m_drain_mutex);
+    const LogBatcher* previous_draining_batcher = std::exchange(t_draining_batcher, this);
+    std::vector<Batch> batches;
+
+    {
+        QMutexLocker registry_locker(&m_registry_mutex);
+        auto it = m_buffers.begin();
+
+        while (it != m_buffers.end())
+        {
+            {
+                QMutexLocker locker(&(*it)->mutex);
+
+                if (!(*it)->records.empty())
+                {
+                    batches.push_back(std::exchange((*it)->records, Batch()));
+                }
+            }
+
+            // Only the registry still refers to the buffers of threads that have finished
+            if (it->use_count() == 1)
+            {
+                it = m_buffers.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    // The sequence number of the next record of each batch, and the index of the batch
+    using Head = std::pair<quint64, size_t>;
+    std::priority_queue<Head, std::vector<Head>, std::greater<>> heads;
+    std::vector<size_t> positions(batches.size(), 0);
+    qsizetype consumed = 0;
+
+    for (size_t i = 0; i < batches.size(); i++)
+    {
+        heads.emplace(batches[i].front().sequence, i);
+    }
+
+    while (!heads.empty())
+    {
+        size_t index = heads.top().second;
+        heads.pop();
+
+        const Batch& batch = batches[index];
+        m_consumer(batch[positions[index]]);
+        consumed++;
+
+        if (++positions[index] < batch.size())
+        {
+            heads.emplace(batch[positions[index]].sequence, index);
+        }
+    }
+
+    m_pending.fetch_sub(consumed, std::memory_order_relaxed);
+    t_draining_batcher = previous_draining_batcher;
+}
+}  // namespace QmlApp
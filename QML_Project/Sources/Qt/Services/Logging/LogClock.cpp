@@ -0,0 +1,380 @@
+/**
+ * @file LogClock.cpp
+ * @brief This file contains the implementation of the LogClock class.
+ */
+
+#include "Services/Logging/LogClock.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <mutex>
+
+#if defined(Q_PROCESSOR_X86) && defined(Q_CC_MSVC)
+#include <intrin.h>
+#define QMLAPP_LOG_CLOCK_HAS_TSC
+#elif defined(Q_PROCESSOR_X86) && (defined(Q_CC_GNU) || defined(Q_CC_CLANG))
+#include <cpuid.h>
+#include <x86intrin.h>
+#define QMLAPP_LOG_CLOCK_HAS_TSC
+#endif
+
+namespace QmlApp
+{
+namespace
+{
+constexpr qint64 kInitialCalibrationNs = 2000000;
+constexpr qint64 kRefineIntervalNs = 1000000000;
+constexpr qint64 kSegmentLeadNs = 1000000;
+constexpr qsizetype kMaxSegments = 40;
+
+/**
+ * @brief Returns whether the processor has a TSC that runs at a constant rate in all states.
+ *
+ * @return True if the invariant TSC flag (CPUID 0x80000007, EDX bit 8) is set.
+ */
+auto has_invariant_tsc() -> bool
+{
+    bool invariant = false;
+
+#if defined(QMLAPP_LOG_CLOCK_HAS_TSC) && defined(Q_CC_MSVC)
+    int registers[4] = {};
+    __cpuid(registers, static_cast<int>(0x80000000));
+
+    if (static_cast<unsigned int>(registers[0]) >= 0x80000007U)
+    {
+        __cpuid(registers, static_cast<int>(0x80000007));
+        invariant = (registers[3] & (1 << 8)) != 0;
+    }
+#elif defined(QMLAPP_LOG_CLOCK_HAS_TSC)
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) != 0)
+    {
+        invariant = (edx & (1U << 8)) != 0;
+    }
+#endif
+
+    return invariant;
+}
+
+/**
+ * @brief Returns the first source that is available on this system.
+ *
+ * @return The source.
+ */
+auto detect_source() -> LogClock::Source
+{
+    LogClock::Source result = LogClock::Source::SteadyClock;
+
+    if (has_invariant_tsc())
+    {
+        result = LogClock::Source::Tsc;
+    }
+    else
+    {
+#if defined(CLOCK_MONOTONIC_COARSE)
+        result = LogClock::Source::MonotonicCoarse;
+#elif defined(CLOCK_MONOTONIC) && !defined(Q_OS_WIN)
+        result = LogClock::Source::Monotonic;
+#endif
+    }
+
+    return result;
+}
+
+/**
+ * @brief Reads the counter of the given source.
+ *
+ * All sources except the TSC count nanoseconds.
+ *
+ * @param source The source.
+ * @return The counter value.
+ */
+auto read_counter(LogClock::Source source) -> quint64
+{
+    quint64 result = 0;
+
+    switch (source)
+    {
+#if defined(QMLAPP_LOG_CLOCK_HAS_TSC)
+    case LogClock::Source::Tsc:
+        result = __rdtsc();
+        break;
+#endif
+#if defined(CLOCK_MONOTONIC_COARSE) || (defined(CLOCK_MONOTONIC) && !defined(Q_OS_WIN))
+    case LogClock::Source::MonotonicCoarse:
+    case LogClock::Source::Monotonic:
+    {
+        timespec time{};
+#if defined(CLOCK_MONOTONIC_COARSE)
+        clock_gettime((source == LogClock::Source::MonotonicCoarse) ? CLOCK_MONOTONIC_COARSE
+                                                                    : CLOCK_MONOTONIC,
+                      &time);
+#else
+        clock_gettime(CLOCK_MONOTONIC, &time);
+#endif
+        result = static_cast<quint64>(time.tv_sec) * 1000000000ULL +
+                 static_cast<quint64>(time.tv_nsec);
+        break;
+    }
+#endif
+    default:
+        result = static_cast<quint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          std::chrono::steady_clock::now().time_since_epoch())
+                                          .count());
+        break;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the steady clock in nanoseconds.
+ *
+ * @return The time since the steady clock's epoch.
+ */
+auto steady_nanoseconds() -> qint64
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/**
+ * @struct Segment
+ * @brief A piece of the conversion from ticks to wall time, valid from its first tick on.
+ */
+struct Segment {
+        quint64 base_ticks = 0;
+        qint64 base_wall_ns = 0;
+        double nanoseconds_per_tick = 1.0;
+
+        /**
+         * @brief Converts ticks with the rate of this segment.
+         *
+         * @param ticks A value returned by LogClock::now().
+         * @return The wall time in nanoseconds since the epoch.
+         */
+        [[nodiscard]] auto to_wall_ns(quint64 ticks) const -> qint64
+        {
+            auto delta_ticks = static_cast<double>(static_cast<qint64>(ticks - base_ticks));
+            return base_wall_ns + qRound64(delta_ticks * nanoseconds_per_tick);
+        }
+};
+
+/**
+ * @struct Calibration
+ * @brief The reference point of the clock and the segments of the conversion.
+ *
+ * Every refinement of the TSC rate appends a segment that starts where the previous one ends, at
+ * a tick shortly after the refinement. Published segments never change, so a tick converts to the
+ * same wall time whenever it is converted, and later ticks never convert to an earlier time.
+ */
+struct Calibration {
+        LogClock::Source source = detect_source();
+        quint64 base_ticks = read_counter(source);
+        qint64 base_steady_ns = steady_nanoseconds();
+        qint64 base_wall_ms = QDateTime::currentMSecsSinceEpoch();
+        std::array<Segment, kMaxSegments> segments{};
+        std::atomic<qsizetype> segment_count = 0;
+        std::atomic<qint64> next_refine_steady_ns = base_steady_ns + kRefineIntervalNs;
+        std::mutex refine_mutex;
+
+        /**
+         * @brief Takes the reference point, which pairs a counter value with the wall time.
+         *
+         * For the TSC, the rate is then measured by spinning for kInitialCalibrationNs against
+         * the steady clock.
+         */
+        Calibration()
+        {
+            Segment& first = segments[0];
+            first.base_ticks = base_ticks;
+            first.base_wall_ns = base_wall_ms * 1000000;
+
+            if (source == LogClock::Source::Tsc)
+            {
+                qint64 elapsed_ns = 0;
+                quint64 ticks = base_ticks;
+
+                while (elapsed_ns < kInitialCalibrationNs)
+                {
+                    ticks = read_counter(source);
+                    elapsed_ns = steady_nanoseconds() - base_steady_ns;
+                }
+
+                first.nanoseconds_per_tick =
+                    static_cast<double>(elapsed_ns) / static_cast<double>(ticks - base_ticks);
+            }
+
+            segment_count.store(1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Returns the segment that converts the given ticks.
+         *
+         * @param ticks A value returned by LogClock::now().
+         * @return The last segment that starts at or before the ticks, or the first segment.
+         */
+        [[nodiscard]] auto segment_for(quint64 ticks) const -> const Segment&
+        {
+            qsizetype index = segment_count.load(std::memory_order_acquire) - 1;
+
+            while (index > 0 && static_cast<qint64>(ticks - segments[index].base_ticks) < 0)
+            {
+                --index;
+            }
+
+            return segments[index];
+        }
+};
+
+/**
+ * @brief Returns the calibration, taking it on first use.
+ *
+ * @return The calibration.
+ */
+auto calibration() -> Calibration&
+{
+    static Calibration instance;
+    return instance;
+}
+
+/**
+ * @brief Measures the TSC rate again over the whole time since the reference point.
+ *
+ * The longer the interval, the smaller the error of the rate, so the interval between
+ * refinements doubles, starting at kRefineIntervalNs, until kMaxSegments segments exist. The new
+ * rate applies from kSegmentLeadNs after the counter is read on, so no tick that is converted
+ * before the segment is published falls into it. Concurrent callers skip the refinement.
+ *
+ * @param state The calibration.
+ */
+auto refine(Calibration& state) -> void
+{
+    qint64 steady_ns = steady_nanoseconds();
+
+    if (state.source == LogClock::Source::Tsc &&
+        steady_ns >= state.next_refine_steady_ns.load(std::memory_order_relaxed))
+    {
+        std::unique_lock<std::mutex> lock(state.refine_mutex, std::try_to_lock);
+        qsizetype count = state.segment_count.load(std::memory_order_relaxed);
+
+        if (lock.owns_lock() && count < kMaxSegments &&
+            steady_ns >= state.next_refine_steady_ns.load(std::memory_order_relaxed))
+        {
+            quint64 ticks = read_counter(state.source);
+            const Segment& previous = state.segments[count - 1];
+            Segment& next = state.segments[count];
+
+            next.nanoseconds_per_tick = static_cast<double>(steady_ns - state.base_steady_ns) /
+                                        static_cast<double>(ticks - state.base_ticks);
+            next.base_ticks =
+                ticks + static_cast<quint64>(kSegmentLeadNs / previous.nanoseconds_per_tick);
+            next.base_wall_ns = previous.to_wall_ns(next.base_ticks);
+
+            state.segment_count.store(count + 1, std::memory_order_release);
+            state.next_refine_steady_ns.store(steady_ns + (steady_ns - state.base_steady_ns),
+                                              std::memory_order_relaxed);
+        }
+    }
+}
+}  // namespace
+
+/**
+ * @brief Returns the current value of the counter.
+ *
+ * The first call takes the calibration; later calls only read the counter.
+ *
+ * @return The number of ticks; only differences and conversions are meaningful.
+ */
+auto LogClock::now() -> quint64
+{
+    static const Source kSource = calibration().source;
+    return read_counter(kSource);
+}
+
+/**
+ * @brief Converts ticks to milliseconds since the Unix epoch.
+ *
+ * Ticks taken before the reference point are converted as well. The result for a given tick
+ * does not change when the rate is refined.
+ *
+ * @param ticks A value returned by now().
+ * @return The wall time in milliseconds since the epoch.
+ */
+auto LogClock::to_msecs_since_epoch(quint64 ticks) -> qint64
+{
+    Calibration& state = calibration();
+    refine(state);
+
+    return state.segment_for(ticks).to_wall_ns(ticks) / 1000000;
+}
+
+/**
+ * @brief Converts ticks to a local date and time.
+ *
+ * @param ticks A value returned by now().
+ * @return The local date and time.
+ */
+auto LogClock::to_date_time(quint64 ticks) -> QDateTime
+{
+    return QDateTime::fromMSecsSinceEpoch(to_msecs_since_epoch(ticks));
+}
+
+/**
+ * @brief Returns the counter the clock reads.
+ *
+ * @return The source.
+ */
+auto LogClock::source() -> Source
+{
+    return calibration().source;
+}
+
+/**
+ * @brief Returns a readable name of the counter the clock reads.
+ *
+ * @return The name: "tsc", "monotonic_coarse", "monotonic" or "steady_clock".
+ */
+auto LogClock::source_name() -> QString
+{
+    QString result;
+
+    switch (source())
+    {
+    case Source::Tsc:
+        result = QStringLiteral("tsc");
+        break;
+    case Source::MonotonicCoarse:
+        result = QStringLiteral("monotonic_coarse");
+        break;
+    case Source::Monotonic:
+        result = QStringLiteral("monotonic");
+        break;
+    default:
+        result = QStringLiteral("steady_clock");
+        break;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the current estimate of the counter rate.
+ *
+ * @return The number of ticks per second.
+ */
+auto LogClock::ticks_per_second() -> double
+{
+    const Calibration& state = calibration();
+    qsizetype count = state.segment_count.load(std::memory_order_acquire);
+
+    return 1e9 / state.segments[count - 1].nanoseconds_per_tick;
+}
+}  // namespace QmlApp
@@ -0,0 +1,458 @@
+/**
+ * @file LogFileReader.cpp
+ * @brief This file contains the implementation of the LogFileReader class.
+ */
+
+#include "Services/Logging/LogFileReader.h"
+
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <QtConcurrent/QtConcurrent>
+#include <bit>
+#include <cstring>
+
+namespace QmlApp
+{
+namespace
+{
+// Indexed synchronously in open(), so the first screen of lines is available immediately.
+constexpr qint64 kInitialIndexBytes = 256 * 1024;
+// The background indexer publishes its progress after every chunk of this size.
+constexpr qint64 kIndexChunkBytes = 4 * 1024 * 1024;
+}  // namespace
+
+/**
+ * @brief Constructs a LogFileReader object.
+ *
+ * @param parent The parent object.
+ */
+LogFileReader::LogFileReader(QObject* parent): QObject(parent)
+{
+    connect(&m_follow_timer, &QTimer::timeout, this, &LogFileReader::refresh);
+}
+
+/**
+ * @brief Closes the file and stops indexing.
+ */
+LogFileReader::~LogFileReader()
+{
+    close();
+}
+
+/**
+ * @brief Opens and maps the given file and starts indexing it.
+ *
+ * The first part of the file is indexed before this method returns, the rest in a background
+ * thread. `lineCountChanged()` is emitted as the index grows and `indexingFinished()` once it is
+ * complete. A previously opened file is closed first.
+ *
+ * @param file_path The path of the log file.
+ * @return True if the file was opened, false otherwise.
+ */
+auto LogFileReader::open(const QString& file_path) -> bool
+{
+    bool result = false;
+    close();
+    m_file.setFileName(file_path);
+
+    if (m_file.open(QIODevice::ReadOnly))
+    {
+        result = map_file();
+
+        if (result)
+        {
+            qint64 initial_end = qMin(m_mapped_size, kInitialIndexBytes);
+            index_range(m_data, 0, initial_end);
+
+            if (initial_end < m_mapped_size)
+            {
+                start_indexing(initial_end, m_mapped_size);
+            }
+
+            emit lineCountChanged();
+        }
+        else
+        {
+            m_file.close();
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Stops indexing, unmaps and closes the file.
+ */
+auto LogFileReader::close() -> void
+{
+    m_cancel = true;
+    m_index_future.waitForFinished();
+    m_cancel = false;
+
+    if (m_data != nullptr)
+    {
+        m_file.unmap(m_data);
+        m_data = nullptr;
+    }
+
+    m_file.close();
+    m_mapped_size = 0;
+    m_refresh_pending = false;
+
+    QMutexLocker locker(&m_mutex);
+    m_line_ends.clear();
+    m_indexed_end = 0;
+    m_indexing = false;
+}
+
+/**
+ * @brief Returns whether a file is open.
+ *
+ * @return True if a file is open, false otherwise.
+ */
+auto LogFileReader::is_open() const -> bool
+{
+    return m_file.isOpen();
+}
+
+/**
+ * @brief Returns whether the background index is still being built.
+ *
+ * @return True while indexing, false otherwise.
+ */
+auto LogFileReader::is_indexing() const -> bool
+{
+    return m_indexing;
+}
+
+/**
+ * @brief Blocks until the background index is complete.
+ */
+auto LogFileReader::wait_for_index() -> void
+{
+    m_index_future.waitForFinished();
+}
+
+/**
+ * @brief Returns the number of lines indexed so far.
+ *
+ * Trailing bytes after the last newline count as a line once indexing is complete.
+ *
+ * @return The number of lines.
+ */
+auto LogFileReader::line_count() const -> qint64
+{
+    QMutexLocker locker(&m_mutex);
+    qint64 count = m_line_ends.size();
+    qint64 last_start = m_line_ends.isEmpty() ? 0 : m_line_ends.last() + 1;
+
+    if (!m_indexing && m_indexed_end > last_start)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Returns the raw bytes of the given line without the line terminator.
+ *
+ * Both "\n" and "\r\n" line terminators are stripped. The lookup takes constant time.
+ *
+ * @param line_number The zero-based line number.
+ * @return The line, or an empty byte array if the line is not indexed.
+ */
+auto LogFileReader::line_bytes(qint64 line_number) const -> QByteArray
+{
+    QByteArray result;
+    qint64 start = -1;
+    qint64 end = -1;
+
+    {
+        QMutexLocker locker(&m_mutex);
+
+        if (line_number >= 0 && line_number < m_line_ends.size())
+        {
+            start = line_number == 0 ? 0 : m_line_ends[line_number - 1] + 1;
+            end = m_line_ends[line_number];
+        }
+        else if (line_number == m_line_ends.size() && !m_indexing)
+        {
+            start = m_line_ends.isEmpty() ? 0 : m_line_ends.last() + 1;
+            end = m_indexed_end;
+        }
+    }
+
+    if (start >= 0 && end > start)
+    {
+        if (m_data[end - 1] == '\r')
+        {
+            end--;
+        }
+
+        result = QByteArray(reinterpret_cast<const char*>(m_data + start), end - start);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the given line decoded as UTF-8 without the line terminator.
+ *
+ * @param line_number The zero-based line number.
+ * @return The line, or an empty string if the line is not indexed.
+ */
+auto LogFileReader::line(qint64 line_number) const -> QString
+{
+    return QString::fromUtf8(line_bytes(line_number));
+}
+
+/**
+ * @brief Returns the number of mapped bytes.
+ *
+ * @return The size of the mapped part of the file.
+ */
+auto LogFileReader::get_mapped_size() const -> qint64
+{
+    return m_mapped_size;
+}
+
+/**
+ * @brief Enables or disables following the file as it grows.
+ *
+ * While following, `refresh()` is called every `interval_ms` milliseconds.
+ *
+ * @param follow Whether to follow the file.
+ * @param interval_ms The polling interval in milliseconds.
+ */
+auto LogFileReader::set_follow(bool follow, int interval_ms) -> void
+{
+    if (follow)
+    {
+        m_follow_timer.start(qMax(interval_ms, 1));
+    }
+    else
+    {
+        m_follow_timer.stop();
+    }
+}
+
+/**
+ * @brief Returns whether the file is followed as it grows.
+ *
+ * @return True if following, false otherwise.
+ */
+auto LogFileReader::is_following() const -> bool
+{
+    return m_follow_timer.isActive();
+}
+
+/**
+ * @brief Checks the file size and indexes data appended since the last check.
+ *
+ * If the file grew, it is mapped again and only the appended bytes are indexed. If it shrank, it
+ * was truncated or replaced, so it is reopened from scratch and `fileReset()` is emitted. While
+ * the background indexer is running, the check is deferred until it has finished.
+ */
+auto LogFileReader::refresh() -> void
+{
+    if (!is_open())
+    {
+        return;
+    }
+
+    if (m_indexing)
+    {
+        m_refresh_pending = true;
+        return;
+    }
+
+    qint64 size = QFileInfo(m_file.fileName()).size();
+
+    if (size < m_mapped_size)
+    {
+        QString file_path = m_file.fileName();
+        open(file_path);
+        emit fileReset();
+    }
+    else if (size > m_mapped_size)
+    {
+        qint64 from = m_indexed_end;
+
+        if (map_file())
+        {
+            start_indexing(from, m_mapped_size);
+        }
+    }
+}
+
+/**
+ * @brief Finds the first newline in the given range, scanning eight bytes at a time.
+ *
+ * Each 64-bit word is XORed with a word of newline bytes, so newline bytes become zero, and the
+ * classic "has zero byte" bit trick locates the first zero byte without a per-byte branch. The
+ * lowest flagged byte is always exact, which is the one needed on little-endian machines; other
+ * platforms use the byte-wise loop that also handles the tail of the range.
+ *
+ * @param begin The start of the range.
+ * @param end The end of the range.
+ * @return A pointer to the first newline, or `end` if the range has none.
+ */
+auto LogFileReader::find_newline(const uchar* begin, const uchar* end) -> const uchar*
+{
+    constexpr quint64 kOnes = 0x0101010101010101ULL;
+    constexpr quint64 kHighBits = 0x8080808080808080ULL;
+    constexpr quint64 kNewlines = kOnes * '\n';
+
+    const uchar* cursor = begin;
+    const uchar* result = nullptr;
+
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        while (result == nullptr && end - cursor >= 8)
+        {
+            quint64 word = 0;
+            std::memcpy(&word, cursor, sizeof(word));
+            quint64 newline_bytes = word ^ kNewlines;
+            quint64 found = (newline_bytes - kOnes) & ~newline_bytes & kHighBits;
+
+            if (found != 0)
+            {
+                result = cursor + std::countr_zero(found) / 8;
+            }
+            else
+            {
+                cursor += 8;
+            }
+        }
+    }
+
+    while (result == nullptr && cursor < end)
+    {
+        if (*cursor == '\n')
+        {
+            result = cursor;
+        }
+        else
+        {
+            cursor++;
+        }
+    }
+
+    return result != nullptr ? result : end;
+}
+
+/**
+ * @brief Maps the whole file at its current size, replacing a previous mapping.
+ *
+ * An empty file is not mapped.
+ *
+ * @return True if the file is mapped, false otherwise.
+ */
+auto LogFileReader::map_file() -> bool
+{
+    bool result = true;
+    qint64 size = m_file.size();
+
+    if (m_data != nullptr)
+    {
+        m_file.unmap(m_data);
+        m_data = nullptr;
+    }
+
+    m_mapped_size = 0;
+
+    if (size > 0)
+    {
+        m_data = m_file.map(0, size);
+        result = m_data != nullptr;
+        m_mapped_size = result ? size : 0;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Starts indexing the given byte range in a background thread.
+ *
+ * @param from The offset to start at.
+ * @param to The offset to stop at.
+ */
+auto LogFileReader::start_indexing(qint64 from, qint64 to) -> void
+{
+    m_indexing = true;
+    const uchar* data = m_data;
+
+    m_index_future = QtConcurrent::run([this, data, from, to]() {
+        index_range(data, from, to);
+
+        {
+            QMutexLocker locker(&m_mutex);
+            m_indexing = false;
+        }
+
+        QMetaObject::invokeMethod(this, [this]() { on_indexing_finished(); }, Qt::QueuedConnection);
+    });
+}
+
+/**
+ * @brief Appends the offsets of all newlines in the given byte range to the index.
+ *
+ * The range is scanned in chunks; the index is extended after every chunk so that lines become
+ * available while the rest of the range is still being scanned.
+ *
+ * @param data The mapped file data.
+ * @param from The offset to start at.
+ * @param to The offset to stop at.
+ */
+auto LogFileReader::index_range(const uchar* data, qint64 from, qint64 to) -> void
+{
+    QVector<qint64> line_ends;
+
+    for (qint64 chunk_start = from; chunk_start < to && !m_cancel; chunk_start += kIndexChunkBytes)
+    {
+        qint64 chunk_end = qMin(chunk_start + kIndexChunkBytes, to);
+        const uchar* cursor = data + chunk_start;
+        const uchar* chunk_stop = data + chunk_end;
+        line_ends.clear();
+
+        while ((cursor = find_newline(cursor, chunk_stop)) != chunk_stop)
+        {
+            line_ends.append(cursor - data);
+            cursor++;
+        }
+
+        {
+            QMutexLocker locker(&m_mutex);
+            m_line_ends.append(line_ends);
+            m_indexed_end = chunk_end;
+        }
+
+        if (m_indexing)
+        {
+            QMetaObject::invokeMethod(this, &LogFileReader::lineCountChanged, Qt::QueuedConnection);
+        }
+    }
+}
+
+/**
+ * @brief Publishes the completed index and runs a deferred refresh.
+ */
+auto LogFileReader::on_indexing_finished() -> void
+{
+    // A stale notification from an indexer that was cancelled by reopening the file
+    if (m_indexing)
+    {
+        return;
+    }
+
+    emit lineCountChanged();
+    emit indexingFinished();
+
+    if (m_refresh_pending)
+    {
+        m_refresh_pending = false;
+        refresh();
+    }
+}
+}  // namespace QmlApp
@@ -0,0 +1,216 @@
+/**
+ * @file LogLineParser.cpp
+ * @brief This file contains the implementation of the LogLineParser class.
+ */
+
+#include "Services/Logging/LogLineParser.h"
+
+#include <QDateTime>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRegularExpression>
+
+#include "Services/Logging/LogMetrics.h"
+
+namespace QmlApp
+{
+namespace
+{
+/**
+ * @brief Returns the pattern of a SimpleFormatter line without color codes.
+ *
+ * The message is matched greedily, so the context is taken from the last " (file:line, function)"
+ * group of the line even if the message contains parentheses itself.
+ *
+ * @return The regular expression.
+ */
+auto text_line_pattern() -> const QRegularExpression&
+{
+    static const QRegularExpression pattern(QStringLiteral(
+        R"(^\[(\w+)\s*\]: (\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}) - (.*) \((.*?):(\d+), (.*)\)$)"));
+    return pattern;
+}
+
+/**
+ * @brief Returns the pattern of an ANSI escape sequence that sets a color.
+ *
+ * @return The regular expression.
+ */
+auto ansi_code_pattern() -> const QRegularExpression&
+{
+    static const QRegularExpression pattern(QStringLiteral("\\x1b\\[[0-9;]*m"));
+    return pattern;
+}
+}  // namespace
+
+/**
+ * @brief Parses a line written by the SimpleFormatter.
+ *
+ * The SimpleFormatter does not write the category, so the record gets Qt's "default" category.
+ *
+ * @param line The line, without the line terminator.
+ * @param record The record to fill in.
+ * @return True if the line was parsed, false if it is not a SimpleFormatter line.
+ */
+auto LogLineParser::parse_text_line(const QString& line, LogRecord& record) -> bool
+{
+    bool parsed = false;
+    QRegularExpressionMatch match = text_line_pattern().match(strip_ansi_codes(line));
+    QtMsgType level = QtDebugMsg;
+
+    if (match.hasMatch() && parse_level(match.capturedView(1), level))
+    {
+        QDateTime time =
+            QDateTime::fromString(match.captured(2), QStringLiteral("yyyy-MM-dd hh:mm:ss"));
+
+        record.type = level;
+        record.timestamp_ms = time.isValid() ? time.toMSecsSinceEpoch() : 0;
+        record.category = QByteArrayLiteral("default");
+        record.message = match.captured(3);
+        record.file = match.captured(4).toUtf8();
+        record.line = match.captured(5).toInt();
+        record.function = match.captured(6).toUtf8();
+        record.stack_frames.clear();
+        parsed = true;
+    }
+
+    return parsed;
+}
+
+/**
+ * @brief Parses a line written by the JsonFormatter.
+ *
+ * @param line The line, without the line terminator.
+ * @param record The record to fill in.
+ * @return True if the line was parsed, false if it is not a JsonFormatter line.
+ */
+auto LogLineParser::parse_json_line(const QByteArray& line, LogRecord& record) -> bool
+{
+    bool parsed = false;
+    QJsonParseError error;
+    QJsonDocument document = QJsonDocument::fromJson(line, &error);
+    QtMsgType level = QtDebugMsg;
+
+    if (error.error == QJsonParseError::NoError && document.isObject())
+    {
+        QJsonObject object = document.object();
+
+        if (object.contains(QStringLiteral("message")) &&
+            parse_level(object.value(QStringLiteral("level")).toString(), level))
+        {
+            QDateTime time = QDateTime::fromString(object.value(QStringLiteral("time")).toString(),
+                                                   Qt::ISODateWithMs);
+
+            record.type = level;
+            record.timestamp_ms = time.isValid() ? time.toMSecsSinceEpoch() : 0;
+            record.category = object.value(QStringLiteral("category")).toString().toUtf8();
+            record.file = object.value(QStringLiteral("file")).toString().toUtf8();
+            record.line = object.value(QStringLiteral("line")).toInt();
+            record.function = object.value(QStringLiteral("function")).toString().toUtf8();
+            record.message = object.value(QStringLiteral("message")).toString();
+            record.stack_frames.clear();
+            parsed = true;
+        }
+    }
+
+    return parsed;
+}
+
+/**
+ * @brief Parses all records of a log file.
+ *
+ * Lines that are neither JSON nor SimpleFormatter lines and come before the first record are
+ * skipped.
+ *
+ * @param file_path The path of the log file.
+ * @param records The list the parsed records are appended to.
+ * @return True if the file was read, false if it could not be opened.
+ */
+auto LogLineParser::parse_file(const QString& file_path, QList<LogRecord>& records) -> bool
+{
+    QFile file(file_path);
+    bool opened = file.open(QIODevice::ReadOnly);
+    qsizetype first_record = records.size();
+
+    while (opened && !file.atEnd())
+    {
+        QByteArray bytes = file.readLine();
+
+        while (bytes.endsWith('\n') || bytes.endsWith('\r'))
+        {
+            bytes.chop(1);
+        }
+
+        LogRecord record;
+        bool parsed = false;
+
+        if (bytes.startsWith('{'))
+        {
+            parsed = parse_json_line(bytes, record);
+        }
+        else
+        {
+            parsed = parse_text_line(QString::fromUtf8(bytes), record);
+        }
+
+        if (parsed)
+        {
+            record.sequence = static_cast<quint64>(records.size());
+            records.append(record);
+        }
+        else if (records.size() > first_record && !bytes.isEmpty())
+        {
+            records.last().message += QLatin1Char('\n') + QString::fromUtf8(bytes);
+        }
+    }
+
+    return opened;
+}
+
+/**
+ * @brief Converts a level name to a message type, ignoring case.
+ *
+ * Accepts the names written by LogMetrics::level_name() and the SimpleFormatter.
+ *
+ * @param name The level name, e.g. "Warning" or "warning".
+ * @param level The message type to fill in.
+ * @return True if the name is a known level, false otherwise.
+ */
+auto LogLineParser::parse_level(QStringView name, QtMsgType& level) -> bool
+{
+    bool known = false;
+
+    for (QtMsgType type: {QtDebugMsg, QtInfoMsg, QtWarningMsg, QtCriticalMsg, QtFatalMsg})
+    {
+        if (name.compare(LogMetrics::level_name(type), Qt::CaseInsensitive) == 0)
+        {
+            level = type;
+            known = true;
+            break;
+        }
+    }
+
+    return known;
+}
+
+/**
+ * @brief Removes ANSI escape sequences from a line.
+ *
+ * Lines without an escape character are returned unchanged without running the expression.
+ *
+ * @param line The line.
+ * @return The line without escape sequences.
+ */
+auto LogLineParser::strip_ansi_codes(const QString& line) -> QString
+{
+    QString result = line;
+
+    if (line.contains(QChar(0x1b)))
+    {
+        result.remove(ansi_code_pattern());
+    }
+
+    return result;
+}
+}  // namespace QmlApp
@@ -5,6 +5,8 @@
 
 #include "Services/Logging/LogMessage.h"
 
+#include "Services/Logging/LogClock.h"
+
 namespace QmlApp
 {
 /**
@@ -38,4 +40,92 @@ auto LogMessage::get_message() const -> const QString&
 {
     return m_message;
 }
+
+/**
+ * @brief Sets the raw return addresses of the call stack the message was logged from.
+ *
+ * @param frames The return addresses, innermost first.
+ */
+auto LogMessage::set_stack_frames(QList<quintptr> frames) -> void
+{
+    m_stack_frames = std::move(frames);
+}
+
+/**
+ * @brief Gets the raw return addresses of the call stack the message was logged from.
+ *
+ * @return The return addresses, innermost first, or an empty list if none were captured.
+ */
+auto LogMessage::get_stack_frames() const -> const QList<quintptr>&
+{
+    return m_stack_frames;
+}
+
+/**
+ * @brief Sets the time the message was logged.
+ *
+ * @param ticks A value returned by LogClock::now().
+ */
+auto LogMessage::set_timestamp(quint64 ticks) -> void
+{
+    m_timestamp = ticks;
+}
+
+/**
+ * @brief Gets the time the message was logged.
+ *
+ * @return The LogClock ticks, or 0 if the message was not stamped.
+ */
+auto LogMessage::get_timestamp() const -> quint64
+{
+    return m_timestamp;
+}
+
+/**
+ * @brief Gets the time the message was logged as a local date and time.
+ *
+ * Messages that were not logged through the Logger, e.g. ones formatted directly, are not stamped
+ * and get the current time.
+ *
+ * @return The converted timestamp, or the current time if the message was not stamped.
+ */
+auto LogMessage::get_date_time() const -> QDateTime
+{
+    return (m_timestamp != 0) ? LogClock::to_date_time(m_timestamp)
+                              : QDateTime::currentDateTime();
+}
+
+/**
+ * @brief Returns the severity rank of a log level, from 0 (debug) to 4 (fatal).
+ *
+ * QtMsgType values are not ordered by severity (QtInfoMsg has the highest value), so level filters
+ * compare this rank instead.
+ *
+ * @param type The log level.
+ * @return The severity rank.
+ */
+auto LogMessage::severity(QtMsgType type) -> int
+{
+    int result = 0;
+
+    switch (type)
+    {
+    case QtInfoMsg:
+        result = 1;
+        break;
+    case QtWarningMsg:
+        result = 2;
+        break;
+    case QtCriticalMsg:
+        result = 3;
+        break;
+    case QtFatalMsg:
+        result = 4;
+        break;
+    default:
+        break;
+    }
+
+    return result;
+}
 }  // namespace QmlApp
@@ -0,0 +1,164 @@
+/**
+ * @file LogMetrics.cpp
+ * @brief This file contains the implementation of the LogMetrics class.
+ */
+
+#include "Services/Logging/LogMetrics.h"
+
+namespace QmlApp
+{
+namespace
+{
+/**
+ * @brief Maps a log level to its counter index, or -1 for unknown levels.
+ */
+auto level_index(QtMsgType level) -> int
+{
+    auto index = static_cast<int>(level);
+    return (index >= 0 && index < LogMetricsSnapshot::kLevelCount) ? index : -1;
+}
+}  // namespace
+
+/**
+ * @brief Returns the number of accepted records of the given level.
+ *
+ * @param level The log level.
+ * @return The number of records.
+ */
+auto LogMetricsSnapshot::records(QtMsgType level) const -> quint64
+{
+    int index = level_index(level);
+    return (index >= 0) ? records_by_level[index] : 0;
+}
+
+/**
+ * @brief Returns the number of accepted records over all levels.
+ *
+ * @return The number of records.
+ */
+auto LogMetricsSnapshot::total_records() const -> quint64
+{
+    quint64 result = 0;
+
+    for (quint64 count: records_by_level)
+    {
+        result += count;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Counts an accepted record of the given level.
+ *
+ * @param level The log level of the record.
+ */
+auto LogMetrics::record_accepted(QtMsgType level) -> void
+{
+    int index = level_index(level);
+
+    if (index >= 0)
+    {
+        m_records_by_level[index].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Counts a record discarded by the log level filter.
+ */
+auto LogMetrics::record_filtered() -> void
+{
+    m_records_filtered.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds the given number of bytes to the emitted bytes counter.
+ *
+ * @param bytes The number of bytes emitted.
+ */
+auto LogMetrics::record_bytes(quint64 bytes) -> void
+{
+    m_bytes_emitted.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Records a latency sample.
+ *
+ * @param nanoseconds The latency in nanoseconds.
+ */
+auto LogMetrics::record_latency(quint64 nanoseconds) -> void
+{
+    m_latency.record(nanoseconds);
+}
+
+/**
+ * @brief Returns a snapshot of all counters.
+ *
+ * @return The snapshot.
+ */
+auto LogMetrics::snapshot() const -> LogMetricsSnapshot
+{
+    LogMetricsSnapshot result;
+
+    for (int i = 0; i < LogMetricsSnapshot::kLevelCount; i++)
+    {
+        result.records_by_level[i] = m_records_by_level[i].load(std::memory_order_relaxed);
+    }
+
+    result.records_filtered = m_records_filtered.load(std::memory_order_relaxed);
+    result.bytes_emitted = m_bytes_emitted.load(std::memory_order_relaxed);
+    result.latency = m_latency.snapshot();
+
+    return result;
+}
+
+/**
+ * @brief Resets all counters to zero.
+ */
+auto LogMetrics::reset() -> void
+{
+    for (auto& counter: m_records_by_level)
+    {
+        counter.store(0, std::memory_order_relaxed);
+    }
+
+    m_records_filtered.store(0, std::memory_order_relaxed);
+    m_bytes_emitted.store(0, std::memory_order_relaxed);
+    m_latency.reset();
+}
+
+/**
+ * @brief Returns the lower case name of the given log level.
+ *
+ * @param level The log level.
+ * @return The name of the level, e.g. "debug" or "warning".
+ */
+auto LogMetrics::level_name(QtMsgType level) -> QString
+{
+    QString result;
+
+    switch (level)
+    {
+    case QtDebugMsg:
+        result = QStringLiteral("debug");
+        break;
+    case QtInfoMsg:
+        result = QStringLiteral("info");
+        break;
+    case QtWarningMsg:
+        result = QStringLiteral("warning");
+        break;
+    case QtCriticalMsg:
+        result = QStringLiteral("critical");
+        break;
+    case QtFatalMsg:
+        result = QStringLiteral("fatal");
+        break;
+    default:
+        result = QStringLiteral("unknown");
+        break;
+    }
+
+    return result;
+}
+}  // namespace QmlApp
@@ -0,0 +1,134 @@
+/**
+ * @file LogMetricsProvider.cpp
+ * @brief This file contains the implementation of the LogMetricsProvider class.
+ */
+
+#include "Services/Logging/LogMetricsProvider.h"
+
+#include "Services/Logging/Logger.h"
+
+namespace QmlApp
+{
+/**
+ * @brief Constructs a LogMetricsProvider object with the given parent.
+ *
+ * The provider takes an initial snapshot. Periodic refreshing is disabled until a refresh
+ * interval greater than zero is set.
+ *
+ * @param parent The parent object.
+ */
+LogMetricsProvider::LogMetricsProvider(QObject* parent): QObject(parent)
+{
+    connect(&m_refresh_timer, &QTimer::timeout, this, &LogMetricsProvider::refresh);
+    refresh();
+}
+
+// NOLINTBEGIN(modernize-use-trailing-return-type)
+
+/**
+ * @brief Returns the last snapshot of the logger metrics.
+ *
+ * @return The logger metrics as a map of counter names to values.
+ */
+QVariantMap LogMetricsProvider::getLogger() const
+{
+    return m_logger;
+}
+
+/**
+ * @brief Returns the last snapshot of the appender metrics.
+ *
+ * Each entry is a map as returned by `to_variant_map`, extended by the name of the appender.
+ *
+ * @return The appender metrics.
+ */
+QVariantList LogMetricsProvider::getAppenders() const
+{
+    return m_appenders;
+}
+
+/**
+ * @brief Returns the refresh interval in milliseconds.
+ *
+ * @return The refresh interval, or 0 if periodic refreshing is disabled.
+ */
+int LogMetricsProvider::getRefreshInterval() const
+{
+    return m_refresh_timer.isActive() ? m_refresh_timer.interval() : 0;
+}
+
+/**
+ * @brief Sets the refresh interval in milliseconds.
+ *
+ * @param interval_ms The refresh interval, or 0 to disable periodic refreshing.
+ */
+void LogMetricsProvider::setRefreshInterval(int interval_ms)
+{
+    if (interval_ms != getRefreshInterval())
+    {
+        if (interval_ms > 0)
+        {
+            m_refresh_timer.start(interval_ms);
+        }
+        else
+        {
+            m_refresh_timer.stop();
+        }
+
+        emit refreshIntervalChanged();
+    }
+}
+
+/**
+ * @brief Takes a new snapshot of the logger and appender metrics.
+ */
+void LogMetricsProvider::refresh()
+{
+    m_logger = to_variant_map(Logger::get_instance().get_metrics().snapshot());
+    m_appenders.clear();
+
+    for (const auto& appender: Logger::get_instance().get_appenders())
+    {
+        if (appender != nullptr)
+        {
+            QVariantMap appender_map = to_variant_map(appender->get_metrics().snapshot());
+            appender_map.insert(QStringLiteral("name"), appender->get_name());
+            m_appenders.append(appender_map);
+        }
+    }
+
+    emit metricsChanged();
+}
+
+// NOLINTEND(modernize-use-trailing-return-type)
+
+/**
+ * @brief Converts a metrics snapshot into a QVariantMap readable from QML.
+ *
+ * Counters are stored under the level names ("debug", "info", ...) and "total", "filtered" and
+ * "bytes". Latency percentiles are stored in nanoseconds under "latencyP50Ns", "latencyP99Ns",
+ * "latencyP999Ns" and "latencyMaxNs".
+ *
+ * @param snapshot The snapshot to convert.
+ * @return The snapshot as a map of counter names to values.
+ */
+auto LogMetricsProvider::to_variant_map(const LogMetricsSnapshot& snapshot) -> QVariantMap
+{
+    QVariantMap result;
+
+    for (QtMsgType level: {QtDebugMsg, QtInfoMsg, QtWarningMsg, QtCriticalMsg, QtFatalMsg})
+    {
+        result.insert(LogMetrics::level_name(level), snapshot.records(level));
+    }
+
+    result.insert(QStringLiteral("total"), snapshot.total_records());
+    result.insert(QStringLiteral("filtered"), snapshot.records_filtered);
+    result.insert(QStringLiteral("bytes"), snapshot.bytes_emitted);
+    result.insert(QStringLiteral("latencyP50Ns"), snapshot.latency.percentile(0.5));
+    result.insert(QStringLiteral("latencyP99Ns"), snapshot.latency.percentile(0.99));
+    result.insert(QStringLiteral("latencyP999Ns"), snapshot.latency.percentile(0.999));
+    result.insert(QStringLiteral("latencyMaxNs"), snapshot.latency.max_ns);
+
+    return result;
+}
+}  // namespace QmlApp
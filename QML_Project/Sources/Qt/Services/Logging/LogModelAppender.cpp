@@ -0,0 +1,73 @@
+/**
+ * @file LogModelAppender.cpp
+ * @brief This file contains the implementation of the LogModelAppender class.
+ */
+
+#include "Services/Logging/LogModelAppender.h"
+
+#include <QMutexLocker>
+#include <utility>
+
+namespace QmlApp
+{
+/**
+ * @brief Constructs a LogModelAppender object.
+ *
+ * The appender does not format messages; it is named "model".
+ *
+ * @param max_pending The maximum number of records kept until they are taken.
+ */
+LogModelAppender::LogModelAppender(int max_pending): m_max_pending(qMax(max_pending, 1))
+{
+    m_name = QStringLiteral("model");
+}
+
+/**
+ * @brief Takes all pending records.
+ *
+ * @return The pending records in the order they were appended.
+ */
+auto LogModelAppender::take_pending() -> QList<LogRecord>
+{
+    QMutexLocker locker(&m_mutex);
+    return std::exchange(m_pending, {});
+}
+
+/**
+ * @brief Sets the maximum number of records kept until they are taken.
+ *
+ * @param max_pending The maximum number of pending records.
+ */
+auto LogModelAppender::set_max_pending(int max_pending) -> void
+{
+    QMutexLocker locker(&m_mutex);
+    m_max_pending = qMax(max_pending, 1);
+
+    while (m_pending.size() > m_max_pending)
+    {
+        m_pending.removeFirst();
+    }
+}
+
+/**
+ * @brief Captures the log message into the pending list.
+ *
+ * If the pending list is full, the oldest pending record is dropped, since it would be evicted
+ * from the consumer's ring right away anyway.
+ *
+ * @param message The log message to append.
+ * @param context The context of the log message.
+ */
+void LogModelAppender::internal_append(const LogMessage& message, const QMessageLogContext& context)
+{
+    LogRecord record = LogRecord::capture(message, context);
+    QMutexLocker locker(&m_mutex);
+
+    if (m_pending.size() >= m_max_pending)
+    {
+        m_pending.removeFirst();
+    }
+
+    m_pending.append(std::move(record));
+}
+}  // namespace QmlApp
@@ -0,0 +1,87 @@
+/**
+ * @file LogRecord.cpp
+ * @brief This file contains the implementation of the LogRecord struct.
+ */
+
+#include "Services/Logging/LogRecord.h"
+
+#include <atomic>
+
+#include "Services/Logging/LogClock.h"
+
+namespace QmlApp
+{
+namespace
+{
+std::atomic<quint64> g_next_sequence = 1;
+}  // namespace
+
+/**
+ * @brief Captures a log message and its context into a record.
+ *
+ * Null context strings are stored as empty byte arrays.
+ *
+ * @param message The log message.
+ * @param context The context of the log message.
+ * @return The captured record.
+ */
+auto LogRecord::capture(const LogMessage& message, const QMessageLogContext& context) -> LogRecord
+{
+    LogRecord record;
+    record.sequence = next_sequence();
+    record.type = message.get_type();
+    record.timestamp_ticks =
+        (message.get_timestamp() != 0) ? message.get_timestamp() : LogClock::now();
+    record.category = QByteArray(context.category);
+    record.file = QByteArray(context.file);
+    record.function = QByteArray(context.function);
+    record.line = context.line;
+    record.message = message.get_message();
+    record.stack_frames = message.get_stack_frames();
+    return record;
+}
+
+/**
+ * @brief Returns the next value of the process-wide record sequence counter.
+ *
+ * @return A sequence number that is strictly greater than all previously returned ones.
+ */
+auto LogRecord::next_sequence() -> quint64
+{
+    return g_next_sequence.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns a message log context pointing to the strings owned by this record.
+ *
+ * @return The message log context.
+ */
+auto LogRecord::context() const -> QMessageLogContext
+{
+    return QMessageLogContext(file.constData(), line, function.constData(), category.constData());
+}
+
+/**
+ * @brief Returns a log message with the type, text, timestamp and stack frames of this record.
+ *
+ * @return The log message.
+ */
+auto LogRecord::to_message() const -> LogMessage
+{
+    LogMessage result(type, message);
+    result.set_stack_frames(stack_frames);
+    result.set_timestamp(timestamp_ticks);
+    return result;
+}
+
+/**
+ * @brief Returns the time the record was logged.
+ *
+ * @return The milliseconds since the epoch, converted from the LogClock timestamp if the record
+ *         has one.
+ */
+auto LogRecord::msecs_since_epoch() const -> qint64
+{
+    return (timestamp_ticks != 0) ? LogClock::to_msecs_since_epoch(timestamp_ticks) : timestamp_ms;
+}
+}  // namespace QmlApp
@@ -0,0 +1,342 @@
+/**
+ * @file LogRedactor.cpp
+ * @brief This file contains the implementation of the LogRedactor class.
+ */
+
+#include "Services/Logging/LogRedactor.h"
+
+#include <queue>
+
+namespace QmlApp
+{
+/**
+ * @brief Constructs a LogRedactor object and compiles the rules.
+ *
+ * @param rules The redaction rules. Rules with an empty trigger are ignored. If several rules
+ * have the same trigger, the first one is used.
+ */
+LogRedactor::LogRedactor(QList<LogRedactionRule> rules): m_rules(std::move(rules))
+{
+    compile();
+}
+
+/**
+ * @brief Returns the message with all matches replaced.
+ *
+ * The message is scanned in its UTF-8 encoding. If nothing matches, the message itself is
+ * returned, so only messages that are actually redacted are decoded again.
+ *
+ * @param message The message to redact.
+ * @return The redacted message.
+ */
+auto LogRedactor::redact(const QString& message) const -> QString
+{
+    QString result = message;
+    QByteArray redacted;
+
+    if (redact_utf8(message.toUtf8(), redacted))
+    {
+        result = QString::fromUtf8(redacted);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Redacts UTF-8 encoded text.
+ *
+ * The automaton is run over the text once. When a state that ends a trigger is reached, the match
+ * is extended by the rule's character classes and, if valid, written to the output as the
+ * replacement. Scanning then resumes behind the match in the start state, so matches never
+ * overlap. Since classes either contain all bytes >= 0x80 or none of them, a match never splits
+ * a multi-byte sequence.
+ *
+ * @param text The text to redact.
+ * @param output Receives the redacted text if anything was replaced.
+ * @return True if anything was replaced, false otherwise.
+ */
+auto LogRedactor::redact_utf8(const QByteArray& text, QByteArray& output) const -> bool
+{
+    const auto* data = reinterpret_cast<const uchar*>(text.constData());
+    const qsizetype size = text.size();
+    qsizetype copied = 0;
+    qsizetype position = 0;
+    qint32 state = 0;
+    bool changed = false;
+
+    while (position < size)
+    {
+        state = m_transitions[state][data[position]];
+        qint32 rule_index = m_state_rule[state];
+        position++;
+
+        if (rule_index >= 0)
+        {
+            const LogRedactionRule& rule = m_rules[rule_index];
+            qsizetype trigger_start = position - rule.trigger.size();
+            qsizetype start = trigger_start;
+            qsizetype end = position;
+
+            if (rule.left_class.any())
+            {
+                while (start > copied && rule.left_class.test(data[start - 1]))
+                {
+                    start--;
+                }
+            }
+
+            if (rule.right_class.any())
+            {
+                while (end < size && rule.right_class.test(data[end]))
+                {
+                    end++;
+                }
+            }
+
+            bool valid = (rule.left_class.none() || start < trigger_start) &&
+                         (rule.right_class.none() || end > position);
+
+            if (valid)
+            {
+                if (!changed)
+                {
+                    output.clear();
+                    output.reserve(size);
+                    changed = true;
+                }
+
+                qsizetype kept_end = rule.keep_trigger ? position : start;
+                output.append(text.constData() + copied, kept_end - copied);
+                output.append(rule.replacement);
+                copied = end;
+                position = end;
+                state = 0;
+            }
+        }
+    }
+
+    if (changed)
+    {
+        output.append(text.constData() + copied, size - copied);
+    }
+
+    return changed;
+}
+
+/**
+ * @brief Returns the rules of this redactor.
+ *
+ * @return The rules.
+ */
+auto LogRedactor::get_rules() const -> const QList<LogRedactionRule>&
+{
+    return m_rules;
+}
+
+/**
+ * @brief Returns the number of states of the compiled automaton.
+ *
+ * @return The number of states.
+ */
+auto LogRedactor::get_state_count() const -> qsizetype
+{
+    return static_cast<qsizetype>(m_transitions.size());
+}
+
+/**
+ * @brief Returns rules for bearer tokens, credentials, email addresses and home paths.
+ *
+ * - "Bearer <token>" keeps "Bearer " and replaces the token with "<token>".
+ * - "token=", "password=", "secret=" and "api_key=" keep the key and replace the value with
+ *   "<redacted>".
+ * - Email addresses are replaced with "<email>".
+ * - Paths below "/home/", "/Users/" and "C:\Users\" are replaced with "<path>".
+ *
+ * @return The default rules.
+ */
+auto LogRedactor::default_rules() -> QList<LogRedactionRule>
+{
+    const LogRedactionCharClass token_class = char_class("A-Za-z0-9-._~+/=");
+    const LogRedactionCharClass value_class = char_class_except(" \t\r\n\"'&,;");
+    const LogRedactionCharClass path_class = char_class_except(" \t\r\n\"'<>|");
+    const LogRedactionCharClass email_local_class = char_class("A-Za-z0-9._%+-");
+    const LogRedactionCharClass email_domain_class = char_class("A-Za-z0-9.-");
+
+    QList<LogRedactionRule> rules;
+    rules.append({"Bearer ", "<token>", {}, token_class, true});
+
+    for (const char* key: {"token=", "password=", "secret=", "api_key="})
+    {
+        rules.append({key, "<redacted>", {}, value_class, true});
+    }
+
+    rules.append({"@", "<email>", email_local_class, email_domain_class, false});
+
+    for (const char* prefix: {"/home/", "/Users/", "C:\\Users\\"})
+    {
+        rules.append({prefix, "<path>", {}, path_class, false});
+    }
+
+    return rules;
+}
+
+/**
+ * @brief Creates a character class from ranges such as "A-Za-z0-9._-".
+ *
+ * @param ranges The characters and ranges. A '-' at the start or end is literal.
+ * @param non_ascii Whether all bytes of multi-byte UTF-8 sequences are included.
+ * @return The character class.
+ */
+auto LogRedactor::char_class(std::string_view ranges, bool non_ascii) -> LogRedactionCharClass
+{
+    LogRedactionCharClass result;
+
+    for (size_t i = 0; i < ranges.size(); i++)
+    {
+        auto first = static_cast<uchar>(ranges[i]);
+
+        if (i + 2 < ranges.size() && ranges[i + 1] == '-')
+        {
+            auto last = static_cast<uchar>(ranges[i + 2]);
+
+            for (int c = first; c <= last; c++)
+            {
+                result.set(c);
+            }
+
+            i += 2;
+        }
+        else
+        {
+            result.set(first);
+        }
+    }
+
+    if (non_ascii)
+    {
+        for (int c = 0x80; c < 0x100; c++)
+        {
+            result.set(c);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Creates a character class of all bytes except the given ASCII characters.
+ *
+ * Control characters are always excluded.
+ *
+ * @param excluded The excluded characters.
+ * @return The character class.
+ */
+auto LogRedactor::char_class_except(std::string_view excluded) -> LogRedactionCharClass
+{
+    LogRedactionCharClass result;
+    result.set();
+
+    for (int c = 0; c < 0x20; c++)
+    {
+        result.reset(c);
+    }
+
+    result.reset(0x7f);
+
+    for (char c: excluded)
+    {
+        result.reset(static_cast<uchar>(c));
+    }
+
+    return result;
+}
+
+/**
+ * @brief Compiles the rule triggers into a deterministic Aho-Corasick automaton.
+ *
+ * The triggers are inserted into a trie, failure links are computed breadth-first, and missing
+ * transitions are filled in from the failure state, so scanning never has to follow failure
+ * links. Each state records the rule of the longest trigger that ends in it.
+ */
+auto LogRedactor::compile() -> void
+{
+    std::array<qint32, 256> empty_row{};
+    empty_row.fill(-1);
+
+    m_transitions.assign(1, empty_row);
+    m_state_rule.assign(1, -1);
+
+    for (qsizetype rule_index = 0; rule_index < m_rules.size(); rule_index++)
+    {
+        const QByteArray& trigger = m_rules[rule_index].trigger;
+
+        if (trigger.isEmpty())
+        {
+            continue;
+        }
+
+        qint32 state = 0;
+
+        for (char c: trigger)
+        {
+            auto byte = static_cast<uchar>(c);
+
+            if (m_transitions[state][byte] < 0)
+            {
+                m_transitions[state][byte] = static_cast<qint32>(m_transitions.size());
+                m_transitions.push_back(empty_row);
+                m_state_rule.push_back(-1);
+            }
+
+            state = m_transitions[state][byte];
+        }
+
+        if (m_state_rule[state] < 0)
+        {
+            m_state_rule[state] = static_cast<qint32>(rule_index);
+        }
+    }
+
+    std::vector<qint32> failure(m_transitions.size(), 0);
+    std::queue<qint32> queue;
+
+    for (auto& target: m_transitions[0])
+    {
+        if (target < 0)
+        {
+            target = 0;
+        }
+        else
+        {
+            queue.push(target);
+        }
+    }
+
+    while (!queue.empty())
+    {
+        qint32 state = queue.front();
+        queue.pop();
+
+        // A state without a trigger of its own ends the longest trigger of its failure state
+        if (m_state_rule[state] < 0)
+        {
+            m_state_rule[state] = m_state_rule[failure[state]];
+        }
+
+        for (int byte = 0; byte < 256; byte++)
+        {
+            qint32 target = m_transitions[state][byte];
+
+            if (target < 0)
+            {
+                m_transitions[state][byte] = m_transitions[failure[state]][byte];
+            }
+            else
+            {
+                failure[target] = m_transitions[failure[state]][byte];
+                queue.push(target);
+            }
+        }
+    }
+}
+}  // namespace QmlApp
@@ -0,0 +1,207 @@
+/**
+ * @file LogRoutingTable.cpp
+ * @brief This file contains the implementation of the LogRoutingTable class.
+ */
+
+#include "Services/Logging/LogRoutingTable.h"
+
+#include <QDebug>
+#include <cstring>
+
+#include "Services/Logging/LogMessage.h"
+
+namespace QmlApp
+{
+namespace
+{
+constexpr int kSeverityCount = 5;
+}  // namespace
+
+/**
+ * @brief Constructs a routing table with the given routes.
+ *
+ * @param routes The routes.
+ */
+LogRoutingTable::LogRoutingTable(QList<LogRoute> routes): m_routes(std::move(routes)) {}
+
+/**
+ * @brief Replaces the routes of the table.
+ *
+ * The table has to be compiled again before the new routes take effect.
+ *
+ * @param routes The routes.
+ */
+auto LogRoutingTable::set_routes(QList<LogRoute> routes) -> void
+{
+    m_routes = std::move(routes);
+    m_compiled_routes.clear();
+
+    QWriteLocker locker(&m_cache_lock);
+    m_cache.clear();
+}
+
+/**
+ * @brief Resolves the appender names of the routes against the given appenders.
+ *
+ * Appender names that do not exist are reported and ignored. The category cache is cleared.
+ *
+ * @param appenders The appenders of the logger; bit i of a mask stands for appender i.
+ */
+auto LogRoutingTable::compile(const QList<QSharedPointer<LogAppender>>& appenders) -> void
+{
+    qsizetype routed_count = qMin<qsizetype>(appenders.size(), kMaxRoutedAppenders);
+    m_all_appenders = (routed_count == kMaxRoutedAppenders) ? ~quint64{0}
+                                                            : (quint64{1} << routed_count) - 1;
+    m_compiled_routes.clear();
+
+    for (const LogRoute& route: m_routes)
+    {
+        CompiledRoute compiled;
+        compiled.is_prefix = route.category.endsWith('*');
+        compiled.pattern = compiled.is_prefix ? route.category.chopped(1) : route.category;
+        compiled.minimum_severity = LogMessage::severity(route.minimum_level);
+
+        for (const QString& name: route.appenders)
+        {
+            if (name == QStringLiteral("*"))
+            {
+                compiled.mask |= m_all_appenders;
+                continue;
+            }
+
+            bool found = false;
+
+            for (qsizetype i = 0; i < routed_count; i++)
+            {
+                if (appenders[i] != nullptr && appenders[i]->get_name() == name)
+                {
+                    compiled.mask |= quint64{1} << i;
+                    found = true;
+                }
+            }
+
+            if (!found)
+            {
+                qWarning() << "Log route for" << route.category << "references unknown appender"
+                           << name;
+            }
+        }
+
+        m_compiled_routes.append(compiled);
+    }
+
+    QWriteLocker locker(&m_cache_lock);
+    m_cache.clear();
+}
+
+/**
+ * @brief Returns the appenders a record of the given category and level is sent to.
+ *
+ * The masks of a category are computed on its first record and cached by the category name.
+ * Batched records carry their own copy of the name, so the cache must not be keyed by its
+ * address: every record would add an entry, and a freed address reused by another category
+ * would return the wrong masks. The lookup wraps the name without copying it.
+ *
+ * @param category The category of the record; nullptr is treated as "default".
+ * @param type The level of the record.
+ * @return The appender bitmask.
+ */
+auto LogRoutingTable::route(const char* category, QtMsgType type) const -> quint64
+{
+    if (m_compiled_routes.isEmpty())
+    {
+        return m_all_appenders;
+    }
+
+    int level = LogMessage::severity(type);
+    const char* name = (category != nullptr) ? category : "default";
+    QByteArray key = QByteArray::fromRawData(name, static_cast<qsizetype>(std::strlen(name)));
+
+    {
+        QReadLocker locker(&m_cache_lock);
+        auto it = m_cache.constFind(key);
+
+        if (it != m_cache.constEnd())
+        {
+            return (*it)[level];
+        }
+    }
+
+    LevelMasks masks = compute_masks(category);
+
+    QWriteLocker locker(&m_cache_lock);
+    m_cache.insert(QByteArray(key.constData(), key.size()), masks);
+
+    return masks[level];
+}
+
+/**
+ * @brief Returns whether the table has no routes.
+ *
+ * @return True if every record is sent to all appenders, false otherwise.
+ */
+auto LogRoutingTable::is_empty() const -> bool
+{
+    return m_routes.isEmpty();
+}
+
+/**
+ * @brief Returns the routes of the table.
+ *
+ * @return The routes.
+ */
+auto LogRoutingTable::get_routes() const -> const QList<LogRoute>&
+{
+    return m_routes;
+}
+
+/**
+ * @brief Returns the number of categories whose masks are cached.
+ *
+ * @return The number of cached categories.
+ */
+auto LogRoutingTable::get_cached_category_count() const -> qsizetype
+{
+    QReadLocker locker(&m_cache_lock);
+    return m_cache.size();
+}
+
+/**
+ * @brief Matches a category against all routes and computes its mask for each level.
+ *
+ * @param category The category name.
+ * @return The appender masks, indexed by severity rank.
+ */
+auto LogRoutingTable::compute_masks(const char* category) const -> LevelMasks
+{
+    QByteArrayView name = (category != nullptr) ? QByteArrayView(category, std::strlen(category))
+                                                : QByteArrayView("default");
+    LevelMasks masks{};
+    std::array<bool, kSeverityCount> matched{};
+
+    for (const CompiledRoute& route: m_compiled_routes)
+    {
+        bool category_matches = name.startsWith(route.pattern) &&
+                                (route.is_prefix || name.size() == route.pattern.size());
+
+        if (category_matches)
+        {
+            for (int level = route.minimum_severity; level < kSeverityCount; level++)
+            {
+                masks[level] |= route.mask;
+                matched[level] = true;
+            }
+        }
+    }
+
+    for (int level = 0; level < kSeverityCount; level++)
+    {
+        if (!matched[level])
+        {
+            masks[level] = m_all_appenders;
+        }
+    }
+
+    return masks;
+}
+}  // namespace QmlApp
@@ -0,0 +1,598 @@
+/**
+ * @file LogSearchEngine.cpp
+ * @brief This file contains the implementation of the LogSearchEngine class.
+ */
+
+#include "Services/Logging/LogSearchEngine.h"
+
+#include <QByteArrayMatcher>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QVariantMap>
+#include <QtConcurrent/QtConcurrent>
+#include <algorithm>
+#include <memory>
+
+#ifdef QMLAPP_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+#include "Services/Logging/LogFileReader.h"
+
+namespace QmlApp
+{
+namespace
+{
+constexpr qint64 kDefaultChunkSize = 8 * 1024 * 1024;
+constexpr qint64 kCompressedReadSize = 256 * 1024;
+
+/**
+ * @struct SearchContext
+ * @brief The state shared by all tasks of a search.
+ */
+struct SearchContext {
+        QRegularExpression pattern;
+        QByteArray prefix;
+        QByteArrayMatcher prefix_matcher;
+        const std::atomic<bool>* cancel = nullptr;
+};
+
+/**
+ * @brief Returns the number of lines in the given range, counting an unterminated last line.
+ *
+ * @param data The data.
+ * @param begin The start of the range.
+ * @param end The end of the range.
+ * @return The number of lines.
+ */
+auto count_lines(const uchar* data, qint64 begin, qint64 end) -> qint64
+{
+    qint64 count = 0;
+    const uchar* cursor = data + begin;
+    const uchar* stop = data + end;
+
+    while (cursor < stop)
+    {
+        const uchar* newline = LogFileReader::find_newline(cursor, stop);
+        cursor = newline == stop ? stop : newline + 1;
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Matches all lines in the given range and appends the matches to the result.
+ *
+ * The range must start at the beginning of a line. A last line without a newline is included.
+ * With a literal prefix, the lines in front of the next prefix occurrence are only counted.
+ *
+ * @param data The data.
+ * @param begin The start of the range.
+ * @param end The end of the range.
+ * @param file_path The file the data belongs to.
+ * @param context The search context.
+ * @param result The result the matches and line count are added to.
+ */
+auto scan_lines(const char* data, qint64 begin, qint64 end, const QString& file_path,
+                const SearchContext& context, LogSearchTaskResult& result) -> void
+{
+    const auto* bytes = reinterpret_cast<const uchar*>(data);
+    qint64 position = begin;
+
+    while (position < end && !context.cancel->load(std::memory_order_relaxed))
+    {
+        qint64 candidate = position;
+
+        if (!context.prefix.isEmpty())
+        {
+            candidate = context.prefix_matcher.indexIn(data, end, position);
+
+            if (candidate < 0)
+            {
+                result.line_count += count_lines(bytes, position, end);
+                position = end;
+                continue;
+            }
+        }
+
+        const uchar* line_end = LogFileReader::find_newline(bytes + position, bytes + end);
+
+        while (line_end - bytes < candidate)
+        {
+            result.line_count++;
+            position = line_end - bytes + 1;
+            line_end = LogFileReader::find_newline(bytes + position, bytes + end);
+        }
+
+        qint64 length = line_end - bytes - position;
+
+        if (length > 0 && data[position + length - 1] == '\r')
+        {
+            length--;
+        }
+
+        QString line = QString::fromUtf8(data + position, length);
+
+        if (context.pattern.match(line).hasMatch())
+        {
+            result.matches.append({file_path, result.line_count, line});
+        }
+
+        result.line_count++;
+        position = line_end - bytes + 1;
+    }
+}
+
+/**
+ * @brief Searches the lines that start in the byte range of the task.
+ *
+ * The task range is widened to line boundaries: a line belongs to the chunk it starts in.
+ *
+ * @param task The task.
+ * @param context The search context.
+ * @return The matches of the task.
+ */
+auto search_range(const LogSearchTask& task, const SearchContext& context) -> LogSearchTaskResult
+{
+    LogSearchTaskResult result;
+    QFile file(task.file_path);
+
+    if (task.file_size > 0 && file.open(QIODevice::ReadOnly))
+    {
+        const uchar* data = file.map(0, task.file_size);
+
+        if (data != nullptr)
+        {
+            const uchar* data_end = data + task.file_size;
+            qint64 begin = task.begin;
+            qint64 end = task.end;
+
+            if (begin > 0 && data[begin - 1] != '\n')
+            {
+                begin = qMin(LogFileReader::find_newline(data + begin, data_end) - data + 1,
+                             task.file_size);
+            }
+
+            if (end < task.file_size && data[end - 1] != '\n')
+            {
+                end = qMin(LogFileReader::find_newline(data + end, data_end) - data + 1,
+                           task.file_size);
+            }
+
+            if (begin < end)
+            {
+                scan_lines(reinterpret_cast<const char*>(data), begin, end, task.file_path,
+                           context, result);
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Decompresses a gzip-compressed segment block by block and searches its lines.
+ *
+ * Only complete lines of each decompressed block are searched; the incomplete last line is
+ * carried over to the next block.
+ *
+ * @param task The task.
+ * @param context The search context.
+ * @return The matches of the task.
+ */
+auto search_compressed(const LogSearchTask& task, const SearchContext& context)
+    -> LogSearchTaskResult
+{
+    LogSearchTaskResult result;
+
+#ifdef QMLAPP_HAS_ZLIB
+    QFile file(task.file_path);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return result;
+    }
+
+    z_stream stream{};
+
+    // 16 selects the gzip format
+    if (inflateInit2(&stream, 16 + MAX_WBITS) != Z_OK)
+    {
+        return result;
+    }
+
+    QByteArray input;
+    QByteArray buffer;
+    QByteArray output(kCompressedReadSize, Qt::Uninitialized);
+    int status = Z_OK;
+
+    while (status == Z_OK && !context.cancel->load())
+    {
+        if (stream.avail_in == 0)
+        {
+            input = file.read(kCompressedReadSize);
+
+            if (input.isEmpty())
+            {
+                break;
+            }
+
+            stream.next_in = reinterpret_cast<Bytef*>(input.data());
+            stream.avail_in = static_cast<uInt>(input.size());
+        }
+
+        stream.next_out = reinterpret_cast<Bytef*>(output.data());
+        stream.avail_out = static_cast<uInt>(output.size());
+        status = inflate(&stream, Z_NO_FLUSH);
+        buffer.append(output.data(), static_cast<qsizetype>(output.size() - stream.avail_out));
+
+        // Rotated segments may consist of several concatenated gzip members
+        if (status == Z_STREAM_END)
+        {
+            inflateReset(&stream);
+            status = Z_OK;
+        }
+        else if (status == Z_BUF_ERROR)
+        {
+            status = Z_OK;
+        }
+
+        qsizetype complete_end = buffer.lastIndexOf('\n') + 1;
+
+        if (complete_end > 0)
+        {
+            scan_lines(buffer.constData(), 0, complete_end, task.file_path, context, result);
+            buffer.remove(0, complete_end);
+        }
+    }
+
+    inflateEnd(&stream);
+
+    if (!buffer.isEmpty())
+    {
+        scan_lines(buffer.constData(), 0, buffer.size(), task.file_path, context, result);
+    }
+#else
+    Q_UNUSED(context);
+    qWarning() << "Skipping" << task.file_path << "because zlib support is not available";
+#endif
+
+    return result;
+}
+}  // namespace
+
+/**
+ * @brief Constructs a LogSearchEngine object.
+ *
+ * @param parent The parent object.
+ */
+LogSearchEngine::LogSearchEngine(QObject* parent)
+    : QObject(parent), m_chunk_size(kDefaultChunkSize)
+{
+    connect(&m_watcher, &QFutureWatcherBase::resultReadyAt, this,
+            [this](int) { deliver_ready_results(); });
+    connect(&m_watcher, &QFutureWatcherBase::finished, this, [this]() {
+        deliver_ready_results();
+        finish();
+    });
+}
+
+/**
+ * @brief Cancels a running search and waits for its workers.
+ */
+LogSearchEngine::~LogSearchEngine()
+{
+    m_cancel = true;
+    m_watcher.cancel();
+    m_watcher.waitForFinished();
+}
+
+// NOLINTBEGIN(modernize-use-trailing-return-type)
+
+/**
+ * @brief Returns whether a search is running.
+ *
+ * @return True if a search is running, false otherwise.
+ */
+bool LogSearchEngine::isRunning() const
+{
+    return m_running;
+}
+
+/**
+ * @brief Starts searching the given files for a pattern.
+ *
+ * @param file_paths The files to search, oldest segment first.
+ * @param pattern The regular expression each line is matched against.
+ * @param case_sensitive Whether the pattern is matched case-sensitively.
+ * @return True if the search was started, false if the pattern is invalid.
+ */
+bool LogSearchEngine::search(const QStringList& file_paths, const QString& pattern,
+                             bool case_sensitive)
+{
+    QRegularExpression expression(pattern, case_sensitive
+                                               ? QRegularExpression::NoPatternOption
+                                               : QRegularExpression::CaseInsensitiveOption);
+    return start(file_paths, expression);
+}
+
+/**
+ * @brief Cancels the running search.
+ *
+ * Workers stop at the next line, and no further matches are reported. `finished(true)` is emitted
+ * once all workers have stopped.
+ */
+void LogSearchEngine::cancel()
+{
+    if (m_running)
+    {
+        m_cancel = true;
+        m_watcher.cancel();
+    }
+}
+
+// NOLINTEND(modernize-use-trailing-return-type)
+
+/**
+ * @brief Starts searching the given files, cancelling a running search first.
+ *
+ * Plain files are split into chunks of `set_chunk_size()` bytes, compressed segments (".gz") are
+ * searched as a whole. All tasks run on the global thread pool.
+ *
+ * @param file_paths The files to search, oldest segment first.
+ * @param pattern The regular expression each line is matched against.
+ * @return True if the search was started, false if the pattern is invalid.
+ */
+auto LogSearchEngine::start(const QStringList& file_paths, const QRegularExpression& pattern)
+    -> bool
+{
+    bool result = pattern.isValid();
+
+    if (!result)
+    {
+        qWarning() << "Invalid search pattern" << pattern.pattern() << ":"
+                   << pattern.errorString();
+        return result;
+    }
+
+    if (m_running)
+    {
+        cancel();
+        wait_for_finished();
+    }
+
+    m_tasks.clear();
+
+    for (qsizetype segment = 0; segment < file_paths.size(); segment++)
+    {
+        const QString& file_path = file_paths[segment];
+        LogSearchTask task;
+        task.segment = static_cast<int>(segment);
+        task.file_path = file_path;
+        task.file_size = QFileInfo(file_path).size();
+
+        if (file_path.endsWith(QStringLiteral(".gz")))
+        {
+            task.compressed = true;
+            m_tasks.append(task);
+        }
+        else
+        {
+            for (qint64 begin = 0; begin < task.file_size; begin += m_chunk_size)
+            {
+                task.begin = begin;
+                task.end = qMin(begin + m_chunk_size, task.file_size);
+                m_tasks.append(task);
+            }
+        }
+    }
+
+    m_pattern = pattern;
+    m_pattern.optimize();
+    m_prefix = literal_prefix(pattern);
+    m_cancel = false;
+    m_next_task = 0;
+    m_current_segment = -1;
+    m_line_base = 0;
+    m_running = true;
+    emit runningChanged();
+
+    auto context = std::make_shared<SearchContext>();
+    context->pattern = m_pattern;
+    context->prefix = m_prefix;
+    context->prefix_matcher.setPattern(m_prefix);
+    context->cancel = &m_cancel;
+
+    m_watcher.setFuture(
+        QtConcurrent::mapped(m_tasks, [context](const LogSearchTask& task) -> LogSearchTaskResult {
+            return task.compressed ? search_compressed(task, *context)
+                                   : search_range(task, *context);
+        }));
+
+    return result;
+}
+
+/**
+ * @brief Blocks until the running search is finished and reports its remaining matches.
+ */
+auto LogSearchEngine::wait_for_finished() -> void
+{
+    if (m_running)
+    {
+        m_watcher.waitForFinished();
+        deliver_ready_results();
+        finish();
+    }
+}
+
+/**
+ * @brief Sets the size of the chunks plain files are split into.
+ *
+ * The size applies to the next search.
+ *
+ * @param chunk_size The chunk size in bytes.
+ */
+auto LogSearchEngine::set_chunk_size(qint64 chunk_size) -> void
+{
+    m_chunk_size = qMax<qint64>(chunk_size, 1);
+}
+
+/**
+ * @brief Returns the given log file and its rotated segments, oldest first.
+ *
+ * Segments are the files in the same directory whose name starts with the name of the log file,
+ * e.g. "QmlApp.log.1" or "QmlApp.log.2.gz", ordered by modification time.
+ *
+ * @param log_file_path The path of the current log file, e.g. "QmlApp.log".
+ * @return The paths of the segments.
+ */
+auto LogSearchEngine::rotated_segments(const QString& log_file_path) -> QStringList
+{
+    QFileInfo log_file_info(log_file_path);
+    QFileInfoList segments = log_file_info.dir().entryInfoList(
+        {log_file_info.fileName() + QStringLiteral("*")}, QDir::Files);
+
+    std::stable_sort(segments.begin(), segments.end(),
+                     [](const QFileInfo& left, const QFileInfo& right) {
+                         return left.lastModified() < right.lastModified();
+                     });
+
+    QStringList result;
+
+    for (const QFileInfo& segment: segments)
+    {
+        result.append(segment.filePath());
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the literal text every match of the pattern starts with.
+ *
+ * The leading characters of the pattern are collected until the first metacharacter. Escaped
+ * punctuation counts as literal; a character followed by an optional quantifier is dropped. Case
+ * insensitive, extended and alternating patterns have no prefix.
+ *
+ * @param pattern The regular expression.
+ * @return The UTF-8 encoded literal prefix, or an empty byte array if there is none.
+ */
+auto LogSearchEngine::literal_prefix(const QRegularExpression& pattern) -> QByteArray
+{
+    const QString& text = pattern.pattern();
+    QString prefix;
+
+    if (!pattern.patternOptions().testAnyFlags(QRegularExpression::CaseInsensitiveOption |
+                                               QRegularExpression::ExtendedPatternSyntaxOption) &&
+        !text.contains(QLatin1Char('|')))
+    {
+        static const QString kMetacharacters = QStringLiteral(".^$*+?()[]{}\\");
+        qsizetype i = text.startsWith(QLatin1Char('^')) ? 1 : 0;
+        bool done = false;
+
+        while (!done && i < text.size())
+        {
+            QChar c = text[i];
+
+            if (c == QLatin1Char('\\') && i + 1 < text.size() && !text[i + 1].isLetterOrNumber())
+            {
+                prefix.append(text[i + 1]);
+                i += 2;
+            }
+            else if (!kMetacharacters.contains(c))
+            {
+                prefix.append(c);
+                i++;
+            }
+            else
+            {
+                // The previous character may occur zero times
+                if (c == QLatin1Char('*') || c == QLatin1Char('?') || c == QLatin1Char('{'))
+                {
+                    prefix.chop(1);
+                }
+
+                done = true;
+            }
+        }
+    }
+
+    return prefix.toUtf8();
+}
+
+/**
+ * @brief Converts matches to a list of maps with the keys "file", "line" and "text".
+ *
+ * @param matches The matches.
+ * @return The matches as a variant list for QML.
+ */
+auto LogSearchEngine::to_variant_list(const QList<LogSearchMatch>& matches) -> QVariantList
+{
+    QVariantList result;
+    result.reserve(matches.size());
+
+    for (const LogSearchMatch& match: matches)
+    {
+        QVariantMap map;
+        map[QStringLiteral("file")] = match.file_path;
+        map[QStringLiteral("line")] = match.line_number;
+        map[QStringLiteral("text")] = match.text;
+        result.append(map);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Reports the matches of all finished tasks that have no unfinished predecessor.
+ *
+ * Line numbers are made absolute by adding the line counts of the preceding tasks of the same
+ * segment.
+ */
+auto LogSearchEngine::deliver_ready_results() -> void
+{
+    QFuture<LogSearchTaskResult> future = m_watcher.future();
+
+    while (!m_cancel && m_next_task < m_tasks.size() &&
+           future.isResultReadyAt(static_cast<int>(m_next_task)))
+    {
+        const LogSearchTask& task = m_tasks[m_next_task];
+        LogSearchTaskResult task_result = future.resultAt(static_cast<int>(m_next_task));
+        m_next_task++;
+
+        if (task.segment != m_current_segment)
+        {
+            m_current_segment = task.segment;
+            m_line_base = 0;
+        }
+
+        for (LogSearchMatch& match: task_result.matches)
+        {
+            match.line_number += m_line_base;
+        }
+
+        m_line_base += task_result.line_count;
+
+        if (!task_result.matches.isEmpty())
+        {
+            emit matchesFound(to_variant_list(task_result.matches));
+        }
+    }
+}
+
+/**
+ * @brief Marks the search as finished and emits `finished()` once per search.
+ */
+auto LogSearchEngine::finish() -> void
+{
+    if (m_running)
+    {
+        m_running = false;
+        emit finished(m_cancel);
+        emit runningChanged();
+    }
+}
+}  // namespace QmlApp
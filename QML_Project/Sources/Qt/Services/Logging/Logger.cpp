@@ -5,15 +5,56 @@
 
 #include "Services/Logging/Logger.h"
 
+#include <QByteArray>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <utility>
+
+#include "Services/Logging/LogClock.h"
 #include "Services/Logging/LogMessage.h"
+#include "Services/Logging/LogRecord.h"
+#include "Services/Logging/StackTrace.h"
 
 namespace QmlApp
 {
+namespace
+{
+// Set while the calling thread appends a record to the appenders
+thread_local bool t_dispatching = false;
+
+/**
+ * @brief Writes a message straight to stderr, bypassing the appenders.
+ *
+ * @param msg The message.
+ */
+auto write_to_stderr(const QString& msg) -> void
+{
+    QByteArray bytes = msg.toLocal8Bit();
+    bytes.append('\n');
+    std::fwrite(bytes.constData(), 1, static_cast<size_t>(bytes.size()), stderr);
+    std::fflush(stderr);
+}
+}  // namespace
+
 /**
  * @brief Logs a message with the specified type and context.
  *
  * This function creates a LogMessage object with the specified type and message,
- * and then appends it to all registered log appenders.
+ * and then appends it to all registered log appenders. If a redactor is set, the message is
+ * redacted before any appender sees it. If routes are set, the message is only appended to the
+ * appenders its category and level are routed to. If batching is enabled, the message is staged
+ * for the writer thread instead, except for fatal messages. The record is counted in the logger
+ * metrics, either as accepted together with the dispatch (or staging) latency or as filtered.
+ * Accepted messages are stamped with LogClock::now(); the formatters convert the stamp to calendar
+ * time, which for batched messages happens on the writer thread.
+ * Critical and fatal messages get the raw return addresses of the calling stack attached, which
+ * are symbolised offline.
+ *
+ * Messages that an appender logs while a record is dispatched, such as the output of
+ * ConsoleAppender, are written straight to stderr. Qt only guards the thread that is already in
+ * the message handler, so on the writer thread they would otherwise be staged, dispatched and
+ * logged again without end.
  *
  * @param type The type of the log message.
  * @param context The context of the log message.
@@ -21,17 +62,44 @@ namespace QmlApp
  */
 void Logger::log(QtMsgType type, const QMessageLogContext& context, const QString& msg)
 {
-    LogMessage log_message(type, msg);
-
-    if (type >= m_log_level)
+    if (t_dispatching)
     {
-        for (const auto& appender: m_appenders)
+        write_to_stderr(msg);
+    }
+    else if (type >= m_log_level)
+    {
+        auto start = std::chrono::steady_clock::now();
+        LogMessage log_message(type, (m_redactor != nullptr) ? m_redactor->redact(msg) : msg);
+        log_message.set_timestamp(LogClock::now());
+
+        if (type == QtCriticalMsg || type == QtFatalMsg)
         {
-            if (appender != nullptr)
+            log_message.set_stack_frames(StackTrace::capture(1));
+        }
+
+        if (m_batcher != nullptr && type != QtFatalMsg)
+        {
+            m_batcher->stage(LogRecord::capture(log_message, context));
+        }
+        else
+        {
+            // A fatal message aborts the process, so it and everything before it is written now
+            if (m_batcher != nullptr)
             {
-                appender->append(log_message, context);
+                m_batcher->flush();
             }
+
+            dispatch(log_message, context);
         }
+
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        m_metrics.record_accepted(type);
+        m_metrics.record_latency(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+    else
+    {
+        m_metrics.record_filtered();
     }
 }
 
@@ -45,6 +113,7 @@ void Logger::log(QtMsgType type, const QMessageLogContext& context, const QStrin
 void Logger::add_appender(const QSharedPointer<LogAppender>& appender)
 {
     m_appenders.append(appender);
+    m_routing_table.compile(m_appenders);
 }
 
 /**
@@ -55,6 +124,7 @@ void Logger::add_appender(const QSharedPointer<LogAppender>& appender)
 void Logger::clear_appenders()
 {
     m_appenders.clear();
+    m_routing_table.compile(m_appenders);
 }
 
 /**
@@ -84,4 +154,203 @@ auto Logger::get_log_level() const -> QtMsgType
     return m_log_level;
 }
 
+/**
+ * @brief Returns the registered log appenders.
+ *
+ * @return The list of registered log appenders.
+ */
+auto Logger::get_appenders() const -> QList<QSharedPointer<LogAppender>>
+{
+    return m_appenders;
+}
+
+/**
+ * @brief Enables batched dispatch of log messages.
+ *
+ * Messages are staged in per-thread buffers and dispatched to the appenders by a writer thread,
+ * in the order of their sequence numbers. The buffers are handed off when one of them holds
+ * max_batch_size records, when a warning or more severe message is logged, or after
+ * max_batch_delay_ms milliseconds. Appenders are then called from the writer thread. If batching
+ * is already enabled, the staged messages are flushed before the new settings take effect.
+ *
+ * @param max_batch_size The number of staged messages that triggers a hand-off.
+ * @param max_batch_delay_ms The maximum time in milliseconds a message stays staged.
+ */
+void Logger::enable_batching(qsizetype max_batch_size, int max_batch_delay_ms)
+{
+    m_batcher.reset();
+    m_batcher = std::make_unique<LogBatcher>(
+        [this](const LogRecord& record) {
+            dispatch(record.to_message(), record.context());
+        },
+        max_batch_size, max_batch_delay_ms);
+}
+
+/**
+ * @brief Disables batched dispatch after flushing all staged messages.
+ */
+void Logger::disable_batching()
+{
+    m_batcher.reset();
+}
+
+/**
+ * @brief Returns whether batched dispatch is enabled.
+ *
+ * @return True if messages are staged for a writer thread, false otherwise.
+ */
+auto Logger::is_batching() const -> bool
+{
+    return m_batcher != nullptr;
+}
+
+/**
+ * @brief Dispatches all staged messages and writes out the buffers of all appenders.
+ *
+ * Staged messages are dispatched in the calling thread before the appenders are flushed.
+ */
+void Logger::flush()
+{
+    if (m_batcher != nullptr)
+    {
+        m_batcher->flush();
+    }
+
+    for (const auto& appender: m_appenders)
+    {
+        if (appender != nullptr)
+        {
+            appender->flush();
+        }
+    }
+}
+
+/**
+ * @brief Returns the number of staged messages that were not yet dispatched.
+ *
+ * @return The number of pending messages, or 0 if batching is disabled.
+ */
+auto Logger::pending_record_count() const -> qsizetype
+{
+    return (m_batcher != nullptr) ? m_batcher->pending_record_count() : 0;
+}
+
+/**
+ * @brief Sets the routes that decide which appenders receive a record.
+ *
+ * Appender names in the routes are resolved against the registered appenders, now and whenever
+ * appenders are added. Passing an empty list sends every record to all appenders again.
+ *
+ * @param routes The routes.
+ */
+void Logger::set_routes(const QList<LogRoute>& routes)
+{
+    m_routing_table.set_routes(routes);
+    m_routing_table.compile(m_appenders);
+}
+
+/**
+ * @brief Returns the routing table of the logger.
+ *
+ * @return The routing table.
+ */
+auto Logger::get_routing_table() const -> const LogRoutingTable&
+{
+    return m_routing_table;
+}
+
+/**
+ * @brief Sets the redactor that scrubs sensitive data from messages before they are dispatched.
+ *
+ * The redaction time is included in the dispatch latency of the logger metrics.
+ *
+ * @param redactor The redactor, or nullptr to disable redaction.
+ */
+void Logger::set_redactor(const QSharedPointer<const LogRedactor>& redactor)
+{
+    m_redactor = redactor;
+}
+
+/**
+ * @brief Returns the redactor of the logger.
+ *
+ * @return The redactor, or nullptr if redaction is disabled.
+ */
+auto Logger::get_redactor() const -> QSharedPointer<const LogRedactor>
+{
+    return m_redactor;
+}
+
+/**
+ * @brief Returns the metrics of the logger.
+ *
+ * @return The metrics of the logger.
+ */
+auto Logger::get_metrics() const -> const LogMetrics&
+{
+    return m_metrics;
+}
+
+/**
+ * @brief Appends a log message to the appenders, or to those it is routed to if routes are set.
+ *
+ * @param message The log message.
+ * @param context The context of the log message.
+ */
+auto Logger::dispatch(const LogMessage& message, const QMessageLogContext& context) -> void
+{
+    bool was_dispatching = std::exchange(t_dispatching, true);
+
+    if (m_routing_table.is_empty())
+    {
+        for (const auto& appender: m_appenders)
+        {
+            if (appender != nullptr)
+            {
+                appender->append(message, context);
+            }
+        }
+    }
+    else
+    {
+        dispatch_routed(message, context);
+    }
+
+    t_dispatching = was_dispatching;
+}
+
+/**
+ * @brief Appends a log message to the appenders it is routed to.
+ *
+ * The routing table yields a bitmask of appender indices; only its set bits are visited, so the
+ * cost depends on the number of receiving appenders, not on the number of appenders or routes.
+ * Appenders beyond the routable ones receive every message.
+ *
+ * @param message The log message.
+ * @param context The context of the log message.
+ */
+auto Logger::dispatch_routed(const LogMessage& message, const QMessageLogContext& context) -> void
+{
+    quint64 mask = m_routing_table.route(context.category, message.get_type());
+
+    while (mask != 0)
+    {
+        auto index = static_cast<qsizetype>(std::countr_zero(mask));
+        mask &= mask - 1;
+
+        if (index < m_appenders.size() && m_appenders[index] != nullptr)
+        {
+            m_appenders[index]->append(message, context);
+        }
+    }
+
+    for (qsizetype i = LogRoutingTable::kMaxRoutedAppenders; i < m_appenders.size(); i++)
+    {
+        if (m_appenders[i] != nullptr)
+        {
+            m_appenders[i]->append(message, context);
+        }
+    }
+}
+
 }  // namespace QmlApp
@@ -0,0 +1,276 @@
+/**
+ * @file PrometheusMetricsWriter.cpp
+ * @brief This file contains the implementation of the PrometheusMetricsWriter class.
+ */
+
+#include "Services/Logging/PrometheusMetricsWriter.h"
+
+#include <QDebug>
+#include <QSaveFile>
+#include <QTextStream>
+#include <array>
+
+#include "Services/Logging/Logger.h"
+
+namespace QmlApp
+{
+namespace
+{
+constexpr std::array<QtMsgType, LogMetricsSnapshot::kLevelCount> kLevels = {
+    QtDebugMsg, QtInfoMsg, QtWarningMsg, QtCriticalMsg, QtFatalMsg};
+
+// Histogram bucket boundaries in nanoseconds, from 1 us to 1 s.
+constexpr std::array<quint64, 15> kLatencyBoundariesNs = {
+    1000,    2500,    5000,    10000,    25000,     50000,     100000,    250000,
+    500000,  1000000, 2500000, 5000000,  10000000,  100000000, 1000000000};
+
+/**
+ * @brief Escapes a label value as required by the exposition format.
+ */
+auto escape_label(const QString& value) -> QString
+{
+    QString result = value;
+    result.replace('\\', QStringLiteral("\\\\"));
+    result.replace('"', QStringLiteral("\\\""));
+    result.replace('\n', QStringLiteral("\\n"));
+    return result;
+}
+
+/**
+ * @brief Joins the given labels and an optional extra label into a label set.
+ */
+auto label_set(const QString& labels, const QString& extra = QString()) -> QString
+{
+    QString joined = labels;
+
+    if (!extra.isEmpty())
+    {
+        joined += joined.isEmpty() ? extra : QStringLiteral(",") + extra;
+    }
+
+    return joined.isEmpty() ? QString() : QStringLiteral("{%1}").arg(joined);
+}
+
+/**
+ * @brief Writes the HELP and TYPE lines of a metric family.
+ */
+auto write_header(QTextStream& stream, const QString& name, const QString& type,
+                  const QString& help) -> void
+{
+    stream << "# HELP " << name << ' ' << help << '\n';
+    stream << "# TYPE " << name << ' ' << type << '\n';
+}
+
+/**
+ * @brief Writes the per-level record counters of one source.
+ */
+auto write_records(QTextStream& stream, const QString& name, const QString& labels,
+                   const LogMetricsSnapshot& snapshot) -> void
+{
+    for (QtMsgType level: kLevels)
+    {
+        QString level_label = QStringLiteral("level=\"%1\"").arg(LogMetrics::level_name(level));
+        stream << name << label_set(labels, level_label) << ' ' << snapshot.records(level) << '\n';
+    }
+}
+
+/**
+ * @brief Writes the latency histogram of one source.
+ */
+auto write_histogram(QTextStream& stream, const QString& name, const QString& labels,
+                     const LatencyHistogram::Snapshot& histogram) -> void
+{
+    for (quint64 boundary_ns: kLatencyBoundariesNs)
+    {
+        QString le_label = QStringLiteral("le=\"%1\"").arg(
+            QString::number(static_cast<double>(boundary_ns) / 1e9, 'g', 6));
+        stream << name << "_bucket" << label_set(labels, le_label) << ' '
+               << histogram.count_at_or_below(boundary_ns) << '\n';
+    }
+
+    stream << name << "_bucket" << label_set(labels, QStringLiteral("le=\"+Inf\"")) << ' '
+           << histogram.count << '\n';
+    stream << name << "_sum" << label_set(labels) << ' '
+           << QString::number(static_cast<double>(histogram.sum_ns) / 1e9, 'g', 12) << '\n';
+    stream << name << "_count" << label_set(labels) << ' ' << histogram.count << '\n';
+}
+}  // namespace
+
+/**
+ * @brief Constructs a PrometheusMetricsWriter object.
+ *
+ * @param parent The parent object.
+ */
+PrometheusMetricsWriter::PrometheusMetricsWriter(QObject* parent): QObject(parent)
+{
+    connect(&m_timer, &QTimer::timeout, this, [this]() { write_now(); });
+}
+
+/**
+ * @brief Starts writing the metrics to the given file periodically.
+ *
+ * The metrics are written once immediately and then every `interval_ms` milliseconds.
+ *
+ * @param file_path The path of the file to write.
+ * @param interval_ms The interval between two writes in milliseconds.
+ */
+auto PrometheusMetricsWriter::start(const QString& file_path, int interval_ms) -> void
+{
+    m_file_path = file_path;
+    m_timer.start(interval_ms);
+    write_now();
+}
+
+/**
+ * @brief Stops writing the metrics periodically.
+ */
+auto PrometheusMetricsWriter::stop() -> void
+{
+    m_timer.stop();
+}
+
+/**
+ * @brief Returns whether the metrics are currently written periodically.
+ *
+ * @return True if the writer is running, false otherwise.
+ */
+auto PrometheusMetricsWriter::is_running() const -> bool
+{
+    return m_timer.isActive();
+}
+
+/**
+ * @brief Writes the current metrics of the Logger and its appenders to the file.
+ *
+ * The file is written through a QSaveFile, so it is replaced atomically.
+ *
+ * @return True if the file was written successfully, false otherwise.
+ */
+auto PrometheusMetricsWriter::write_now() -> bool
+{
+    bool result = false;
+
+    if (!m_file_path.isEmpty())
+    {
+        QSaveFile file(m_file_path);
+
+        if (file.open(QIODevice::WriteOnly | QIODevice::Text))
+        {
+            file.write(collect_exposition().toUtf8());
+            result = file.commit();
+        }
+
+        if (!result)
+        {
+            qWarning() << "Failed to write log metrics to:" << m_file_path;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Formats the given snapshots in Prometheus exposition format.
+ *
+ * Logger and appender metrics are written as separate metric families. Appenders are labelled
+ * with their name and their position in the appender list, so that two appenders with the same
+ * name remain distinguishable.
+ *
+ * @param logger_snapshot The metrics snapshot of the logger.
+ * @param appender_snapshots The name and metrics snapshot of each appender.
+ * @return The metrics in Prometheus exposition format.
+ */
+auto PrometheusMetricsWriter::format_exposition(
+    const LogMetricsSnapshot& logger_snapshot,
+    const QList<QPair<QString, LogMetricsSnapshot>>& appender_snapshots) -> QString
+{
+    QString result;
+    QTextStream stream(&result);
+    QStringList appender_labels;
+
+    for (int i = 0; i < appender_snapshots.size(); i++)
+    {
+        appender_labels.append(QStringLiteral("appender=\"%1\",index=\"%2\"")
+                                   .arg(escape_label(appender_snapshots[i].first))
+                                   .arg(i));
+    }
+
+    write_header(stream, QStringLiteral("qmlapp_logger_records_total"), QStringLiteral("counter"),
+                 QStringLiteral("Log records accepted by the logger, by level."));
+    write_records(stream, QStringLiteral("qmlapp_logger_records_total"), QString(),
+                  logger_snapshot);
+
+    write_header(stream, QStringLiteral("qmlapp_logger_records_filtered_total"),
+                 QStringLiteral("counter"),
+                 QStringLiteral("Log records discarded by the logger log level."));
+    stream << "qmlapp_logger_records_filtered_total " << logger_snapshot.records_filtered << '\n';
+
+    write_header(stream, QStringLiteral("qmlapp_logger_dispatch_latency_seconds"),
+                 QStringLiteral("histogram"),
+                 QStringLiteral("Time spent dispatching a record to all appenders."));
+    write_histogram(stream, QStringLiteral("qmlapp_logger_dispatch_latency_seconds"), QString(),
+                    logger_snapshot.latency);
+
+    write_header(stream, QStringLiteral("qmlapp_appender_records_total"),
+                 QStringLiteral("counter"),
+                 QStringLiteral("Log records written by an appender, by level."));
+
+    for (int i = 0; i < appender_snapshots.size(); i++)
+    {
+        write_records(stream, QStringLiteral("qmlapp_appender_records_total"), appender_labels[i],
+                      appender_snapshots[i].second);
+    }
+
+    write_header(stream, QStringLiteral("qmlapp_appender_records_filtered_total"),
+                 QStringLiteral("counter"),
+                 QStringLiteral("Log records discarded by an appender log level."));
+
+    for (int i = 0; i < appender_snapshots.size(); i++)
+    {
+        stream << "qmlapp_appender_records_filtered_total" << label_set(appender_labels[i]) << ' '
+               << appender_snapshots[i].second.records_filtered << '\n';
+    }
+
+    write_header(stream, QStringLiteral("qmlapp_appender_bytes_total"), QStringLiteral("counter"),
+                 QStringLiteral("Bytes emitted by an appender."));
+
+    for (int i = 0; i < appender_snapshots.size(); i++)
+    {
+        stream << "qmlapp_appender_bytes_total" << label_set(appender_labels[i]) << ' '
+               << appender_snapshots[i].second.bytes_emitted << '\n';
+    }
+
+    write_header(stream, QStringLiteral("qmlapp_appender_append_latency_seconds"),
+                 QStringLiteral("histogram"),
+                 QStringLiteral("Time spent in the internal_append of an appender, sampled."));
+
+    for (int i = 0; i < appender_snapshots.size(); i++)
+    {
+        write_histogram(stream, QStringLiteral("qmlapp_appender_append_latency_seconds"),
+                        appender_labels[i], appender_snapshots[i].second.latency);
+    }
+
+    stream.flush();
+    return result;
+}
+
+/**
+ * @brief Collects the metrics of the Logger and its appenders in exposition format.
+ *
+ * @return The metrics in Prometheus exposition format.
+ */
+auto PrometheusMetricsWriter::collect_exposition() -> QString
+{
+    QList<QPair<QString, LogMetricsSnapshot>> appender_snapshots;
+
+    for (const auto& appender: Logger::get_instance().get_appenders())
+    {
+        if (appender != nullptr)
+        {
+            appender_snapshots.append({appender->get_name(), appender->get_metrics().snapshot()});
+        }
+    }
+
+    return format_exposition(Logger::get_instance().get_metrics().snapshot(), appender_snapshots);
+}
+}  // namespace QmlApp
@@ -62,7 +62,7 @@ auto SimpleFormatter::format(const LogMessage& log_message,
         .arg(color_code)
         .arg(msg_type)
         .arg(reset_code)
-        .arg(QDateTime::currentDateTime().toString("yyyy-MM-dd hh:mm:ss"))
+        .arg(log_message.get_date_time().toString("yyyy-MM-dd hh:mm:ss"))
         .arg(local_msg.constData())
         .arg(context_color_code)
         .arg(file)
@@ -0,0 +1,134 @@
+/**
+ * @file StackTrace.cpp
+ * @brief This file contains the implementation of the StackTrace class.
+ */
+
+#include "Services/Logging/StackTrace.h"
+
+#include <array>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#elif __has_include(<execinfo.h>)
+#include <dlfcn.h>
+#include <execinfo.h>
+#define QMLAPP_HAS_EXECINFO
+#endif
+
+namespace QmlApp
+{
+namespace
+{
+// Frames of the unwinder itself that are always left out
+constexpr int kOwnFrames = 1;
+constexpr int kMaxSkippedFrames = 16;
+}  // namespace
+
+/**
+ * @brief Captures the return addresses of the calling thread's stack.
+ *
+ * The addresses are not resolved. The first capture in a process may take longer, since the
+ * unwinder is loaded lazily on some platforms.
+ *
+ * @param skip_frames The number of innermost frames to leave out, not counting this function.
+ * @return The return addresses, innermost first, at most kMaxFrames of them.
+ */
+auto StackTrace::capture(int skip_frames) -> QList<quintptr>
+{
+    QList<quintptr> result;
+    int skipped = kOwnFrames + qBound(0, skip_frames, kMaxSkippedFrames);
+    std::array<void*, kMaxFrames + kOwnFrames + kMaxSkippedFrames> frames{};
+    int count = 0;
+
+#if defined(Q_OS_WIN)
+    count = CaptureStackBackTrace(static_cast<DWORD>(skipped), kMaxFrames, frames.data(), nullptr);
+    skipped = 0;
+#elif defined(QMLAPP_HAS_EXECINFO)
+    count = backtrace(frames.data(), kMaxFrames + skipped);
+#endif
+
+    if (count > skipped)
+    {
+        result.reserve(count - skipped);
+
+        for (int i = skipped; i < count; i++)
+        {
+            result.append(reinterpret_cast<quintptr>(frames[i]));
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the address the application binary is loaded at.
+ *
+ * With address space layout randomisation, a return address is only meaningful relative to this
+ * base. The base is determined once from the module containing this function.
+ *
+ * @return The load address, or 0 if it cannot be determined.
+ */
+auto StackTrace::image_base() -> quintptr
+{
+    static const quintptr base = []() -> quintptr {
+        quintptr result = 0;
+#if defined(Q_OS_WIN)
+        result = reinterpret_cast<quintptr>(GetModuleHandleW(nullptr));
+#elif defined(QMLAPP_HAS_EXECINFO)
+        Dl_info info{};
+
+        if (dladdr(reinterpret_cast<void*>(&StackTrace::image_base), &info) != 0)
+        {
+            result = reinterpret_cast<quintptr>(info.dli_fbase);
+        }
+#endif
+        return result;
+    }();
+
+    return base;
+}
+
+/**
+ * @brief Returns whether stack traces can be captured on this platform.
+ *
+ * @return True if capture() returns frames, false otherwise.
+ */
+auto StackTrace::is_supported() -> bool
+{
+#if defined(Q_OS_WIN) || defined(QMLAPP_HAS_EXECINFO)
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Formats an address as a hexadecimal string with a "0x" prefix.
+ *
+ * @param address The address.
+ * @return The formatted address.
+ */
+auto StackTrace::to_hex(quintptr address) -> QString
+{
+    return QStringLiteral("0x") + QString::number(address, 16);
+}
+
+/**
+ * @brief Formats addresses as hexadecimal strings with a "0x" prefix.
+ *
+ * @param frames The addresses.
+ * @return The formatted addresses.
+ */
+auto StackTrace::to_hex(const QList<quintptr>& frames) -> QStringList
+{
+    QStringList result;
+    result.reserve(frames.size());
+
+    for (quintptr address: frames)
+    {
+        result.append(to_hex(address));
+    }
+
+    return result;
+}
+}  // namespace QmlApp
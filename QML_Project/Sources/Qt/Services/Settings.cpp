@@ -6,6 +6,11 @@
 #include "Services/Settings.h"
 
 #include <QCoreApplication>
+#include <QFileInfo>
+#include <QMutex>
+#include <utility>
+
+#include "Services/BinarySettingsFile.h"
 
 namespace QmlApp
 {
@@ -15,12 +20,13 @@ namespace QmlApp
  * This constructor initializes the Settings object with the parent object and
  * sets up the QSettings object to use the organization name and application name
  * for storing settings in the registry. The settings can be cleared using the
- * `clear()` method.
+ * `clear()` method. The read cache is shared with the other Settings objects on the same store.
  *
  * @param parent The parent object.
  */
 Settings::Settings(QObject* parent)
     : m_settings(QCoreApplication::organizationName(), QCoreApplication::applicationName()),
+      m_store(shared_store(m_settings.fileName())),
       QObject(parent)
 {
     qInfo() << "Settings initialized with organization name:"
@@ -34,45 +40,119 @@ Settings::Settings(QObject* parent)
 /**
  * @brief Gets the value associated with the specified key from the settings.
  *
+ * The value is read from the cache; QSettings is only queried the first time a key is read after
+ * it was changed.
+ *
  * @param key The key of the value to retrieve.
  * @param default_value The default value to return if the key does not exist.
  * @return The value associated with the key, or the default value if the key does not exist.
  */
 QVariant Settings::getValue(const QString& key, const QVariant& default_value) const
 {
-    return m_settings.value(key, default_value);
+    CachedValue cached = cached_value(QString(), key);
+    return cached.exists ? cached.value : default_value;
 }
 
 /**
  * @brief Gets the value associated with the specified key from the settings.
  *
+ * The value is read from the cache; QSettings is only queried the first time a key is read after
+ * it was changed.
+ *
  * @param group The group of the value to retrieve.
  * @param key The key of the value to retrieve.
  * @param default_value The default value to return if the key does not exist.
  * @return The value associated with the key, or the default value if the key does not exist.
  */
-QVariant Settings::getValue(const QString& group, const QString& key, const QVariant& default_value)
+QVariant Settings::getValue(const QString& group, const QString& key,
+                            const QVariant& default_value) const
 {
-    m_settings.beginGroup(group);
-    QVariant value = m_settings.value(key, default_value);
-    m_settings.endGroup();
-    return value;
+    CachedValue cached = cached_value(group, key);
+    return cached.exists ? cached.value : default_value;
+}
+
+/**
+ * @brief Gets the value associated with the specified key as an integer.
+ *
+ * @param group The group of the value to retrieve.
+ * @param key The key of the value to retrieve.
+ * @param default_value The value to return if the key does not exist or is not a number.
+ * @return The value as an integer, or the default value.
+ */
+int Settings::getInt(const QString& group, const QString& key, int default_value) const
+{
+    CachedValue cached = cached_value(group, key);
+    bool ok = false;
+    int value = cached.value.toInt(&ok);
+    return (cached.exists && ok) ? value : default_value;
+}
+
+/**
+ * @brief Gets the value associated with the specified key as a boolean.
+ *
+ * @param group The group of the value to retrieve.
+ * @param key The key of the value to retrieve.
+ * @param default_value The value to return if the key does not exist.
+ * @return The value as a boolean, or the default value.
+ */
+bool Settings::getBool(const QString& group, const QString& key, bool default_value) const
+{
+    CachedValue cached = cached_value(group, key);
+    return cached.exists ? cached.value.toBool() : default_value;
+}
+
+/**
+ * @brief Gets the value associated with the specified key as a floating-point number.
+ *
+ * @param group The group of the value to retrieve.
+ * @param key The key of the value to retrieve.
+ * @param default_value The value to return if the key does not exist or is not a number.
+ * @return The value as a floating-point number, or the default value.
+ */
+double Settings::getDouble(const QString& group, const QString& key, double default_value) const
+{
+    CachedValue cached = cached_value(group, key);
+    bool ok = false;
+    double value = cached.value.toDouble(&ok);
+    return (cached.exists && ok) ? value : default_value;
+}
+
+/**
+ * @brief Gets the value associated with the specified key as a string.
+ *
+ * @param group The group of the value to retrieve.
+ * @param key The key of the value to retrieve.
+ * @param default_value The value to return if the key does not exist.
+ * @return The value as a string, or the default value.
+ */
+QString Settings::getString(const QString& group, const QString& key,
+                            const QString& default_value) const
+{
+    CachedValue cached = cached_value(group, key);
+    return cached.exists ? cached.value.toString() : default_value;
 }
 
 /**
  * @brief Sets the value associated with the specified key in the settings.
  *
+ * Only the cache entry of this key is invalidated. The key is remembered as unsaved.
+ *
  * @param key The key of the value to set.
  * @param value The value to set.
  */
 void Settings::setValue(const QString& key, const QVariant& value)
 {
     m_settings.setValue(key, value);
+    invalidate(QString(), key);
+    mark_unsaved(QString(), key);
+    emit settingsChanged();
 }
 
 /**
  * @brief Sets the value associated with the specified key in the settings.
  *
+ * Only the cache entry of this key is invalidated. The key is remembered as unsaved.
+ *
  * @param group The group of the value to set.
  * @param key The key of the value to set.
  * @param value The value to set.
@@ -82,6 +162,9 @@ void Settings::setValue(const QString& group, const QString& key, const QVariant
     m_settings.beginGroup(group);
     m_settings.setValue(key, value);
     m_settings.endGroup();
+    invalidate(group, key);
+    mark_unsaved(group, key);
+    emit settingsChanged();
 }
 
 /**
@@ -91,7 +174,9 @@ void Settings::setValue(const QString& group, const QString& key, const QVariant
  */
 QStringList Settings::childGroups() const
 {
-    return m_settings.childGroups();
+    QStringList groups = m_settings.childGroups();
+    append_base_children(QString(), true, groups);
+    return groups;
 }
 
 /**
@@ -105,6 +190,7 @@ QStringList Settings::childGroups(const QString& group)
     m_settings.beginGroup(group);
     QStringList groups = m_settings.childGroups();
     m_settings.endGroup();
+    append_base_children(group, true, groups);
     return groups;
 }
 
@@ -119,6 +205,7 @@ QStringList Settings::childKeys(const QString& group)
     m_settings.beginGroup(group);
     QStringList keys = m_settings.childKeys();
     m_settings.endGroup();
+    append_base_children(group, false, keys);
     return keys;
 }
 
@@ -129,7 +216,27 @@ QStringList Settings::childKeys(const QString& group)
  */
 QStringList Settings::allKeys() const
 {
-    return m_settings.allKeys();
+    QStringList keys = m_settings.allKeys();
+    QReadLocker locker(&m_store->lock);
+    const BinarySettingsFile* base_file = m_store->base_file.get();
+
+    if (base_file != nullptr)
+    {
+        QSet<QString> native_keys(keys.cbegin(), keys.cend());
+        keys.reserve(keys.size() + base_file->key_count());
+
+        for (int index = 0; index < base_file->key_count(); ++index)
+        {
+            QString key = base_file->key_at(index);
+
+            if (!native_keys.contains(key))
+            {
+                keys.append(key);
+            }
+        }
+    }
+
+    return keys;
 }
 
 /**
@@ -138,9 +245,9 @@ QStringList Settings::allKeys() const
  * @param key The key to check.
  * @return True if the key exists, false otherwise.
  */
-bool Settings::contains(const QString& key)
+bool Settings::contains(const QString& key) const
 {
-    return m_settings.contains(key);
+    return cached_value(QString(), key).exists;
 }
 
 /**
@@ -150,18 +257,22 @@ bool Settings::contains(const QString& key)
  * @param key The key to check.
  * @return True if the key exists, false otherwise.
  */
-bool Settings::contains(const QString& group, const QString& key)
+bool Settings::contains(const QString& group, const QString& key) const
 {
-    m_settings.beginGroup(group);
-    bool exists = m_settings.contains(key);
-    m_settings.endGroup();
-    return exists;
+    return cached_value(group, key).exists;
 }
 
 /**
  * @brief Loads the settings from the specified file.
  *
  * This function clears the existing settings and loads the settings from the specified file.
+ * A binary settings file (BinarySettingsFile::format()) is mapped and kept below the native
+ * store, so nothing is copied and each value is only decoded when it is first read; keys set
+ * afterwards are written to the native store and shadow the file. The file stays mapped until
+ * the settings are cleared or loaded again. Other files are read in one pass into a snapshot,
+ * which is then written to the native store in one pass. Since the settings now match a file,
+ * settingsChanged() is not emitted. The cache is cleared, and no key is unsaved with respect to
+ * the file.
  *
  * @param file_path The file path of the settings file to load.
  * @param format The format of the settings file.
@@ -169,18 +280,52 @@ bool Settings::contains(const QString& group, const QString& key)
 void Settings::loadFromFile(const QString& file_path, QSettings::Format format)
 {
     qInfo() << "Loading settings from file: " << file_path;
-    QSettings file_settings(file_path, format);
-    clear();
-    qDebug() << "Copying settings from source (file_settings) to destination (m_settings)";
-    copy_settings(file_settings, m_settings);
-    qDebug() << "Loaded settings from file:" << file_path
-             << ". All loaded keys:" << m_settings.allKeys();
+    std::shared_ptr<BinarySettingsFile> base_file;
+    qsizetype key_count = 0;
+    m_settings.clear();
+
+    if (format == BinarySettingsFile::format())
+    {
+        base_file = std::make_shared<BinarySettingsFile>();
+
+        if (base_file->open(file_path))
+        {
+            key_count = base_file->key_count();
+        }
+        else
+        {
+            qWarning() << "Could not open binary settings file:" << file_path;
+            base_file = nullptr;
+        }
+    }
+    else
+    {
+        QSettings file_settings(file_path, format);
+        SettingsSnapshot file_values = read_snapshot(file_settings);
+        write_snapshot(file_values, m_settings);
+        key_count = file_values.size();
+    }
+
+    {
+        QWriteLocker locker(&m_store->lock);
+        m_store->cache.clear();
+        m_store->unsaved_keys.clear();
+        m_store->file_path = file_path;
+        m_store->file_format = format;
+        m_store->base_file = std::move(base_file);
+    }
+
+    qDebug() << "Loaded" << key_count << "keys from file:" << file_path;
 }
 
 /**
  * @brief Saves the settings to the specified file.
  *
- * This function saves the current settings to the specified file.
+ * If the file is the one the store was last loaded from or saved to, only the keys set since then
+ * through any Settings object on the store are written, so the cost depends on the number of
+ * changes, not on the number of keys. The file is assumed not to have been changed by anyone else
+ * in between. Otherwise all keys are compared with the file and only keys whose value differs are
+ * written, so the file is not rewritten at all if nothing has changed.
  *
  * @param file_path The file path of the settings file to save.
  * @param format The format of the settings file.
@@ -189,60 +334,404 @@ void Settings::saveToFile(const QString& file_path, QSettings::Format format)
 {
     qInfo() << "Saving settings to file:" << file_path;
     QSettings file_settings(file_path, format);
-    qDebug() << "Copying settings from source (m_settings) to destination (file_settings)";
-    copy_settings(m_settings, file_settings);
-    qDebug() << "Saved settings to file:" << file_path
-             << ". All saved keys:" << file_settings.allKeys();
+    SettingsSnapshot changes;
+    QSet<QString> unsaved_keys;
+    bool same_file = false;
+
+    {
+        QWriteLocker locker(&m_store->lock);
+        same_file = file_path == m_store->file_path && format == m_store->file_format &&
+                    QFileInfo::exists(file_path);
+        unsaved_keys.swap(m_store->unsaved_keys);
+        m_store->file_path = file_path;
+        m_store->file_format = format;
+    }
+
+    if (same_file)
+    {
+        for (const QString& key: std::as_const(unsaved_keys))
+        {
+            if (m_settings.contains(key))
+            {
+                changes.append(qMakePair(key, m_settings.value(key)));
+            }
+        }
+
+        m_last_save_key_count = unsaved_keys.size();
+    }
+    else
+    {
+        SettingsSnapshot all_values = snapshot();
+
+        for (const auto& [key, value]: all_values)
+        {
+            if (file_settings.value(key) != value)
+            {
+                changes.append(qMakePair(key, value));
+            }
+        }
+
+        m_last_save_key_count = all_values.size();
+    }
+
+    write_snapshot(changes, file_settings);
+    qDebug() << "Saved" << changes.size() << "changed keys to file:" << file_path;
+}
+
+/**
+ * @brief Clears the current session settings.
+ *
+ * This function clears the current session settings and the cache. The store no longer matches
+ * the file it was loaded from or saved to, so the next save compares all keys again.
+ */
+void Settings::clear()
+{
+    qInfo() << "Clearing current session settings";
+    m_settings.clear();
+
+    {
+        QWriteLocker locker(&m_store->lock);
+        m_store->cache.clear();
+        m_store->unsaved_keys.clear();
+        m_store->file_path.clear();
+        m_store->file_format = QSettings::IniFormat;
+        m_store->base_file = nullptr;
+    }
+
+    emit settingsChanged();
+}
+
+// NOLINTEND(modernize-use-trailing-return-type)
+
+/**
+ * @brief Returns all keys and values of the current session settings.
+ *
+ * Keys of a loaded binary settings file that have not been set since are included, which decodes
+ * all of their values.
+ *
+ * @return The full keys, including their groups, with their values.
+ */
+auto Settings::snapshot() const -> SettingsSnapshot
+{
+    SettingsSnapshot result = read_snapshot(m_settings);
+    // Decoding values fills the value cache of the file, so this needs the write lock
+    QWriteLocker locker(&m_store->lock);
+    const BinarySettingsFile* base_file = m_store->base_file.get();
+
+    if (base_file != nullptr)
+    {
+        QSet<QString> native_keys;
+        native_keys.reserve(result.size());
+
+        for (const auto& [key, value]: std::as_const(result))
+        {
+            native_keys.insert(key);
+        }
+
+        result.reserve(result.size() + base_file->key_count());
+
+        for (int index = 0; index < base_file->key_count(); ++index)
+        {
+            QString key = base_file->key_at(index);
+
+            if (!native_keys.contains(key))
+            {
+                result.append(qMakePair(key, base_file->value_at(index)));
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the number of reads answered from the cache.
+ *
+ * @return The number of cache hits.
+ */
+auto Settings::get_cache_hit_count() const -> qint64
+{
+    return m_cache_hits.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of reads that had to query QSettings.
+ *
+ * @return The number of cache misses.
+ */
+auto Settings::get_cache_miss_count() const -> qint64
+{
+    return m_cache_misses.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of keys set on the store since it was last loaded or saved.
+ *
+ * @return The number of unsaved keys.
+ */
+auto Settings::get_unsaved_key_count() const -> qsizetype
+{
+    QReadLocker locker(&m_store->lock);
+    return m_store->unsaved_keys.size();
+}
+
+/**
+ * @brief Returns the number of keys the last saveToFile() call looked at.
+ *
+ * @return The number of unsaved keys when saving to the same file again, otherwise the number of
+ * all keys.
+ */
+auto Settings::get_last_save_key_count() const -> qsizetype
+{
+    return m_last_save_key_count;
+}
+
+/**
+ * @brief Reads all keys and values of a QSettings object.
+ *
+ * Every key is visited exactly once, so this takes linear time in the number of keys regardless
+ * of how deeply the groups are nested.
+ *
+ * @param source The QSettings object to read.
+ * @return The full keys, including their groups, with their values.
+ */
+auto Settings::read_snapshot(const QSettings& source) -> SettingsSnapshot
+{
+    SettingsSnapshot result;
+    QStringList all_keys = source.allKeys();
+    result.reserve(all_keys.size());
+
+    for (const auto& key: all_keys)
+    {
+        result.append(qMakePair(key, source.value(key)));
+    }
+
+    return result;
 }
 
 /**
- * @brief Copies the settings from the source QSettings object to the destination QSettings object.
+ * @brief Writes all keys and values of a snapshot to a QSettings object.
  *
- * This function recursively copies all the settings, including child groups and keys, from the
- * source QSettings object to the destination QSettings object.
+ * The keys are written relative to the top level, so the destination must not be inside a group.
  *
- * @param source The source QSettings object.
- * @param destination The destination QSettings object.
+ * @param snapshot The snapshot to write.
+ * @param destination The QSettings object to write to.
  */
-void Settings::copy_settings(QSettings& source, QSettings& destination)
+auto Settings::write_snapshot(const SettingsSnapshot& snapshot, QSettings& destination) -> void
 {
-    for (const auto& child_key: source.childKeys())
+    for (const auto& [key, value]: snapshot)
     {
-        destination.setValue(child_key, source.value(child_key));
+        destination.setValue(key, value);
     }
+}
+
+/**
+ * @brief Returns the cached value of a key, reading it from QSettings on a miss.
+ *
+ * Keys that are not in QSettings are looked up in the loaded binary settings file, if any, which
+ * decodes only this value. Keys that do not exist are cached as well, so repeated reads of a
+ * missing key do not query QSettings either. Since the cache is shared by all Settings objects on
+ * the store, writes through any of them are seen. Writes through other QSettings objects or by
+ * other processes are only seen after clear() or loadFromFile().
+ *
+ * Hits only take the read lock of the store. A miss reads QSettings under the write lock, so a
+ * concurrent setValue() cannot invalidate the key between the read and the insertion.
+ *
+ * @param group The group of the key.
+ * @param key The key.
+ * @return The value and whether the key exists.
+ */
+auto Settings::cached_value(const QString& group, const QString& key) const -> CachedValue
+{
+    QString path = cache_key(group, key);
+    CachedValue result;
+    bool found = false;
 
-    for (const auto& child_group: source.childGroups())
     {
-        source.beginGroup(child_group);
-        destination.beginGroup(child_group);
+        QReadLocker locker(&m_store->lock);
+        auto it = m_store->cache.constFind(path);
 
-        for (const auto& child_key: source.childKeys())
+        if (it != m_store->cache.constEnd())
         {
-            destination.setValue(child_key, source.value(child_key));
-            copy_settings(source, destination);
+            result = it.value();
+            found = true;
         }
+    }
+
+    if (!found)
+    {
+        QWriteLocker locker(&m_store->lock);
+        auto it = m_store->cache.constFind(path);
+
+        if (it == m_store->cache.constEnd())
+        {
+            CachedValue cached;
+            cached.exists = m_settings.contains(path);
+            cached.value = cached.exists ? m_settings.value(path) : QVariant();
+
+            if (!cached.exists && m_store->base_file != nullptr)
+            {
+                int index = m_store->base_file->index_of(key_path(group, key));
+                cached.exists = index >= 0;
+                cached.value = cached.exists ? m_store->base_file->value_at(index) : QVariant();
+            }
 
-        for (const auto& child_group: source.childGroups())
+            it = m_store->cache.insert(path, cached);
+        }
+        else
         {
-            copy_settings(source, destination);
+            found = true;
         }
 
-        source.endGroup();
-        destination.endGroup();
+        result = it.value();
     }
+
+    (found ? m_cache_hits : m_cache_misses).fetch_add(1, std::memory_order_relaxed);
+
+    return result;
 }
 
 /**
- * @brief Clears the current session settings.
+ * @brief Removes the cache entry of a key.
+ *
+ * @param group The group of the key.
+ * @param key The key.
+ */
+auto Settings::invalidate(const QString& group, const QString& key) -> void
+{
+    QWriteLocker locker(&m_store->lock);
+    m_store->cache.remove(cache_key(group, key));
+}
+
+/**
+ * @brief Returns the shared state of a settings store, creating it if no Settings object uses it.
  *
- * This function clears the current session settings.
+ * @param name The file name or registry path of the store.
+ * @return The state of the store.
  */
-void Settings::clear()
+auto Settings::shared_store(const QString& name) -> std::shared_ptr<Store>
 {
-    qInfo() << "Clearing current session settings";
-    m_settings.clear();
+    static QMutex mutex;
+    static QHash<QString, std::weak_ptr<Store>> stores;
+    QMutexLocker locker(&mutex);
+    std::shared_ptr<Store> result = stores.value(name).lock();
+
+    if (result == nullptr)
+    {
+        result = std::make_shared<Store>();
+        stores.insert(name, result);
+    }
+
+    return result;
 }
 
-// NOLINTEND(modernize-use-trailing-return-type)
+/**
+ * @brief Remembers a key as set since the settings were last loaded or saved.
+ *
+ * @param group The group of the key.
+ * @param key The key.
+ */
+auto Settings::mark_unsaved(const QString& group, const QString& key) -> void
+{
+    QWriteLocker locker(&m_store->lock);
+    m_store->unsaved_keys.insert(group.isEmpty() ? key : group + QLatin1Char('/') + key);
+}
+
+/**
+ * @brief Appends the child groups or child keys of a group in the loaded binary settings file.
+ *
+ * Names that are already in the list, because they are in the native store, are skipped. The
+ * keys of the file are sorted, so the keys of the group are found by a binary search and each
+ * child group is skipped as a whole; no value is decoded.
+ *
+ * @param group The group.
+ * @param groups True to append the child groups, false to append the child keys.
+ * @param result The list to append to.
+ */
+auto Settings::append_base_children(const QString& group, bool groups, QStringList& result) const
+    -> void
+{
+    QReadLocker locker(&m_store->lock);
+    const BinarySettingsFile* base_file = m_store->base_file.get();
+
+    if (base_file != nullptr)
+    {
+        QString prefix = key_path(group, QString());
+        prefix += prefix.isEmpty() ? QString() : QStringLiteral("/");
+        QSet<QString> known_names(result.cbegin(), result.cend());
+        int index = base_file->lower_bound(prefix);
+        bool in_group = true;
+
+        while (index < base_file->key_count() && in_group)
+        {
+            QString key = base_file->key_at(index);
+            qsizetype separator = key.indexOf(QLatin1Char('/'), prefix.size());
+            in_group = key.startsWith(prefix);
+
+            if (in_group)
+            {
+                qsizetype name_end = (separator < 0) ? key.size() : separator;
+                QString name = key.sliced(prefix.size(), name_end - prefix.size());
+
+                if ((separator >= 0) == groups && !known_names.contains(name))
+                {
+                    result.append(name);
+                    known_names.insert(name);
+                }
+
+                // '0' follows '/', so all keys of a child group sort before its name plus '0'
+                index = (separator < 0) ? index + 1
+                                        : base_file->lower_bound(key.left(separator) +
+                                                                 QLatin1Char('0'));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Returns the full path of a key as QSettings stores it.
+ *
+ * Backslashes, repeated slashes and leading or trailing slashes are normalised the way QSettings
+ * does, so different spellings of the same key are the same path.
+ *
+ * @param group The group of the key.
+ * @param key The key.
+ * @return The full path of the key.
+ */
+auto Settings::key_path(const QString& group, const QString& key) -> QString
+{
+    QString result = group.isEmpty() ? key : group + QLatin1Char('/') + key;
+
+    if (result.contains(QLatin1Char('\\')) || result.contains(QLatin1String("//")) ||
+        result.startsWith(QLatin1Char('/')) || result.endsWith(QLatin1Char('/')))
+    {
+        result = result.replace(QLatin1Char('\\'), QLatin1Char('/'))
+                     .split(QLatin1Char('/'), Qt::SkipEmptyParts)
+                     .join(QLatin1Char('/'));
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the cache key of a key.
+ *
+ * Different spellings of the same key share one cache entry, see key_path().
+ *
+ * @param group The group of the key.
+ * @param key The key.
+ * @return The cache key.
+ */
+auto Settings::cache_key(const QString& group, const QString& key) -> QString
+{
+    QString result = key_path(group, key);
+
+#if defined(Q_OS_WIN)
+    // The registry ignores the case of keys
+    result = result.toLower();
+#endif
+
+    return result;
+}
 
 }  // namespace QmlApp
@@ -0,0 +1,172 @@
+/**
+ * @file SettingsPersister.cpp
+ * @brief This file contains the implementation of the SettingsPersister class.
+ */
+
+#include "Services/SettingsPersister.h"
+
+#include <QtConcurrent/QtConcurrent>
+#include <utility>
+
+#include "Services/BinarySettingsFile.h"
+
+namespace QmlApp
+{
+namespace
+{
+constexpr int kDefaultIdleDelayMs = 500;
+constexpr int kDefaultMaxDelayMs = 5000;
+}  // namespace
+
+/**
+ * @brief Constructs a SettingsPersister object that saves the given settings behind their changes.
+ *
+ * Every settingsChanged() signal marks the settings dirty. They are written once no change has
+ * happened for 500 ms, but at the latest 5 s after the first unsaved change, so a slider bound to
+ * a setting causes a handful of writes instead of one per step. The calling thread only takes a
+ * snapshot of the settings; the snapshot is written in the binary settings format on a worker
+ * thread, and the file is replaced atomically.
+ *
+ * @param settings The settings to save.
+ * @param file_path The path of the binary settings file.
+ * @param parent The parent object.
+ */
+SettingsPersister::SettingsPersister(Settings* settings, QString file_path, QObject* parent)
+    : QObject(parent), m_settings(settings), m_file_path(std::move(file_path))
+{
+    Q_ASSERT(settings != nullptr);
+
+    // A single worker keeps the writes in order
+    m_write_pool.setMaxThreadCount(1);
+    m_idle_timer.setSingleShot(true);
+    m_max_delay_timer.setSingleShot(true);
+    set_delays(kDefaultIdleDelayMs, kDefaultMaxDelayMs);
+
+    connect(m_settings, &Settings::settingsChanged, this, [this]() { mark_dirty(); });
+    connect(&m_idle_timer, &QTimer::timeout, this, [this]() { flush(); });
+    connect(&m_max_delay_timer, &QTimer::timeout, this, [this]() { flush(); });
+}
+
+/**
+ * @brief Destroys the SettingsPersister object after writing pending changes.
+ */
+SettingsPersister::~SettingsPersister()
+{
+    flush();
+    wait_for_pending_writes();
+}
+
+/**
+ * @brief Sets how long the settings may stay unsaved.
+ *
+ * @param idle_delay_ms The time without changes after which the settings are written.
+ * @param max_delay_ms The maximum time between the first unsaved change and the write.
+ */
+auto SettingsPersister::set_delays(int idle_delay_ms, int max_delay_ms) -> void
+{
+    m_idle_timer.setInterval(idle_delay_ms);
+    m_max_delay_timer.setInterval(max_delay_ms);
+}
+
+/**
+ * @brief Returns the path of the binary settings file.
+ *
+ * @return The path of the file.
+ */
+auto SettingsPersister::get_file_path() const -> QString
+{
+    return m_file_path;
+}
+
+/**
+ * @brief Checks if there are changes that have not been handed to the worker yet.
+ *
+ * @return True if the settings are dirty, false otherwise.
+ */
+auto SettingsPersister::is_dirty() const -> bool
+{
+    return m_dirty;
+}
+
+/**
+ * @brief Returns the number of files written so far.
+ *
+ * @return The number of writes, whether they succeeded or not.
+ */
+auto SettingsPersister::get_write_count() const -> int
+{
+    return m_write_count.load();
+}
+
+/**
+ * @brief Marks the settings dirty and schedules a write.
+ *
+ * Each call restarts the idle timer. The maximum delay timer is only started by the first change
+ * after a write.
+ */
+auto SettingsPersister::mark_dirty() -> void
+{
+    m_dirty = true;
+    m_idle_timer.start();
+
+    if (!m_max_delay_timer.isActive())
+    {
+        m_max_delay_timer.start();
+    }
+}
+
+/**
+ * @brief Hands the current settings to the worker if they are dirty.
+ *
+ * Only the snapshot is taken on the calling thread. saved() is emitted on the thread of this
+ * object once the file has been written.
+ */
+auto SettingsPersister::flush() -> void
+{
+    m_idle_timer.stop();
+    m_max_delay_timer.stop();
+
+    if (m_dirty)
+    {
+        m_dirty = false;
+        SettingsSnapshot snapshot = m_settings->snapshot();
+
+        QtConcurrent::run(&m_write_pool, [this, file_path = m_file_path,
+                                          snapshot = std::move(snapshot)]() {
+            bool success = BinarySettingsFile::write(file_path, snapshot);
+            m_write_count++;
+            QMetaObject::invokeMethod(
+                this, [this, success]() { emit saved(success); }, Qt::QueuedConnection);
+        });
+    }
+}
+
+/**
+ * @brief Writes the current settings on the calling thread, whether they are dirty or not.
+ *
+ * Pending writes finish first, so they cannot replace the file afterwards.
+ *
+ * @return True if the file was written, false otherwise.
+ */
+auto SettingsPersister::save_now() -> bool
+{
+    m_idle_timer.stop();
+    m_max_delay_timer.stop();
+    wait_for_pending_writes();
+
+    m_dirty = false;
+    bool success = BinarySettingsFile::write(m_file_path, m_settings->snapshot());
+    m_write_count++;
+    emit saved(success);
+
+    return success;
+}
+
+/**
+ * @brief Blocks until all writes handed to the worker have finished.
+ */
+auto SettingsPersister::wait_for_pending_writes() -> void
+{
+    m_write_pool.waitForDone();
+}
+}  // namespace QmlApp
@@ -7,6 +7,7 @@
 
 #include "QmlApplication.h"
 #include "Services/Logging/ConsoleAppender.h"
+#include "Services/Logging/CrashHandler.h"
 #include "Services/Logging/FileAppender.h"
 #include "Services/Logging/Logger.h"
 #include "Services/Logging/SimpleFormatter.h"
@@ -37,13 +38,15 @@ auto main(int argc, char* argv[]) -> int
     app.setOrganizationName(QStringLiteral("QmlDesktopAppTemplate"));
     app.setOrganizationDomain(QStringLiteral("AdrianHelbig.de"));
 
-    // Set up logging
+    // Set up logging. The JSON log and redaction are enabled from the settings, see QmlApplication
     auto formatter = QSharedPointer<SimpleFormatter>::create();
     auto console_appender = QSharedPointer<ConsoleAppender>::create(formatter);
     auto file_appender = QSharedPointer<FileAppender>::create("QmlApp.log", formatter);
+    file_appender->set_buffer_size(64 * 1024);
 
-    Logger::get_instance().add_appender(console_appender);
+    // The file appender comes first, so it has the fatal message before the console aborts
     Logger::get_instance().add_appender(file_appender);
+    Logger::get_instance().add_appender(console_appender);
 
     // Install the custom message handler
     qInstallMessageHandler(
@@ -51,6 +54,10 @@ auto main(int argc, char* argv[]) -> int
             Logger::get_instance().log(type, context, msg);
         });
 
+    // Write out the buffered log file contents if the process crashes
+    CrashHandler::install();
+    CrashHandler::register_appender(file_appender);
+
     QmlApplication qml_app;
 
     return qml_app.exec();
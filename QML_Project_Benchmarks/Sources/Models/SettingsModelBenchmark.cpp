@@ -0,0 +1,230 @@
+#include <benchmark/benchmark.h>
+
+#include <QModelIndex>
+#include <cstdlib>
+#include <memory>
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define QMLAPP_BENCHMARK_HAS_MALLINFO2
+#endif
+
+#include "Models/SettingsModel.h"
+#include "Models/SettingsNode.h"
+#include "Services/Settings.h"
+
+using namespace QmlApp;
+
+namespace
+{
+constexpr int kGroupCount = 100;
+constexpr int kSubGroupCount = 10;
+constexpr int kKeyCount = 100;
+
+/**
+ * @brief A settings model with 100 groups of 10 subgroups of 100 keys, about 101k nodes.
+ */
+struct LargeSettingsModel {
+        Settings settings;
+        std::unique_ptr<SettingsModel> model;
+
+        LargeSettingsModel()
+        {
+            settings.clear();
+            model = std::make_unique<SettingsModel>(&settings);
+
+            for (int group = 0; group < kGroupCount; ++group)
+            {
+                for (int sub_group = 0; sub_group < kSubGroupCount; ++sub_group)
+                {
+                    for (int key = 0; key < kKeyCount; ++key)
+                    {
+                        model->setValue(QStringLiteral("sub%1/key%2").arg(sub_group).arg(key),
+                                        key, QStringLiteral("group%1").arg(group));
+                    }
+                }
+            }
+        }
+
+        ~LargeSettingsModel()
+        {
+            model.reset();
+            settings.clear();
+        }
+};
+
+/**
+ * @brief Returns the model and its settings, building them on first use.
+ *
+ * @return The model and its settings.
+ */
+auto large_model() -> LargeSettingsModel&
+{
+    static LargeSettingsModel instance;
+    return instance;
+}
+
+/**
+ * @brief Returns the number of bytes currently allocated on the heap.
+ *
+ * @return The number of bytes, or -1 if the C library cannot report it.
+ */
+auto allocated_bytes() -> qint64
+{
+    qint64 result = -1;
+
+#if defined(QMLAPP_BENCHMARK_HAS_MALLINFO2)
+    struct mallinfo2 info = mallinfo2();
+    result = static_cast<qint64>(info.uordblks + info.hblkhd);
+#endif
+
+    return result;
+}
+
+/**
+ * @brief Expands every group below the parent, as a view that expands all items would.
+ *
+ * @param model The model.
+ * @param parent The parent index.
+ * @return The number of keys below the parent.
+ */
+auto fetch_all(QAbstractItemModel& model, const QModelIndex& parent) -> qint64
+{
+    qint64 keys = 0;
+
+    if (model.canFetchMore(parent))
+    {
+        model.fetchMore(parent);
+    }
+
+    for (int row = 0; row < model.rowCount(parent); ++row)
+    {
+        QModelIndex index = model.index(row, 0, parent);
+        keys += model.hasChildren(index) ? fetch_all(model, index) : 1;
+    }
+
+    return keys;
+}
+
+/**
+ * @brief Visits every index below the parent the way QAbstractItemModelTester checks a model.
+ *
+ * For every index, the row and column counts, the index itself, its parent and its display data
+ * are queried, and the parent is compared with the index it was created from.
+ *
+ * @param model The model.
+ * @param parent The parent index.
+ * @return The number of visited indexes.
+ */
+auto walk(const QAbstractItemModel& model, const QModelIndex& parent) -> qint64
+{
+    qint64 visited = 0;
+    int row_count = model.rowCount(parent);
+    int column_count = model.columnCount(parent);
+
+    for (int row = 0; row < row_count; ++row)
+    {
+        for (int column = 0; column < column_count; ++column)
+        {
+            QModelIndex index = model.index(row, column, parent);
+            benchmark::DoNotOptimize(model.data(index, Qt::DisplayRole));
+
+            if (model.parent(index) != parent)
+            {
+                return -1;
+            }
+
+            ++visited;
+        }
+
+        QModelIndex first_column = model.index(row, 0, parent);
+
+        if (model.hasChildren(first_column))
+        {
+            visited += walk(model, first_column);
+        }
+    }
+
+    return visited;
+}
+
+/**
+ * @brief Walks every index of a SettingsModel with about 101k nodes.
+ */
+auto BM_SettingsModelWalk(benchmark::State& state) -> void
+{
+    SettingsModel& model = *large_model().model;
+    qint64 visited = 0;
+
+    for (auto _: state)
+    {
+        visited = walk(model, QModelIndex());
+        benchmark::DoNotOptimize(visited);
+    }
+
+    if (visited < 0)
+    {
+        state.SkipWithError("parent() does not match the index it was created from");
+    }
+
+    state.SetItemsProcessed(state.iterations() * visited);
+    state.counters["indexes"] = static_cast<double>(visited);
+}
+
+/**
+ * @brief Loads a SettingsModel with 100k keys from its settings, expands every group and reports
+ * the heap memory the model uses per key.
+ *
+ * Every key name occurs in 1000 groups, so the interned names are shared by many nodes.
+ */
+auto BM_SettingsModelMemory(benchmark::State& state) -> void
+{
+    Settings& settings = large_model().settings;
+    qint64 bytes = 0;
+    qint64 keys = 0;
+
+    if (allocated_bytes() < 0)
+    {
+        state.SkipWithError("The C library cannot report the allocated memory");
+    }
+
+    for (auto _: state)
+    {
+        qint64 allocated_before = allocated_bytes();
+        auto model = std::make_unique<SettingsModel>(&settings);
+        keys = fetch_all(*model, QModelIndex());
+        bytes = allocated_bytes() - allocated_before;
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys);
+    state.counters["keys"] = static_cast<double>(keys);
+    state.counters["bytes_per_key"] =
+        (keys > 0) ? static_cast<double>(bytes) / static_cast<double>(keys) : 0.0;
+    state.counters["node_size"] = static_cast<double>(sizeof(SettingsNode));
+}
+
+/**
+ * @brief Destroys a SettingsModel with about 101k expanded nodes, which releases its node arena.
+ */
+auto BM_SettingsModelRelease(benchmark::State& state) -> void
+{
+    Settings& settings = large_model().settings;
+    qint64 keys = 0;
+
+    for (auto _: state)
+    {
+        state.PauseTiming();
+        auto model = std::make_unique<SettingsModel>(&settings);
+        keys = fetch_all(*model, QModelIndex());
+        state.ResumeTiming();
+
+        model.reset();
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys);
+}
+}  // namespace
+
+BENCHMARK(BM_SettingsModelWalk)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SettingsModelMemory)->Unit(benchmark::kMillisecond)->Iterations(3);
+BENCHMARK(BM_SettingsModelRelease)->Unit(benchmark::kMillisecond)->Iterations(5);
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <QDateTime>
+
+#include "Services/Logging/LogClock.h"
+
+using namespace QmlApp;
+
+namespace
+{
+/**
+ * @brief The timestamp path before LogClock: QDateTime::currentDateTime() per record.
+ */
+auto BM_QDateTimeCurrentDateTime(benchmark::State& state) -> void
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(QDateTime::currentDateTime());
+    }
+}
+
+/**
+ * @brief QDateTime::currentMSecsSinceEpoch(), which LogRecord::capture() used.
+ */
+auto BM_QDateTimeCurrentMSecsSinceEpoch(benchmark::State& state) -> void
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(QDateTime::currentMSecsSinceEpoch());
+    }
+}
+
+/**
+ * @brief LogClock::now(), which the logger calls per record.
+ */
+auto BM_LogClockNow(benchmark::State& state) -> void
+{
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(LogClock::now());
+    }
+
+    state.SetLabel(LogClock::source_name().toStdString());
+}
+
+/**
+ * @brief LogClock::to_date_time(), which the formatters call per written record.
+ */
+auto BM_LogClockToDateTime(benchmark::State& state) -> void
+{
+    quint64 ticks = LogClock::now();
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(LogClock::to_date_time(ticks));
+    }
+}
+}  // namespace
+
+BENCHMARK(BM_QDateTimeCurrentDateTime)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_QDateTimeCurrentMSecsSinceEpoch)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_LogClockNow)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_LogClockToDateTime);
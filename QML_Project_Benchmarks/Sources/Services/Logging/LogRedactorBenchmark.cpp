@@ -0,0 +1,157 @@
+#include <benchmark/benchmark.h>
+
+#include <QList>
+#include <QRegularExpression>
+#include <QString>
+
+#include "Services/Logging/LogRedactor.h"
+
+using namespace QmlApp;
+
+namespace
+{
+/**
+ * @brief Creates log lines with a total size of about the given number of kilobytes.
+ *
+ * @param kilobytes The total size of the lines.
+ * @param secret_every Every n-th line contains a token, an email address and a path; 0 for none.
+ * @return The lines.
+ */
+auto make_log_lines(qsizetype kilobytes, int secret_every) -> QList<QString>
+{
+    QList<QString> lines;
+    qsizetype bytes = 0;
+
+    for (int i = 0; bytes < kilobytes * 1024; i++)
+    {
+        QString line;
+
+        if (secret_every > 0 && i % secret_every == 0)
+        {
+            line = QStringLiteral("Request %1 sent with Bearer eyJhbGciOiJIUzI1NiJ9.%1 for "
+                                  "jane.doe@example.com, cache /home/jane/.cache/app/%1")
+                       .arg(i);
+        }
+        else
+        {
+            line = QStringLiteral("SettingsModel: loaded group \"Window\" with %1 keys in %2 ms")
+                       .arg(i % 50)
+                       .arg(i % 7);
+        }
+
+        bytes += line.toUtf8().size();
+        lines.append(line);
+    }
+
+    return lines;
+}
+
+/**
+ * @brief Reports the processed bytes and the time per kilobyte of log text.
+ *
+ * @param state The benchmark state.
+ * @param kilobytes The kilobytes processed per iteration.
+ */
+auto report_per_kilobyte(benchmark::State& state, qsizetype kilobytes) -> void
+{
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * kilobytes * 1024);
+    state.counters["time_per_KB"] = benchmark::Counter(
+        static_cast<double>(kilobytes),
+        benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+
+/**
+ * @brief Baseline: the UTF-8 conversion every redaction needs, without scanning.
+ */
+auto BM_Utf8Conversion(benchmark::State& state) -> void
+{
+    const QList<QString> lines = make_log_lines(state.range(0), 100);
+
+    for (auto _: state)
+    {
+        for (const QString& line: lines)
+        {
+            benchmark::DoNotOptimize(line.toUtf8());
+        }
+    }
+
+    report_per_kilobyte(state, state.range(0));
+}
+
+/**
+ * @brief Redaction of log text without any sensitive data.
+ */
+auto BM_RedactNoMatches(benchmark::State& state) -> void
+{
+    const LogRedactor redactor;
+    const QList<QString> lines = make_log_lines(state.range(0), 0);
+
+    for (auto _: state)
+    {
+        for (const QString& line: lines)
+        {
+            benchmark::DoNotOptimize(redactor.redact(line));
+        }
+    }
+
+    report_per_kilobyte(state, state.range(0));
+}
+
+/**
+ * @brief Redaction of log text where every 100th line contains three secrets.
+ */
+auto BM_RedactTypicalLog(benchmark::State& state) -> void
+{
+    const LogRedactor redactor;
+    const QList<QString> lines = make_log_lines(state.range(0), 100);
+
+    for (auto _: state)
+    {
+        for (const QString& line: lines)
+        {
+            benchmark::DoNotOptimize(redactor.redact(line));
+        }
+    }
+
+    report_per_kilobyte(state, state.range(0));
+}
+
+/**
+ * @brief Comparison: the default rules as a chain of QRegularExpression replacements.
+ */
+auto BM_RegexChainTypicalLog(benchmark::State& state) -> void
+{
+    const QList<QPair<QRegularExpression, QString>> chain = {
+        {QRegularExpression(QStringLiteral("Bearer [A-Za-z0-9\\-._~+/=]+")),
+         QStringLiteral("Bearer <token>")},
+        {QRegularExpression(QStringLiteral("(token|password|secret|api_key)=[^\\s\"'&,;]+")),
+         QStringLiteral("\\1=<redacted>")},
+        {QRegularExpression(QStringLiteral("[A-Za-z0-9._%+\\-]+@[A-Za-z0-9.\\-]+")),
+         QStringLiteral("<email>")},
+        {QRegularExpression(QStringLiteral("(/home/|/Users/|C:\\\\Users\\\\)[^\\s\"'<>|]+")),
+         QStringLiteral("<path>")}};
+    const QList<QString> lines = make_log_lines(state.range(0), 100);
+
+    for (auto _: state)
+    {
+        for (const QString& line: lines)
+        {
+            QString redacted = line;
+
+            for (const auto& [expression, replacement]: chain)
+            {
+                redacted.replace(expression, replacement);
+            }
+
+            benchmark::DoNotOptimize(redacted);
+        }
+    }
+
+    report_per_kilobyte(state, state.range(0));
+}
+}  // namespace
+
+BENCHMARK(BM_Utf8Conversion)->Arg(1)->Arg(64)->Arg(1024);
+BENCHMARK(BM_RedactNoMatches)->Arg(1)->Arg(64)->Arg(1024);
+BENCHMARK(BM_RedactTypicalLog)->Arg(1)->Arg(64)->Arg(1024);
+BENCHMARK(BM_RegexChainTypicalLog)->Arg(1)->Arg(64)->Arg(1024);
@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+
+#include <QMutex>
+#include <QSharedPointer>
+#include <QString>
+
+#include "Services/Logging/LogAppender.h"
+#include "Services/Logging/Logger.h"
+
+using namespace QmlApp;
+
+namespace
+{
+/**
+ * @brief An appender that stands in for a shared sink: every append takes the same lock.
+ */
+class SharedSinkAppender: public LogAppender
+{
+    protected:
+        auto internal_append(const LogMessage& message, const QMessageLogContext& /*context*/)
+            -> void override
+        {
+            QMutexLocker locker(&m_mutex);
+            m_bytes += message.get_message().size();
+        }
+
+    private:
+        QMutex m_mutex;
+        qsizetype m_bytes = 0;
+};
+
+/**
+ * @brief Registers a shared sink with the logger, optionally with batching enabled.
+ *
+ * @param batching Whether messages are staged per thread and dispatched by the writer thread.
+ */
+auto set_up_logger(bool batching) -> void
+{
+    Logger& logger = Logger::get_instance();
+    logger.set_log_level(QtDebugMsg);
+    logger.clear_appenders();
+    logger.add_appender(QSharedPointer<SharedSinkAppender>::create());
+
+    if (batching)
+    {
+        logger.enable_batching();
+    }
+}
+
+/**
+ * @brief Dispatches the remaining messages and restores the logger.
+ */
+auto tear_down_logger() -> void
+{
+    Logger::get_instance().disable_batching();
+    Logger::get_instance().clear_appenders();
+}
+
+/**
+ * @brief Logs debug messages from all benchmark threads.
+ *
+ * Every thread flushes the logger on its last iteration, so the reported throughput counts
+ * dispatched records and pending_at_end should be 0.
+ *
+ * @param state The benchmark state; range(0) selects batching.
+ */
+auto BM_LoggerThroughput(benchmark::State& state) -> void
+{
+    if (state.thread_index() == 0)
+    {
+        set_up_logger(state.range(0) != 0);
+    }
+
+    const QMessageLogContext context(__FILE__, __LINE__, "BM_LoggerThroughput", "benchmark");
+    const QString message = QStringLiteral("Worker finished a unit of work in 12 ms");
+    benchmark::IterationCount remaining = state.max_iterations;
+
+    for (auto _: state)
+    {
+        Logger::get_instance().log(QtDebugMsg, context, message);
+
+        // Dispatch the records still staged inside the timed region, so the batched rows include
+        // all the dispatch work the unbatched rows pay for
+        if (--remaining == 0)
+        {
+            Logger::get_instance().flush();
+        }
+    }
+
+    if (state.thread_index() == 0)
+    {
+        state.counters["pending_at_end"] =
+            static_cast<double>(Logger::get_instance().pending_record_count());
+        tear_down_logger();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+BENCHMARK(BM_LoggerThroughput)
+    ->ArgName("batching")
+    ->Arg(0)
+    ->Arg(1)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16)
+    ->Threads(64)
+    ->UseRealTime();
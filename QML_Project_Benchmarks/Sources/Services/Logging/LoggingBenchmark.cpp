@@ -0,0 +1,266 @@
+#include <benchmark/benchmark.h>
+
+#include <QDir>
+#include <QFile>
+#include <QMessageLogContext>
+#include <QSharedPointer>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "Services/Logging/ConsoleAppender.h"
+#include "Services/Logging/FileAppender.h"
+#include "Services/Logging/LatencyHistogram.h"
+#include "Services/Logging/Logger.h"
+#include "Services/Logging/SimpleFormatter.h"
+
+using namespace QmlApp;
+
+namespace
+{
+const int kMaxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+/**
+ * @brief Redirects stderr to the null device while it is alive.
+ */
+class StderrToNullDevice
+{
+    public:
+        StderrToNullDevice()
+        {
+            std::fflush(stderr);
+#ifdef Q_OS_WIN
+            m_saved_descriptor = _dup(_fileno(stderr));
+            std::FILE* null_device = std::fopen("NUL", "w");
+            _dup2(_fileno(null_device), _fileno(stderr));
+#else
+            m_saved_descriptor = dup(fileno(stderr));
+            std::FILE* null_device = std::fopen("/dev/null", "w");
+            dup2(fileno(null_device), fileno(stderr));
+#endif
+            std::fclose(null_device);
+        }
+
+        ~StderrToNullDevice()
+        {
+            std::fflush(stderr);
+#ifdef Q_OS_WIN
+            _dup2(m_saved_descriptor, _fileno(stderr));
+            _close(m_saved_descriptor);
+#else
+            dup2(m_saved_descriptor, fileno(stderr));
+            close(m_saved_descriptor);
+#endif
+        }
+
+    private:
+        int m_saved_descriptor = -1;
+};
+
+/**
+ * @brief Returns a directory in memory for log files if there is one, else the temp directory.
+ *
+ * @return The directory path.
+ */
+auto tmpfs_directory() -> QString
+{
+    return QDir(QStringLiteral("/dev/shm")).exists() ? QStringLiteral("/dev/shm")
+                                                     : QDir::tempPath();
+}
+
+/**
+ * @brief Runs the operation once per iteration on every benchmark thread and reports latencies.
+ *
+ * Each call is timed individually and counted in a histogram shared by all threads, which adds
+ * the cost of two clock reads to every sample. Thread 0 reports the p50, p99 and p999 latencies
+ * in nanoseconds; every thread reports its records, so the items per second are the total rate.
+ *
+ * @param state The benchmark state.
+ * @param histogram The histogram shared by the threads of this benchmark.
+ * @param operation The operation to measure.
+ */
+template <typename Operation>
+auto measure(benchmark::State& state, LatencyHistogram& histogram, const Operation& operation)
+    -> void
+{
+    if (state.thread_index() == 0)
+    {
+        histogram.reset();
+    }
+
+    for (auto _: state)
+    {
+        auto start = std::chrono::steady_clock::now();
+        operation();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        histogram.record(static_cast<quint64>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        LatencyHistogram::Snapshot snapshot = histogram.snapshot();
+        state.counters["p50_ns"] = static_cast<double>(snapshot.percentile(0.5));
+        state.counters["p99_ns"] = static_cast<double>(snapshot.percentile(0.99));
+        state.counters["p999_ns"] = static_cast<double>(snapshot.percentile(0.999));
+    }
+}
+
+/**
+ * @brief Registers the given appender as the only one and sets the log level.
+ *
+ * @param appender The appender, or nullptr for none.
+ * @param level The log level of the logger.
+ */
+auto set_up_logger(const QSharedPointer<LogAppender>& appender, QtMsgType level) -> void
+{
+    Logger& logger = Logger::get_instance();
+    logger.clear_appenders();
+    logger.set_log_level(level);
+
+    if (appender != nullptr)
+    {
+        logger.add_appender(appender);
+    }
+}
+
+/**
+ * @brief Restores the logger.
+ */
+auto tear_down_logger() -> void
+{
+    Logger::get_instance().clear_appenders();
+    Logger::get_instance().set_log_level(QtDebugMsg);
+}
+
+const QMessageLogContext kContext("main.cpp", 42, "main", "app");
+const QString kMessage = QStringLiteral("Loaded 42 settings from the user configuration in 3 ms");
+
+/**
+ * @brief Logger::log with no appenders: the fixed cost of every accepted record.
+ */
+auto BM_LoggerNoAppenders(benchmark::State& state) -> void
+{
+    static LatencyHistogram histogram;
+
+    if (state.thread_index() == 0)
+    {
+        set_up_logger(nullptr, QtDebugMsg);
+    }
+
+    measure(state, histogram,
+            []() { Logger::get_instance().log(QtDebugMsg, kContext, kMessage); });
+
+    if (state.thread_index() == 0)
+    {
+        tear_down_logger();
+    }
+}
+
+/**
+ * @brief Logger::log with a record below the log level: the cost of a disabled qDebug().
+ */
+auto BM_LoggerFilteredLevel(benchmark::State& state) -> void
+{
+    static LatencyHistogram histogram;
+
+    if (state.thread_index() == 0)
+    {
+        set_up_logger(QSharedPointer<ConsoleAppender>::create(), QtWarningMsg);
+    }
+
+    measure(state, histogram,
+            []() { Logger::get_instance().log(QtDebugMsg, kContext, kMessage); });
+
+    if (state.thread_index() == 0)
+    {
+        tear_down_logger();
+    }
+}
+
+/**
+ * @brief SimpleFormatter::format on its own.
+ */
+auto BM_SimpleFormatterFormat(benchmark::State& state) -> void
+{
+    static LatencyHistogram histogram;
+    SimpleFormatter formatter;
+    const LogMessage message(QtDebugMsg, kMessage);
+
+    measure(state, histogram,
+            [&]() { benchmark::DoNotOptimize(formatter.format(message, kContext)); });
+}
+
+/**
+ * @brief Logger::log into a ConsoleAppender whose output goes to the null device.
+ */
+auto BM_ConsoleAppenderNullDevice(benchmark::State& state) -> void
+{
+    static LatencyHistogram histogram;
+    static std::unique_ptr<StderrToNullDevice> redirect;
+
+    if (state.thread_index() == 0)
+    {
+        set_up_logger(QSharedPointer<ConsoleAppender>::create(), QtDebugMsg);
+        redirect = std::make_unique<StderrToNullDevice>();
+    }
+
+    measure(state, histogram,
+            []() { Logger::get_instance().log(QtDebugMsg, kContext, kMessage); });
+
+    if (state.thread_index() == 0)
+    {
+        redirect.reset();
+        tear_down_logger();
+    }
+}
+
+/**
+ * @brief Logger::log into a FileAppender on tmpfs.
+ *
+ * @param state The benchmark state; range(0) is the write buffer size in KB, 0 writes through.
+ */
+auto BM_FileAppenderTmpfs(benchmark::State& state) -> void
+{
+    static LatencyHistogram histogram;
+    const QString file_path = tmpfs_directory() + QStringLiteral("/QmlApp_benchmark.log");
+
+    if (state.thread_index() == 0)
+    {
+        QFile::remove(file_path);
+        auto appender = QSharedPointer<FileAppender>::create(file_path);
+        appender->set_buffer_size(state.range(0) * 1024);
+        set_up_logger(appender, QtDebugMsg);
+    }
+
+    measure(state, histogram,
+            []() { Logger::get_instance().log(QtDebugMsg, kContext, kMessage); });
+
+    if (state.thread_index() == 0)
+    {
+        tear_down_logger();
+        QFile::remove(file_path);
+    }
+}
+}  // namespace
+
+BENCHMARK(BM_LoggerNoAppenders)->ThreadRange(1, kMaxThreads)->UseRealTime();
+BENCHMARK(BM_LoggerFilteredLevel)->ThreadRange(1, kMaxThreads)->UseRealTime();
+BENCHMARK(BM_SimpleFormatterFormat)->ThreadRange(1, kMaxThreads)->UseRealTime();
+BENCHMARK(BM_ConsoleAppenderNullDevice)->ThreadRange(1, kMaxThreads)->UseRealTime();
+BENCHMARK(BM_FileAppenderTmpfs)
+    ->ArgName("buffer_KB")
+    ->Arg(0)
+    ->Arg(64)
+    ->ThreadRange(1, kMaxThreads)
+    ->UseRealTime();
@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include <QMessageLogContext>
+
+#include "Services/Logging/JsonFormatter.h"
+#include "Services/Logging/StackTrace.h"
+
+using namespace QmlApp;
+
+namespace
+{
+/**
+ * @brief Calls itself until the given depth is reached and then runs the function.
+ */
+template <typename Function>
+Q_NEVER_INLINE auto at_depth(int depth, const Function& function) -> void
+{
+    if (depth > 0)
+    {
+        at_depth(depth - 1, function);
+        benchmark::ClobberMemory();
+    }
+    else
+    {
+        function();
+    }
+}
+
+/**
+ * @brief Captures the raw return addresses, as done for every critical record.
+ */
+auto BM_StackTraceCapture(benchmark::State& state) -> void
+{
+    at_depth(static_cast<int>(state.range(0)), [&state]() {
+        for (auto _: state)
+        {
+            benchmark::DoNotOptimize(StackTrace::capture());
+        }
+    });
+}
+
+/**
+ * @brief Formats a critical record with its stack frames as JSON.
+ */
+auto BM_JsonFormatWithStack(benchmark::State& state) -> void
+{
+    JsonFormatter formatter;
+    QMessageLogContext context("main.cpp", 42, "main", "app");
+    LogMessage message(QtCriticalMsg, QStringLiteral("Failed to open settings file"));
+    message.set_stack_frames(StackTrace::capture());
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(formatter.format(message, context));
+    }
+}
+}  // namespace
+
+BENCHMARK(BM_StackTraceCapture)->Arg(4)->Arg(16)->Arg(64);
+BENCHMARK(BM_JsonFormatWithStack);
@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include <QMessageLogContext>
+#include <QSharedPointer>
+
+#include "Services/Logging/LogAppender.h"
+#include "Services/Logging/LogFormatter.h"
+#include "Services/Logging/SimpleFormatter.h"
+#include "Services/Logging/StaticAppender.h"
+
+using namespace QmlApp;
+
+namespace
+{
+/**
+ * @brief A sink that only counts bytes, so the benchmarks measure the dispatch chain.
+ */
+class CountingSink
+{
+    public:
+        static constexpr const char* kName = "counting";
+
+        auto write(const QString& line, QtMsgType /*type*/) -> qsizetype
+        {
+            m_bytes += line.size();
+            return line.size();
+        }
+
+        auto flush() -> void {}
+        auto emergency_flush() -> void {}
+
+    private:
+        qsizetype m_bytes = 0;
+};
+
+/**
+ * @brief A formatter that returns the message text, so formatting does not hide the call cost.
+ */
+class MessageOnlyFormatter final: public LogFormatter
+{
+    public:
+        auto format(const LogMessage& log_message, const QMessageLogContext& /*context*/)
+            -> QString override
+        {
+            return log_message.get_message();
+        }
+};
+
+/**
+ * @brief The virtual chain: appender, then formatter through a QSharedPointer, then the sink.
+ */
+class VirtualChainAppender: public LogAppender
+{
+    public:
+        explicit VirtualChainAppender(const QSharedPointer<LogFormatter>& formatter)
+            : LogAppender(formatter)
+        {}
+
+    private:
+        auto internal_append(const LogMessage& message, const QMessageLogContext& context)
+            -> void override
+        {
+            qsizetype written_bytes =
+                m_sink.write(m_formatter->format(message, context), message.get_type());
+            m_metrics.record_bytes(static_cast<quint64>(written_bytes));
+        }
+
+    private:
+        CountingSink m_sink;
+};
+
+/**
+ * @brief Appends records through the LogAppender interface, as the Logger does.
+ *
+ * @param state The benchmark state.
+ * @param appender The appender.
+ */
+auto append_records(benchmark::State& state, const QSharedPointer<LogAppender>& appender) -> void
+{
+    const QMessageLogContext context("main.cpp", 42, "main", "app");
+    const LogMessage message(QtInfoMsg, QStringLiteral("Loaded 42 settings in 3 ms"));
+
+    for (auto _: state)
+    {
+        appender->append(message, context);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+auto BM_VirtualChainMessageOnly(benchmark::State& state) -> void
+{
+    append_records(state, QSharedPointer<VirtualChainAppender>::create(
+                               QSharedPointer<MessageOnlyFormatter>::create()));
+}
+
+auto BM_StaticAppenderMessageOnly(benchmark::State& state) -> void
+{
+    append_records(state,
+                   QSharedPointer<StaticAppender<MessageOnlyFormatter, CountingSink>>::create());
+}
+
+auto BM_VirtualChainSimpleFormatter(benchmark::State& state) -> void
+{
+    append_records(state, QSharedPointer<VirtualChainAppender>::create(
+                               QSharedPointer<SimpleFormatter>::create()));
+}
+
+auto BM_StaticAppenderSimpleFormatter(benchmark::State& state) -> void
+{
+    append_records(state, QSharedPointer<StaticAppender<SimpleFormatter, CountingSink>>::create());
+}
+}  // namespace
+
+BENCHMARK(BM_VirtualChainMessageOnly);
+BENCHMARK(BM_StaticAppenderMessageOnly);
+BENCHMARK(BM_VirtualChainSimpleFormatter);
+BENCHMARK(BM_StaticAppenderSimpleFormatter);
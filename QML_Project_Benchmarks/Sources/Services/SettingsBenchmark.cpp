@@ -0,0 +1,188 @@
+#include <benchmark/benchmark.h>
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QSettings>
+#include <QString>
+
+#include "Services/BinarySettingsFile.h"
+#include "Services/Settings.h"
+
+using namespace QmlApp;
+
+namespace
+{
+const QString kGroup = QStringLiteral("SettingsBenchmark");
+const QString kKey = QStringLiteral("width");
+
+/**
+ * @brief The read path before the cache: beginGroup(), value() and endGroup() on QSettings.
+ */
+auto BM_QSettingsGroupValue(benchmark::State& state) -> void
+{
+    QSettings settings;
+    settings.setValue(kGroup + QLatin1Char('/') + kKey, 800);
+
+    for (auto _: state)
+    {
+        settings.beginGroup(kGroup);
+        benchmark::DoNotOptimize(settings.value(kKey));
+        settings.endGroup();
+    }
+
+    settings.remove(kGroup);
+}
+
+/**
+ * @brief Settings::getValue() for a key that is already cached, as a QML binding reads it.
+ */
+auto BM_SettingsGetValueCached(benchmark::State& state) -> void
+{
+    Settings settings;
+    settings.setValue(kGroup, kKey, 800);
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(settings.getValue(kGroup, kKey));
+    }
+
+    state.counters["hits"] = static_cast<double>(settings.get_cache_hit_count());
+    state.counters["misses"] = static_cast<double>(settings.get_cache_miss_count());
+    QSettings().remove(kGroup);
+}
+
+/**
+ * @brief Settings::getInt() for a key that is already cached.
+ */
+auto BM_SettingsGetIntCached(benchmark::State& state) -> void
+{
+    Settings settings;
+    settings.setValue(kGroup, kKey, 800);
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(settings.getInt(kGroup, kKey));
+    }
+
+    QSettings().remove(kGroup);
+}
+
+/**
+ * @brief Settings::saveToFile() into a new file and loadFromFile() of it, for range(0) groups of
+ * 1000 keys four levels deep. The time should grow linearly with the number of groups.
+ */
+auto BM_SettingsSaveAndLoadNested(benchmark::State& state) -> void
+{
+    QString file_path = QCoreApplication::applicationDirPath() + "/settingsbenchmark_nested.ini";
+    auto group_count = static_cast<int>(state.range(0));
+    Settings settings;
+    settings.clear();
+
+    for (int group = 0; group < group_count; group++)
+    {
+        for (int key = 0; key < 1000; key++)
+        {
+            QString path = QStringLiteral("Sub%1/Deep%2/key%3")
+                               .arg(key / 100)
+                               .arg(key / 10 % 10)
+                               .arg(key % 10);
+            settings.setValue(kGroup + QString::number(group), path, key);
+        }
+    }
+
+    for (auto _: state)
+    {
+        state.PauseTiming();
+        QFile::remove(file_path);
+        state.ResumeTiming();
+
+        settings.saveToFile(file_path);
+        settings.loadFromFile(file_path);
+    }
+
+    state.SetItemsProcessed(state.iterations() * group_count * 1000);
+    state.SetComplexityN(state.range(0));
+    settings.clear();
+    QFile::remove(file_path);
+}
+
+/**
+ * @brief Writes a binary settings file with range(0) groups of 1000 keys.
+ */
+auto write_binary_file(const benchmark::State& state, const QString& file_path) -> void
+{
+    SettingsSnapshot file_values;
+
+    for (int group = 0; group < static_cast<int>(state.range(0)); group++)
+    {
+        for (int key = 0; key < 1000; key++)
+        {
+            file_values.append(
+                qMakePair(kGroup + QString::number(group) + QStringLiteral("/key%1").arg(key),
+                          QVariant(QStringLiteral("value%1").arg(key))));
+        }
+    }
+
+    BinarySettingsFile::write(file_path, file_values);
+}
+
+/**
+ * @brief The startup path before settings.bin was mapped: QSettings with the binary format,
+ * which decodes every value, followed by reading one key.
+ */
+auto BM_QSettingsLoadBinaryFile(benchmark::State& state) -> void
+{
+    QString file_path = QCoreApplication::applicationDirPath() + "/settingsbenchmark_load.bin";
+    write_binary_file(state, file_path);
+
+    for (auto _: state)
+    {
+        QSettings file_settings(file_path, BinarySettingsFile::format());
+        benchmark::DoNotOptimize(file_settings.value(kGroup + QStringLiteral("0/key0")));
+    }
+
+    state.SetComplexityN(state.range(0));
+    QFile::remove(file_path);
+}
+
+/**
+ * @brief The startup path: Settings::loadFromFile() of settings.bin, followed by reading one key.
+ * Only that value is decoded, so the time should grow much slower than the number of keys.
+ */
+auto BM_SettingsLoadBinaryFile(benchmark::State& state) -> void
+{
+    QString file_path = QCoreApplication::applicationDirPath() + "/settingsbenchmark_load.bin";
+    write_binary_file(state, file_path);
+    Settings settings;
+
+    for (auto _: state)
+    {
+        settings.loadFromFile(file_path, BinarySettingsFile::format());
+        benchmark::DoNotOptimize(settings.getValue(kGroup + QStringLiteral("0"), "key0"));
+    }
+
+    state.SetComplexityN(state.range(0));
+    settings.clear();
+    QFile::remove(file_path);
+}
+}  // namespace
+
+BENCHMARK(BM_QSettingsGroupValue);
+BENCHMARK(BM_SettingsGetValueCached);
+BENCHMARK(BM_SettingsGetIntCached);
+BENCHMARK(BM_SettingsSaveAndLoadNested)
+    ->Arg(10)
+    ->Arg(25)
+    ->Arg(50)
+    ->Complexity(benchmark::oN)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_QSettingsLoadBinaryFile)
+    ->Arg(10)
+    ->Arg(50)
+    ->Complexity()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SettingsLoadBinaryFile)
+    ->Arg(10)
+    ->Arg(50)
+    ->Complexity()
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,23 @@
+#include <benchmark/benchmark.h>
+
+#include <QCoreApplication>
+
+auto main(int argc, char* argv[]) -> int
+{
+    benchmark::Initialize(&argc, argv);
+
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    QCoreApplication app(argc, argv);
+    app.setApplicationName(QStringLiteral("QmlAppBenchmarks"));
+    app.setOrganizationName(QStringLiteral("QmlDesktopAppTemplate_Benchmarks"));
+    app.setOrganizationDomain(QStringLiteral("AdrianHelbig.de"));
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <QList>
+#include <QtGlobal>
+
+#include "Services/Logging/LogRecord.h"
+
+namespace QmlApp
+{
+/**
+ * @struct LogReplayOptions
+ * @brief Controls how a LogReplayer feeds records to the logger.
+ */
+struct LogReplayOptions {
+        bool original_timing = false;
+        double speed = 1.0;
+        int repeat = 1;
+};
+
+/**
+ * @struct LogReplayReport
+ * @brief The outcome of a replay.
+ */
+struct LogReplayReport {
+        quint64 records_replayed = 0;
+        qint64 elapsed_ns = 0;
+        qint64 max_lag_ms = 0;
+        quint64 queue_depth_samples = 0;
+        qsizetype max_queue_depth = 0;
+        double mean_queue_depth = 0.0;
+
+        /**
+         * @brief Returns the achieved throughput.
+         *
+         * @return The number of records per second, or 0 if nothing was replayed.
+         */
+        [[nodiscard]] auto records_per_second() const -> double;
+};
+
+/**
+ * @class LogReplayer
+ * @brief Replays parsed log records through Logger::log().
+ *
+ * The records are logged from the calling thread either as fast as possible or with their
+ * original inter-arrival times, scaled by the speed factor. The logger and its appenders have to
+ * be set up by the caller. While the logger batches, the number of staged records is sampled to
+ * report the queue depth. The elapsed time includes the final Logger::flush().
+ *
+ * Fatal records are replayed as critical ones, since a fatal message ends the process.
+ */
+class LogReplayer
+{
+    public:
+        static constexpr int kQueueDepthSampleInterval = 16;
+
+        /**
+         * @brief Constructs a LogReplayer object.
+         *
+         * @param options The replay options.
+         */
+        explicit LogReplayer(LogReplayOptions options = {});
+
+        /**
+         * @brief Replays the records through the logger.
+         *
+         * @param records The records in the order they are logged.
+         * @return The report.
+         */
+        [[nodiscard]] auto replay(const QList<LogRecord>& records) const -> LogReplayReport;
+
+    private:
+        LogReplayOptions m_options;
+};
+}  // namespace QmlApp
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <QString>
+#include <QtGlobal>
+
+namespace QmlApp
+{
+/**
+ * @class NullSink
+ * @brief A sink for the StaticAppender that discards every line.
+ *
+ * Replaying into it measures the logger and the formatter without any I/O.
+ */
+class NullSink
+{
+    public:
+        static constexpr const char* kName = "null";
+
+        /**
+         * @brief Discards the line.
+         *
+         * @param line The formatted line.
+         * @return The number of bytes that would have been written.
+         */
+        auto write(const QString& line, QtMsgType /*type*/) -> qsizetype
+        {
+            return line.size();
+        }
+
+        /**
+         * @brief Does nothing; nothing is buffered.
+         */
+        auto flush() -> void {}
+
+        /**
+         * @brief Does nothing; nothing is buffered.
+         */
+        auto emergency_flush() -> void {}
+};
+}  // namespace QmlApp
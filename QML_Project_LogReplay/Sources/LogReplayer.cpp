@@ -0,0 +1,104 @@
+/**
+ * @file LogReplayer.cpp
+ * @brief This file contains the implementation of the LogReplayer class.
+ */
+
+#include "LogReplayer.h"
+
+#include <QElapsedTimer>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "Services/Logging/Logger.h"
+
+namespace QmlApp
+{
+/**
+ * @brief Returns the achieved throughput.
+ *
+ * @return The number of records per second, or 0 if nothing was replayed.
+ */
+auto LogReplayReport::records_per_second() const -> double
+{
+    return (elapsed_ns > 0) ? static_cast<double>(records_replayed) * 1e9 /
+                                  static_cast<double>(elapsed_ns)
+                            : 0.0;
+}
+
+/**
+ * @brief Constructs a LogReplayer object.
+ *
+ * @param options The replay options.
+ */
+LogReplayer::LogReplayer(LogReplayOptions options): m_options(options) {}
+
+/**
+ * @brief Replays the records through the logger.
+ *
+ * With the original timing, each record is due at its offset from the first record divided by
+ * the speed factor, and every repetition starts where the previous one ended. A record that is due
+ * in the future is waited for; for a record that is overdue, the delay is reported as lag.
+ *
+ * @param records The records in the order they are logged.
+ * @return The report.
+ */
+auto LogReplayer::replay(const QList<LogRecord>& records) const -> LogReplayReport
+{
+    LogReplayReport report;
+    Logger& logger = Logger::get_instance();
+    qint64 first_ms = records.isEmpty() ? 0 : records.first().msecs_since_epoch();
+    qint64 span_ms =
+        records.isEmpty() ? 0 : std::max<qint64>(records.last().msecs_since_epoch() - first_ms, 0);
+    double speed = (m_options.speed > 0.0) ? m_options.speed : 1.0;
+    double queue_depth_sum = 0.0;
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int repetition = 0; repetition < m_options.repeat; ++repetition)
+    {
+        for (const LogRecord& record: records)
+        {
+            if (m_options.original_timing)
+            {
+                qint64 offset_ms = repetition * span_ms +
+                                   std::max<qint64>(record.msecs_since_epoch() - first_ms, 0);
+                auto due_ns = static_cast<qint64>(static_cast<double>(offset_ms) * 1e6 / speed);
+                qint64 now_ns = timer.nsecsElapsed();
+
+                if (due_ns > now_ns)
+                {
+                    std::this_thread::sleep_for(std::chrono::nanoseconds(due_ns - now_ns));
+                }
+                else
+                {
+                    report.max_lag_ms = std::max(report.max_lag_ms, (now_ns - due_ns) / 1000000);
+                }
+            }
+
+            QtMsgType type = (record.type == QtFatalMsg) ? QtCriticalMsg : record.type;
+            logger.log(type, record.context(), record.message);
+            ++report.records_replayed;
+
+            if (logger.is_batching() &&
+                report.records_replayed % kQueueDepthSampleInterval == 0)
+            {
+                qsizetype depth = logger.pending_record_count();
+                report.max_queue_depth = std::max(report.max_queue_depth, depth);
+                queue_depth_sum += static_cast<double>(depth);
+                ++report.queue_depth_samples;
+            }
+        }
+    }
+
+    logger.flush();
+    report.elapsed_ns = timer.nsecsElapsed();
+
+    if (report.queue_depth_samples > 0)
+    {
+        report.mean_queue_depth = queue_depth_sum / static_cast<double>(report.queue_depth_samples);
+    }
+
+    return report;
+}
+}  // namespace QmlApp
@@ -0,0 +1,236 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QSharedPointer>
+#include <QTextStream>
+#include <algorithm>
+
+#include "LogReplayer.h"
+#include "NullSink.h"
+#include "Services/Logging/ConsoleSink.h"
+#include "Services/Logging/FileSink.h"
+#include "Services/Logging/JsonFormatter.h"
+#include "Services/Logging/LocalSocketAppender.h"
+#include "Services/Logging/LogLineParser.h"
+#include "Services/Logging/Logger.h"
+#include "Services/Logging/SimpleFormatter.h"
+#include "Services/Logging/StaticAppender.h"
+
+using namespace QmlApp;
+
+namespace
+{
+/**
+ * @brief Creates an appender from a command line specification.
+ *
+ * @param spec One of "null", "console", "file:<path>", "json:<path>" or "socket:<server name>".
+ * @param buffer_size The write buffer size of file appenders in bytes.
+ * @return The appender, or nullptr if the specification is unknown.
+ */
+auto create_appender(const QString& spec, qsizetype buffer_size) -> QSharedPointer<LogAppender>
+{
+    QString kind = spec.section(QLatin1Char(':'), 0, 0);
+    QString target = spec.section(QLatin1Char(':'), 1);
+    QSharedPointer<LogAppender> appender;
+
+    if (kind == QStringLiteral("null"))
+    {
+        appender = QSharedPointer<StaticAppender<SimpleFormatter, NullSink>>::create();
+    }
+    else if (kind == QStringLiteral("console"))
+    {
+        appender = QSharedPointer<StaticAppender<SimpleFormatter, ConsoleSink>>::create();
+    }
+    else if (kind == QStringLiteral("file") && !target.isEmpty())
+    {
+        appender = QSharedPointer<StaticAppender<SimpleFormatter, FileSink>>::create(target,
+                                                                                   buffer_size);
+    }
+    else if (kind == QStringLiteral("json") && !target.isEmpty())
+    {
+        appender = QSharedPointer<StaticAppender<JsonFormatter, FileSink>>::create(target,
+                                                                                 buffer_size);
+        appender->set_name(QStringLiteral("json"));
+    }
+    else if (kind == QStringLiteral("socket") && !target.isEmpty())
+    {
+        appender = QSharedPointer<LocalSocketAppender>::create(target);
+        appender->set_name(QStringLiteral("socket"));
+    }
+
+    return appender;
+}
+
+/**
+ * @brief Prints the replay report and the counters of the logger and every appender.
+ *
+ * Records are dropped by the logger if they are below its level, by an appender if they are below
+ * the appender's level, and by a socket appender if its spill buffer is full.
+ *
+ * @param report The replay report.
+ * @param out The stream to print to.
+ */
+auto print_report(const LogReplayReport& report, QTextStream& out) -> void
+{
+    Logger& logger = Logger::get_instance();
+    LogMetricsSnapshot logger_metrics = logger.get_metrics().snapshot();
+
+    out << "Replayed " << report.records_replayed << " records in "
+        << static_cast<double>(report.elapsed_ns) / 1e9 << " s ("
+        << qRound64(report.records_per_second()) << " records/s)\n";
+    out << "Logger: " << logger_metrics.total_records() << " accepted, "
+        << logger_metrics.records_filtered << " dropped below level, log latency p50 "
+        << logger_metrics.latency.percentile(0.5) << " ns, p99 "
+        << logger_metrics.latency.percentile(0.99) << " ns, p999 "
+        << logger_metrics.latency.percentile(0.999) << " ns\n";
+
+    if (report.queue_depth_samples > 0)
+    {
+        out << "Queue depth: max " << report.max_queue_depth << ", mean "
+            << report.mean_queue_depth << " (" << report.queue_depth_samples << " samples)\n";
+    }
+
+    out << "Schedule lag: max " << report.max_lag_ms << " ms\n";
+
+    for (const auto& appender: logger.get_appenders())
+    {
+        LogMetricsSnapshot metrics = appender->get_metrics().snapshot();
+        quint64 dropped = metrics.records_filtered;
+
+        if (auto socket_appender = appender.dynamicCast<LocalSocketAppender>())
+        {
+            dropped += socket_appender->get_dropped_count();
+        }
+
+        out << "Appender " << appender->get_name() << ": " << metrics.total_records()
+            << " accepted, " << dropped << " dropped, " << metrics.bytes_emitted
+            << " bytes, append latency p99 " << metrics.latency.percentile(0.99) << " ns\n";
+    }
+}
+}  // namespace
+
+/**
+ * @brief Parses log files and replays them through the logger with the configured appenders.
+ *
+ * @param argc The number of command line arguments.
+ * @param argv The command line arguments.
+ * @return 0 on success, 1 if the arguments are invalid or a file cannot be read.
+ */
+auto main(int argc, char* argv[]) -> int
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName(QStringLiteral("QmlAppLogReplay"));
+    app.setOrganizationName(QStringLiteral("QmlDesktopAppTemplate_LogReplay"));
+    app.setOrganizationDomain(QStringLiteral("AdrianHelbig.de"));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral(
+        "Replays log files written by the SimpleFormatter or the JsonFormatter through the "
+        "logger and reports throughput, queue depths and drops."));
+    parser.addHelpOption();
+    parser.addPositionalArgument(QStringLiteral("files"), QStringLiteral("The log files."),
+                                 QStringLiteral("files..."));
+    parser.addOptions({
+        {QStringLiteral("original-timing"),
+         QStringLiteral("Keep the original inter-arrival times instead of replaying as fast as "
+                        "possible.")},
+        {QStringLiteral("speed"), QStringLiteral("Speed factor for the original timing."),
+         QStringLiteral("factor"), QStringLiteral("1")},
+        {QStringLiteral("repeat"), QStringLiteral("Number of times the trace is replayed."),
+         QStringLiteral("count"), QStringLiteral("1")},
+        {QStringLiteral("appender"),
+         QStringLiteral("Appender to replay into: null, console, file:<path>, json:<path> or "
+                        "socket:<server name>. May be repeated; the default is null."),
+         QStringLiteral("spec")},
+        {QStringLiteral("buffer-size"),
+         QStringLiteral("Write buffer size of file appenders in bytes, 0 writes through."),
+         QStringLiteral("bytes"), QStringLiteral("0")},
+        {QStringLiteral("level"), QStringLiteral("Log level of the logger."),
+         QStringLiteral("level"), QStringLiteral("debug")},
+        {QStringLiteral("batching"), QStringLiteral("Stage records per thread and dispatch them "
+                                                    "in batches.")},
+        {QStringLiteral("batch-size"), QStringLiteral("Maximum batch size."),
+         QStringLiteral("records"), QStringLiteral("64")},
+        {QStringLiteral("batch-delay"), QStringLiteral("Maximum batch delay in milliseconds."),
+         QStringLiteral("ms"), QStringLiteral("2")},
+    });
+    parser.process(app);
+
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+    int exit_code = 0;
+    QList<LogRecord> records;
+    QtMsgType level = QtDebugMsg;
+
+    if (parser.positionalArguments().isEmpty() ||
+        !LogLineParser::parse_level(parser.value(QStringLiteral("level")), level))
+    {
+        parser.showHelp(1);
+    }
+
+    for (const QString& file_path: parser.positionalArguments())
+    {
+        if (!LogLineParser::parse_file(file_path, records))
+        {
+            err << "Cannot read " << file_path << "\n";
+            exit_code = 1;
+        }
+    }
+
+    if (parser.isSet(QStringLiteral("original-timing")) && parser.positionalArguments().size() > 1)
+    {
+        std::stable_sort(records.begin(), records.end(),
+                         [](const LogRecord& left, const LogRecord& right) {
+                             return left.msecs_since_epoch() < right.msecs_since_epoch();
+                         });
+    }
+
+    Logger& logger = Logger::get_instance();
+    logger.set_log_level(level);
+    QStringList appender_specs = parser.values(QStringLiteral("appender"));
+
+    if (appender_specs.isEmpty())
+    {
+        appender_specs.append(QStringLiteral("null"));
+    }
+
+    for (const QString& spec: appender_specs)
+    {
+        QSharedPointer<LogAppender> appender =
+            create_appender(spec, parser.value(QStringLiteral("buffer-size")).toLongLong());
+
+        if (appender != nullptr)
+        {
+            logger.add_appender(appender);
+        }
+        else
+        {
+            err << "Unknown appender " << spec << "\n";
+            exit_code = 1;
+        }
+    }
+
+    if (exit_code == 0)
+    {
+        if (parser.isSet(QStringLiteral("batching")))
+        {
+            logger.enable_batching(parser.value(QStringLiteral("batch-size")).toLongLong(),
+                                   parser.value(QStringLiteral("batch-delay")).toInt());
+        }
+
+        LogReplayOptions options;
+        options.original_timing = parser.isSet(QStringLiteral("original-timing"));
+        options.speed = parser.value(QStringLiteral("speed")).toDouble();
+        options.repeat = std::max(parser.value(QStringLiteral("repeat")).toInt(), 1);
+
+        err << "Replaying " << records.size() << " records\n";
+        err.flush();
+        LogReplayReport report = LogReplayer(options).replay(records);
+        print_report(report, out);
+
+        logger.disable_batching();
+    }
+
+    logger.clear_appenders();
+
+    return exit_code;
+}
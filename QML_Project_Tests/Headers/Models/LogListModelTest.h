@@ -0,0 +1,41 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QList>
+#include <QString>
+
+#include "Models/LogListModel.h"
+
+using namespace QmlApp;
+
+class LogListModelTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Creates a record with the given level, category and message.
+         *
+         * @param type The log level.
+         * @param category The logging category.
+         * @param message The log message.
+         * @return The record.
+         */
+        static auto make_record(QtMsgType type, const QByteArray& category,
+                                const QString& message) -> LogRecord;
+
+        /**
+         * @brief Creates a batch of debug records with the messages "<prefix>0", "<prefix>1", ...
+         *
+         * @param count The number of records.
+         * @param prefix The message prefix.
+         * @return The records.
+         */
+        static auto make_batch(int count, const QString& prefix = QStringLiteral("message "))
+            -> QList<LogRecord>;
+
+    public:
+        LogListModel* m_model = nullptr;
+};
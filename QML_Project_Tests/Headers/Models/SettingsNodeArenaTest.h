@@ -0,0 +1,24 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Models/SettingsNodeArena.h"
+
+using namespace QmlApp;
+
+class SettingsNodeArenaTest: public ::testing::Test
+{
+    public:
+        SettingsNodeArena* m_arena = nullptr;
+
+    protected:
+        void SetUp() override
+        {
+            m_arena = new SettingsNodeArena();
+        }
+
+        void TearDown() override
+        {
+            delete m_arena;
+        }
+};
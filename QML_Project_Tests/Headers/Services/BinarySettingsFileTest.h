@@ -0,0 +1,32 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QSettings>
+
+#include "Services/BinarySettingsFile.h"
+
+using namespace QmlApp;
+
+class BinarySettingsFileTest: public ::testing::Test
+{
+    public:
+        QString m_binary_file_path;
+        QString m_ini_file_path;
+
+    protected:
+        void SetUp() override
+        {
+            QString exe_path = QCoreApplication::applicationDirPath();
+            m_binary_file_path = exe_path + "/binarysettingsfiletest.bin";
+            m_ini_file_path = exe_path + "/binarysettingsfiletest.ini";
+        }
+
+        void TearDown() override
+        {
+            QFile::remove(m_binary_file_path);
+            QFile::remove(m_ini_file_path);
+        }
+};
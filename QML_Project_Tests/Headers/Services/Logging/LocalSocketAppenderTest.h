@@ -0,0 +1,53 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QByteArray>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QStringList>
+#include <functional>
+
+#include "Services/Logging/LocalSocketAppender.h"
+#include "Services/Logging/LogMessage.h"
+
+using namespace QmlApp;
+
+/**
+ * @class TestLogCollector
+ * @brief A minimal local collector that decodes length-prefixed log frames.
+ */
+class TestLogCollector
+{
+    public:
+        explicit TestLogCollector(QString server_name);
+        ~TestLogCollector();
+
+        auto listen() -> bool;
+        auto close() -> void;
+
+        [[nodiscard]] auto get_messages() const -> const QStringList&;
+
+    private:
+        auto read_frames(QLocalSocket* socket) -> void;
+
+    private:
+        QString m_server_name;
+        QLocalServer m_server;
+        QByteArray m_buffer;
+        QStringList m_messages;
+};
+
+class LocalSocketAppenderTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+    public:
+        static auto wait_until(const std::function<bool()>& condition, int timeout_ms = 5000)
+            -> bool;
+
+    public:
+        QString m_server_name;
+};
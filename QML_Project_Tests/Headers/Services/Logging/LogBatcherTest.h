@@ -0,0 +1,26 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QList>
+#include <QMutex>
+
+#include "Services/Logging/LogBatcher.h"
+
+using namespace QmlApp;
+
+class LogBatcherTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        [[nodiscard]] auto make_batcher(qsizetype max_batch_size, int max_batch_delay_ms)
+            -> std::unique_ptr<LogBatcher>;
+        [[nodiscard]] auto wait_for_consumed(qsizetype count, int timeout_ms = 5000) -> bool;
+        [[nodiscard]] auto consumed() -> QList<LogRecord>;
+
+    public:
+        QMutex m_mutex;
+        QList<LogRecord> m_consumed;
+};
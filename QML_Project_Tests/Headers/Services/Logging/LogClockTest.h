@@ -0,0 +1,14 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Services/Logging/LogClock.h"
+
+using namespace QmlApp;
+
+class LogClockTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+};
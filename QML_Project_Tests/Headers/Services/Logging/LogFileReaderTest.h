@@ -0,0 +1,30 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QByteArray>
+#include <QString>
+#include <QTemporaryDir>
+
+#include "Services/Logging/LogFileReader.h"
+
+using namespace QmlApp;
+
+class LogFileReaderTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Appends the given bytes to the test log file.
+         *
+         * @param data The bytes to append.
+         */
+        auto append_to_file(const QByteArray& data) -> void;
+
+    public:
+        QTemporaryDir m_temp_dir;
+        QString m_file_path;
+        LogFileReader* m_reader = nullptr;
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QString>
+
+#include "Services/Logging/LogLineParser.h"
+
+using namespace QmlApp;
+
+class LogLineParserTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Writes the given lines to the test file.
+         *
+         * @param lines The lines, each terminated with a newline.
+         */
+        void write_test_file(const QList<QByteArray>& lines) const;
+
+        QString m_test_file_path;
+};
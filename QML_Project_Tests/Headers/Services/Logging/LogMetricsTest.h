@@ -0,0 +1,18 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Services/Logging/LatencyHistogram.h"
+#include "Services/Logging/LogMetrics.h"
+
+using namespace QmlApp;
+
+class LogMetricsTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+    public:
+        LogMetrics m_metrics;
+};
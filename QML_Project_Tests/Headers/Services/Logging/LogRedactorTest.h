@@ -0,0 +1,17 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Services/Logging/LogRedactor.h"
+
+using namespace QmlApp;
+
+class LogRedactorTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+    public:
+        LogRedactor m_redactor;
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QList>
+#include <QSharedPointer>
+
+#include "Services/Logging/LogAppender.h"
+#include "Services/Logging/LogRoutingTable.h"
+
+using namespace QmlApp;
+
+class CountingLogAppender: public LogAppender
+{
+    protected:
+        auto internal_append(const LogMessage& /*message*/,
+                             const QMessageLogContext& /*context*/) -> void override
+        {}
+};
+
+class LogRoutingTableTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        [[nodiscard]] auto received(qsizetype index) const -> quint64;
+
+    public:
+        QList<QSharedPointer<LogAppender>> m_appenders;
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QByteArray>
+#include <QString>
+#include <QTemporaryDir>
+#include <QVariantList>
+
+#include "Services/Logging/LogSearchEngine.h"
+
+using namespace QmlApp;
+
+class LogSearchEngineTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Writes a log file with the given number of numbered lines.
+         *
+         * @param file_name The name of the file in the temporary directory.
+         * @param line_count The number of lines.
+         * @return The path of the file.
+         */
+        auto write_log(const QString& file_name, int line_count) -> QString;
+
+        /**
+         * @brief Runs a search to completion and collects all reported matches.
+         *
+         * @param file_paths The files to search.
+         * @param pattern The pattern to search for.
+         * @param case_sensitive Whether the pattern is matched case-sensitively.
+         * @return The matches in the order they were reported.
+         */
+        auto run_search(const QStringList& file_paths, const QString& pattern,
+                        bool case_sensitive = true) -> QVariantList;
+
+    public:
+        QTemporaryDir m_temp_dir;
+        LogSearchEngine* m_engine = nullptr;
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Services/Logging/PrometheusMetricsWriter.h"
+
+using namespace QmlApp;
+
+class PrometheusMetricsWriterTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+    public:
+        QString m_test_file_path;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QList>
+
+#include "Services/Logging/LogAppender.h"
+#include "Services/Logging/StackTrace.h"
+
+using namespace QmlApp;
+
+class StackFrameRecordingAppender: public LogAppender
+{
+    public:
+        QList<qsizetype> m_frame_counts;
+
+    protected:
+        auto internal_append(const LogMessage& message, const QMessageLogContext& /*context*/)
+            -> void override
+        {
+            m_frame_counts.append(message.get_stack_frames().size());
+        }
+};
+
+class StackTraceTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QStringList>
+
+#include "Services/Logging/StaticAppender.h"
+
+using namespace QmlApp;
+
+class RecordingSink
+{
+    public:
+        static constexpr const char* kName = "recording";
+
+        auto write(const QString& line, QtMsgType /*type*/) -> qsizetype
+        {
+            m_lines.append(line);
+            return line.size();
+        }
+
+        auto flush() -> void
+        {
+            m_flush_count++;
+        }
+
+        auto emergency_flush() -> void
+        {
+            m_emergency_flush_count++;
+        }
+
+        QStringList m_lines;
+        int m_flush_count = 0;
+        int m_emergency_flush_count = 0;
+};
+
+class MessageOnlyFormatter
+{
+    public:
+        auto format(const LogMessage& log_message, const QMessageLogContext& /*context*/) const
+            -> QString
+        {
+            return log_message.get_message();
+        }
+};
+
+class StaticAppenderTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+    public:
+        QString m_test_file_path;
+};
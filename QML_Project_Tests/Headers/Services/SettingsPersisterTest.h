@@ -0,0 +1,55 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <functional>
+
+#include "Services/BinarySettingsFile.h"
+#include "Services/Settings.h"
+#include "Services/SettingsPersister.h"
+
+using namespace QmlApp;
+
+class SettingsPersisterTest: public ::testing::Test
+{
+    public:
+        Settings* m_settings = nullptr;
+        SettingsPersister* m_settings_persister = nullptr;
+        QString m_file_path;
+
+    protected:
+        void SetUp() override
+        {
+            m_file_path = QCoreApplication::applicationDirPath() + "/settingspersistertest.bin";
+            m_settings = new Settings();
+            m_settings_persister = new SettingsPersister(m_settings, m_file_path);
+        }
+
+        void TearDown() override
+        {
+            delete m_settings_persister;
+            m_settings->clear();
+            delete m_settings;
+            QFile::remove(m_file_path);
+        }
+
+        // Processes events for the given time, or until the condition holds
+        static auto process_events_for(int timeout_ms,
+                                       const std::function<bool()>& condition = nullptr) -> bool
+        {
+            QElapsedTimer timer;
+            timer.start();
+            bool result = false;
+
+            while (!result && timer.elapsed() < timeout_ms)
+            {
+                QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+                result = condition != nullptr && condition();
+            }
+
+            return result;
+        }
+};
@@ -6,6 +6,7 @@
 #include <QFile>
 #include <QTextStream>
 
+#include "Services/BinarySettingsFile.h"
 #include "Services/Settings.h"
 
 using namespace QmlApp;
@@ -0,0 +1,147 @@
+#include "Models/LogListModelTest.h"
+
+void LogListModelTest::SetUp()
+{
+    m_model = new LogListModel(nullptr, 100);
+}
+
+void LogListModelTest::TearDown()
+{
+    delete m_model;
+    m_model = nullptr;
+}
+
+auto LogListModelTest::make_record(QtMsgType type, const QByteArray& category,
+                                   const QString& message) -> LogRecord
+{
+    LogRecord record;
+    record.sequence = LogRecord::next_sequence();
+    record.type = type;
+    record.category = category;
+    record.message = message;
+    return record;
+}
+
+auto LogListModelTest::make_batch(int count, const QString& prefix) -> QList<LogRecord>
+{
+    QList<LogRecord> records;
+
+    for (int i = 0; i < count; i++)
+    {
+        records.append(make_record(QtDebugMsg, "default", prefix + QString::number(i)));
+    }
+
+    return records;
+}
+
+/**
+ * @brief Tests that appended records become rows in logging order.
+ */
+TEST_F(LogListModelTest, AppendRecordsAddsRows)
+{
+    m_model->append_records(make_batch(3));
+
+    ASSERT_EQ(m_model->rowCount(), 3);
+    EXPECT_EQ(m_model->getRetainedCount(), 3);
+    EXPECT_EQ(m_model->data(m_model->index(0), MessageRole).toString(), "message 0");
+    EXPECT_EQ(m_model->data(m_model->index(2), MessageRole).toString(), "message 2");
+    EXPECT_EQ(m_model->data(m_model->index(2), LevelNameRole).toString(), "debug");
+    EXPECT_EQ(m_model->data(m_model->index(2), CategoryRole).toString(), "default");
+    EXPECT_FALSE(m_model->data(m_model->index(3), MessageRole).isValid());
+}
+
+/**
+ * @brief Tests that the oldest records are evicted once the capacity is reached.
+ */
+TEST_F(LogListModelTest, EvictsOldestRecordsAtCapacity)
+{
+    m_model->append_records(make_batch(80));
+    m_model->append_records(make_batch(50, QStringLiteral("second ")));
+
+    ASSERT_EQ(m_model->rowCount(), 100);
+    EXPECT_EQ(m_model->getRetainedCount(), 100);
+    EXPECT_EQ(m_model->data(m_model->index(0), MessageRole).toString(), "message 30");
+    EXPECT_EQ(m_model->data(m_model->index(99), MessageRole).toString(), "second 49");
+
+    // A batch larger than the capacity keeps only its newest records
+    m_model->append_records(make_batch(250, QStringLiteral("third ")));
+
+    ASSERT_EQ(m_model->rowCount(), 100);
+    EXPECT_EQ(m_model->data(m_model->index(0), MessageRole).toString(), "third 150");
+    EXPECT_EQ(m_model->data(m_model->index(99), MessageRole).toString(), "third 249");
+}
+
+/**
+ * @brief Tests that a batch is announced with one row removal and one row insertion.
+ */
+TEST_F(LogListModelTest, BatchEmitsSingleRowSignals)
+{
+    int inserted_signals = 0;
+    int removed_signals = 0;
+    QObject::connect(m_model, &QAbstractItemModel::rowsInserted,
+                     [&inserted_signals]() { inserted_signals++; });
+    QObject::connect(m_model, &QAbstractItemModel::rowsRemoved,
+                     [&removed_signals]() { removed_signals++; });
+
+    m_model->append_records(make_batch(90));
+    m_model->append_records(make_batch(40));
+
+    EXPECT_EQ(inserted_signals, 2);
+    EXPECT_EQ(removed_signals, 1);
+    EXPECT_EQ(m_model->rowCount(), 100);
+}
+
+/**
+ * @brief Tests the level, category and text filters, including narrowing and widening them.
+ */
+TEST_F(LogListModelTest, FiltersRecords)
+{
+    m_model->append_records({make_record(QtDebugMsg, "app.network", "Connecting to server"),
+                             make_record(QtInfoMsg, "app.network", "Connected"),
+                             make_record(QtWarningMsg, "app.ui", "Slow frame"),
+                             make_record(QtCriticalMsg, "app.network", "Connection lost")});
+
+    m_model->setMinimumLevel(LogListModel::severity(QtInfoMsg));
+    EXPECT_EQ(m_model->rowCount(), 3);
+
+    m_model->setCategoryFilter(QStringLiteral("app.net"));
+    EXPECT_EQ(m_model->rowCount(), 2);
+
+    m_model->setTextFilter(QStringLiteral("CONNECT"));
+    EXPECT_EQ(m_model->rowCount(), 2);
+
+    m_model->setTextFilter(QStringLiteral("connection"));
+    ASSERT_EQ(m_model->rowCount(), 1);
+    EXPECT_EQ(m_model->data(m_model->index(0), MessageRole).toString(), "Connection lost");
+
+    // Widening the filters brings hidden records back
+    m_model->setTextFilter(QString());
+    m_model->setCategoryFilter(QString());
+    m_model->setMinimumLevel(LogListModel::severity(QtDebugMsg));
+    EXPECT_EQ(m_model->rowCount(), 4);
+
+    // New records are filtered as they arrive
+    m_model->setMinimumLevel(LogListModel::severity(QtWarningMsg));
+    m_model->append_records({make_record(QtDebugMsg, "app.ui", "Hidden"),
+                             make_record(QtCriticalMsg, "app.ui", "Visible")});
+    ASSERT_EQ(m_model->rowCount(), 3);
+    EXPECT_EQ(m_model->data(m_model->index(2), MessageRole).toString(), "Visible");
+    EXPECT_EQ(m_model->getRetainedCount(), 6);
+}
+
+/**
+ * @brief Tests that records logged through the appender show up after the pending records are
+ * flushed.
+ */
+TEST_F(LogListModelTest, FlushPendingTakesRecordsFromAppender)
+{
+    QMessageLogContext context("file.cpp", 7, "function", "app.test");
+    m_model->get_appender()->append(LogMessage(QtWarningMsg, "From appender"), context);
+
+    EXPECT_EQ(m_model->rowCount(), 0);
+    m_model->flushPending();
+
+    ASSERT_EQ(m_model->rowCount(), 1);
+    EXPECT_EQ(m_model->data(m_model->index(0), MessageRole).toString(), "From appender");
+    EXPECT_EQ(m_model->data(m_model->index(0), CategoryRole).toString(), "app.test");
+}
@@ -320,3 +320,263 @@ TEST_F(SettingsModelTest, SaveToFileTest)
 
     QFile::remove(file_path);
 }
+
+// Test case for path-scoped lookups in setValue()
+TEST_F(SettingsModelTest, SetValueScopesLookupsToPathTest)
+{
+    // A nested group with the same name as a top-level group must not be matched
+    m_settings_model->setValue("Audio/volume", 10, "Player");
+    m_settings_model->setValue("volume", 20, "Audio");
+
+    int audio_groups = 0;
+
+    for (int row = 0; row < m_settings_model->rowCount(); row++)
+    {
+        if (m_settings_model->data(m_settings_model->index(row, 0)) == "Audio")
+        {
+            audio_groups++;
+        }
+    }
+
+    EXPECT_EQ(audio_groups, 1);
+    EXPECT_EQ(m_settings_model->getValue("Audio/volume", "Player"), QVariant(10));
+    EXPECT_EQ(m_settings_model->getValue("volume", "Audio"), QVariant(20));
+
+    // Updating an existing key changes the value of its node instead of adding a node
+    m_settings_model->setValue("volume", 30, "Audio");
+
+    for (int row = 0; row < m_settings_model->rowCount(); row++)
+    {
+        QModelIndex group_index = m_settings_model->index(row, 0);
+
+        if (m_settings_model->data(group_index) == "Audio")
+        {
+            ASSERT_EQ(m_settings_model->rowCount(group_index), 1);
+            QModelIndex value_index = m_settings_model->index(0, 2, group_index);
+            EXPECT_EQ(m_settings_model->data(value_index), QVariant(30));
+        }
+    }
+}
+
+// Test case for loading a file with a single model reset
+TEST_F(SettingsModelTest, LoadFromFileResetsModelOnceTest)
+{
+    QString exe_path = QCoreApplication::applicationDirPath();
+    QString file_path = exe_path + "/settingsmodeltest_bulk_load_settings.ini";
+    QFile file(file_path);
+
+    if (file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        QTextStream stream(&file);
+        stream << "[%General]\n";
+        stream << "key1=value1\n";
+        stream << "[TestGroup]\n";
+        stream << "key2=value2\n";
+        stream << "group2/key3=value3\n";
+        file.close();
+    }
+
+    int resets = 0;
+    int inserts = 0;
+    int changes = 0;
+    QObject::connect(m_settings_model, &QAbstractItemModel::modelReset, [&resets]() { resets++; });
+    QObject::connect(m_settings_model, &QAbstractItemModel::rowsInserted,
+                     [&inserts]() { inserts++; });
+    QObject::connect(m_settings_model, &QAbstractItemModel::dataChanged,
+                     [&changes]() { changes++; });
+
+    m_settings_model->loadFromFile(file_path);
+
+    EXPECT_EQ(resets, 1);
+    EXPECT_EQ(inserts, 0);
+    EXPECT_EQ(changes, 0);
+
+    // "[%General]" is a group named "General", not the section of the keys without a group
+    ASSERT_EQ(m_settings_model->rowCount(), 2);
+    int test_group_row = (m_settings_model->data(m_settings_model->index(0, 0)) == "General") ? 1
+                                                                                             : 0;
+    QModelIndex test_group_index = m_settings_model->index(test_group_row, 0);
+    EXPECT_EQ(m_settings_model->data(test_group_index), QVariant("TestGroup"));
+    m_settings_model->fetchMore(test_group_index);
+    EXPECT_EQ(m_settings_model->rowCount(test_group_index), 2);
+    EXPECT_EQ(m_settings_model->getValue("group2/key3", "TestGroup"), QVariant("value3"));
+
+    QFile::remove(file_path);
+}
+
+// Test case for keeping the keys of a plain [General] section apart from a "General" group
+TEST_F(SettingsModelTest, KeysWithoutGroupStayAtTopLevelTest)
+{
+    QString exe_path = QCoreApplication::applicationDirPath();
+    QString file_path = exe_path + "/settingsmodeltest_top_level_keys.ini";
+    QFile file(file_path);
+
+    if (file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        QTextStream stream(&file);
+        stream << "[General]\n";
+        stream << "key1=top\n";
+        stream << "[%General]\n";
+        stream << "key1=grouped\n";
+        file.close();
+    }
+
+    m_settings_model->loadFromFile(file_path);
+
+    // The group "General" and the key without a group are separate rows
+    ASSERT_EQ(m_settings_model->rowCount(), 2);
+    int key_row = (m_settings_model->data(m_settings_model->index(0, 0)) == "General") ? 1 : 0;
+    QModelIndex group_index = m_settings_model->index(1 - key_row, 0);
+    QModelIndex value_index = m_settings_model->index(key_row, 2);
+    EXPECT_EQ(m_settings_model->data(m_settings_model->index(key_row, 1)), QVariant("key1"));
+    EXPECT_EQ(m_settings_model->data(value_index), QVariant("top"));
+    m_settings_model->fetchMore(group_index);
+    ASSERT_EQ(m_settings_model->rowCount(group_index), 1);
+    EXPECT_EQ(m_settings_model->data(m_settings_model->index(0, 2, group_index)),
+              QVariant("grouped"));
+
+    // Editing the key without a group writes it back without a group
+    EXPECT_TRUE(m_settings_model->setData(value_index, "edited", Qt::EditRole));
+    EXPECT_EQ(m_settings_model->getValue("key1", ""), QVariant("edited"));
+    EXPECT_EQ(m_settings_model->getValue("key1", "General"), QVariant("grouped"));
+    EXPECT_EQ(m_settings->allKeys().size(), 2);
+
+    QFile::remove(file_path);
+}
+
+// Test case for writing a nested key changed with setData() to its full path
+TEST_F(SettingsModelTest, SetDataWritesNestedKeyTest)
+{
+    m_settings_model->setValue("Sub/Deep/key", 1, "Group");
+
+    QModelIndex index;
+
+    for (int row = 0; row < m_settings_model->rowCount(); row++)
+    {
+        if (m_settings_model->data(m_settings_model->index(row, 0)) == "Group")
+        {
+            index = m_settings_model->index(row, 0);
+        }
+    }
+
+    ASSERT_TRUE(index.isValid());
+    index = m_settings_model->index(0, 0, index);  // Sub
+    index = m_settings_model->index(0, 0, index);  // Deep
+    index = m_settings_model->index(0, 2, index);  // key
+    ASSERT_EQ(m_settings_model->data(index), QVariant(1));
+
+    EXPECT_TRUE(m_settings_model->setData(index, 5, Qt::EditRole));
+    EXPECT_EQ(m_settings_model->getValue("Sub/Deep/key", "Group"), QVariant(5));
+}
+
+// Test case for populating groups only when they are expanded
+TEST_F(SettingsModelTest, FetchMorePopulatesGroupsLazilyTest)
+{
+    m_settings->setValue("Audio", "volume", 10);
+    m_settings->setValue("Audio", "Effects/reverb", true);
+    SettingsModel settings_model(m_settings);
+
+    ASSERT_EQ(settings_model.rowCount(), 1);
+    QModelIndex audio_index = settings_model.index(0, 0);
+    EXPECT_EQ(settings_model.data(audio_index), QVariant("Audio"));
+    EXPECT_EQ(settings_model.rowCount(audio_index), 0);
+    EXPECT_TRUE(settings_model.hasChildren(audio_index));
+    EXPECT_TRUE(settings_model.canFetchMore(audio_index));
+
+    // Values of groups that were not expanded yet can still be read and written
+    settings_model.setValue("Effects/reverb", false, "Audio");
+    EXPECT_EQ(settings_model.getValue("Effects/reverb", "Audio"), QVariant(false));
+    EXPECT_EQ(settings_model.rowCount(audio_index), 0);
+
+    // Expanding a group creates one level only
+    settings_model.fetchMore(audio_index);
+    EXPECT_FALSE(settings_model.canFetchMore(audio_index));
+    ASSERT_EQ(settings_model.rowCount(audio_index), 2);
+    QModelIndex effects_index = settings_model.index(0, 0, audio_index);
+    EXPECT_EQ(settings_model.data(effects_index), QVariant("Effects"));
+    EXPECT_TRUE(settings_model.canFetchMore(effects_index));
+    EXPECT_EQ(settings_model.data(settings_model.index(1, 2, audio_index)), QVariant(10));
+
+    settings_model.fetchMore(effects_index);
+    ASSERT_EQ(settings_model.rowCount(effects_index), 1);
+    EXPECT_EQ(settings_model.data(settings_model.index(0, 1, effects_index)), QVariant("reverb"));
+    EXPECT_EQ(settings_model.data(settings_model.index(0, 2, effects_index)).toBool(), false);
+    EXPECT_FALSE(settings_model.hasChildren(settings_model.index(0, 0, effects_index)));
+}
+
+// Test case for keeping the nodes of the model in its arena
+TEST_F(SettingsModelTest, NodesAreCreatedInArenaTest)
+{
+    m_settings->setValue("Audio", "volume", 10);
+    m_settings->setValue("Audio", "balance", 0);
+    m_settings->setValue("Audio", "muted", false);
+    SettingsModel settings_model(m_settings);
+
+    QModelIndex audio_index = settings_model.index(0, 0);
+    settings_model.fetchMore(audio_index);
+    ASSERT_EQ(settings_model.rowCount(audio_index), 3);
+
+    // The children of a group are created together, so they lie next to each other
+    auto first = static_cast<SettingsNode*>(settings_model.index(0, 0, audio_index)
+                                                .internalPointer());
+
+    for (int row = 0; row < 3; row++)
+    {
+        auto node = static_cast<SettingsNode*>(settings_model.index(row, 0, audio_index)
+                                                   .internalPointer());
+        EXPECT_TRUE(node->is_in_arena());
+        EXPECT_EQ(node, first + row);
+    }
+
+    // Indexes stay valid while nodes are added elsewhere in the tree
+    QPersistentModelIndex volume_index = settings_model.index(0, 2, audio_index);
+    QVariant volume = settings_model.data(volume_index);
+
+    for (int i = 0; i < 2 * SettingsNodeArena::kNodesPerChunk; i++)
+    {
+        settings_model.setValue(QString("key%1").arg(i), i, "Video");
+    }
+
+    EXPECT_EQ(settings_model.data(volume_index), volume);
+}
+
+// Test case for saving only the changed keys of a large model to the same file again
+TEST_F(SettingsModelTest, SaveToFileWritesOnlyChangedKeysTest)
+{
+    QString file_path = QCoreApplication::applicationDirPath() + "/settingsmodeltest_changes.ini";
+    QFile::remove(file_path);
+
+    for (int group = 0; group < 50; group++)
+    {
+        for (int key = 0; key < 1000; key++)
+        {
+            m_settings->setValue(QString("Group%1").arg(group), QString("key%1").arg(key), key);
+        }
+    }
+
+    // A new file gets all keys
+    m_settings_model->saveToFile(file_path);
+    EXPECT_EQ(m_settings->get_last_save_key_count(), 50000);
+
+    // Once the model matches the file, only the changed keys are written
+    m_settings_model->loadFromFile(file_path);
+    EXPECT_EQ(m_settings->get_unsaved_key_count(), 0);
+    m_settings_model->setValue("key7", -1, "Group3");
+    m_settings_model->setValue("key8", -2, "Group48");
+    EXPECT_EQ(m_settings->get_unsaved_key_count(), 2);
+
+    m_settings_model->saveToFile(file_path);
+    EXPECT_EQ(m_settings->get_last_save_key_count(), 2);
+    EXPECT_EQ(m_settings->get_unsaved_key_count(), 0);
+
+    m_settings_model->saveToFile(file_path);
+    EXPECT_EQ(m_settings->get_last_save_key_count(), 0);
+
+    QSettings file_settings(file_path, QSettings::IniFormat);
+    EXPECT_EQ(file_settings.allKeys().size(), 50000);
+    EXPECT_EQ(file_settings.value("Group3/key7").toInt(), -1);
+    EXPECT_EQ(file_settings.value("Group48/key8").toInt(), -2);
+    EXPECT_EQ(file_settings.value("Group48/key9").toInt(), 9);
+
+    QFile::remove(file_path);
+}
@@ -0,0 +1,76 @@
+#include "Models/SettingsNodeArenaTest.h"
+
+// Test case for create() method
+TEST_F(SettingsNodeArenaTest, CreateTest)
+{
+    SettingsNode* parent = m_arena->create("Group", "");
+    SettingsNode* child = m_arena->create("", "key", 42, parent);
+    parent->append_child(child);
+
+    EXPECT_TRUE(parent->is_in_arena());
+    EXPECT_TRUE(child->is_in_arena());
+    EXPECT_EQ(child->get_parent_item(), parent);
+    EXPECT_EQ(child->get_key(), QString("key"));
+    EXPECT_EQ(child->get_value(), QVariant(42));
+    EXPECT_EQ(m_arena->node_count(), 2);
+    EXPECT_EQ(m_arena->chunk_count(), 1);
+
+    // Nodes created in a row lie next to each other
+    EXPECT_EQ(child, parent + 1);
+}
+
+// Test case for allocating further chunks without moving existing nodes
+TEST_F(SettingsNodeArenaTest, GrowsInChunksTest)
+{
+    SettingsNode* root = m_arena->create("Root", "");
+    QList<SettingsNode*> children;
+
+    for (int i = 0; i < 2 * SettingsNodeArena::kNodesPerChunk; i++)
+    {
+        children.append(m_arena->create("", QString("key%1").arg(i), i, root));
+        root->append_child(children.last());
+    }
+
+    EXPECT_EQ(m_arena->node_count(), 2 * SettingsNodeArena::kNodesPerChunk + 1);
+    EXPECT_EQ(m_arena->chunk_count(), 3);
+    EXPECT_EQ(root->child_count(), children.size());
+
+    for (int i = 0; i < children.size(); i++)
+    {
+        EXPECT_EQ(root->get_child(i), children[i]);
+        EXPECT_EQ(children[i]->get_value(), QVariant(i));
+    }
+}
+
+// Test case for release() method
+TEST_F(SettingsNodeArenaTest, ReleaseTest)
+{
+    SettingsNode* root = m_arena->create("Root", "");
+
+    for (int i = 0; i < 10; i++)
+    {
+        root->append_child(m_arena->create("", QString("key%1").arg(i), QString(100, 'x'), root));
+    }
+
+    m_arena->release();
+
+    EXPECT_EQ(m_arena->node_count(), 0);
+    EXPECT_EQ(m_arena->chunk_count(), 0);
+
+    // The arena can be used again after it was released
+    root = m_arena->create("Root", "");
+    EXPECT_EQ(root->get_group(), QString("Root"));
+    EXPECT_EQ(m_arena->node_count(), 1);
+}
+
+// Test case for clearing a node created by an arena
+TEST_F(SettingsNodeArenaTest, ClearDetachesChildrenTest)
+{
+    SettingsNode* root = m_arena->create("Root", "");
+    root->append_child(m_arena->create("Group", "", QVariant(), root));
+
+    root->clear();
+
+    EXPECT_FALSE(root->has_children());
+    EXPECT_EQ(m_arena->node_count(), 2);
+}
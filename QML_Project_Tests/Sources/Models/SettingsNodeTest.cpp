@@ -276,3 +276,104 @@ TEST_F(SettingsNodeTest, DestructorTest)
     settings_node->append_child(new SettingsNode("ChildGroup", "ChildKey", "ChildValue"));
     delete settings_node;
 }
+
+// Test case for find_child_by_group() method
+TEST_F(SettingsNodeTest, FindChildByGroupTest)
+{
+    // Test finding a direct child by group
+    auto child_node = new SettingsNode("ChildGroup", "");
+    m_settings_node->append_child(child_node);
+    EXPECT_EQ(m_settings_node->find_child_by_group("ChildGroup"), child_node);
+
+    // Test that grandchildren are not matched
+    auto grandchild_node = new SettingsNode("GrandchildGroup", "");
+    child_node->append_child(grandchild_node);
+    EXPECT_EQ(m_settings_node->find_child_by_group("GrandchildGroup"), nullptr);
+    EXPECT_EQ(child_node->find_child_by_group("GrandchildGroup"), grandchild_node);
+
+    // Test that the first of several same-named children is returned
+    m_settings_node->append_child(new SettingsNode("ChildGroup", ""));
+    EXPECT_EQ(m_settings_node->find_child_by_group("ChildGroup"), child_node);
+}
+
+// Test case for find_child_by_key() method
+TEST_F(SettingsNodeTest, FindChildByKeyTest)
+{
+    // Test finding a direct child by key
+    auto child_node = new SettingsNode("", "ChildKey", "ChildValue");
+    m_settings_node->append_child(child_node);
+    EXPECT_EQ(m_settings_node->find_child_by_key("ChildKey"), child_node);
+    EXPECT_EQ(m_settings_node->find_child_by_key("MissingKey"), nullptr);
+
+    // Test that the index is emptied by clear()
+    m_settings_node->clear();
+    EXPECT_EQ(m_settings_node->find_child_by_key("ChildKey"), nullptr);
+}
+
+// Test case for keeping the child index in sync with set_data()
+TEST_F(SettingsNodeTest, ChildIndexFollowsRenameTest)
+{
+    auto first_node = new SettingsNode("", "OldKey", "FirstValue");
+    auto second_node = new SettingsNode("", "OldKey", "SecondValue");
+    m_settings_node->append_child(first_node);
+    m_settings_node->append_child(second_node);
+
+    // Test that renaming the indexed child moves its entry and the sibling takes over the old one
+    first_node->set_data(1, "NewKey");
+    EXPECT_EQ(m_settings_node->find_child_by_key("NewKey"), first_node);
+    EXPECT_EQ(m_settings_node->find_child_by_key("OldKey"), second_node);
+}
+
+// Test case for keeping row() up to date on insert, remove and move
+TEST_F(SettingsNodeTest, RowFollowsInsertTakeAndMoveTest)
+{
+    auto first_node = new SettingsNode("", "First");
+    auto second_node = new SettingsNode("", "Second");
+    auto third_node = new SettingsNode("", "Third");
+    m_settings_node->append_child(first_node);
+    m_settings_node->append_child(third_node);
+
+    // Test inserting between two children
+    m_settings_node->insert_child(1, second_node);
+    EXPECT_EQ(first_node->row(), 0);
+    EXPECT_EQ(second_node->row(), 1);
+    EXPECT_EQ(third_node->row(), 2);
+    EXPECT_EQ(second_node->get_parent_item(), m_settings_node);
+
+    // Test moving the last child to the front
+    m_settings_node->move_child(2, 0);
+    EXPECT_EQ(third_node->row(), 0);
+    EXPECT_EQ(first_node->row(), 1);
+    EXPECT_EQ(second_node->row(), 2);
+    EXPECT_EQ(m_settings_node->get_child(0), third_node);
+
+    // Test taking a child out
+    SettingsNode* taken_node = m_settings_node->take_child(1);
+    EXPECT_EQ(taken_node, first_node);
+    EXPECT_EQ(taken_node->get_parent_item(), nullptr);
+    EXPECT_EQ(second_node->row(), 1);
+    EXPECT_EQ(m_settings_node->find_child_by_key("First"), nullptr);
+    EXPECT_EQ(m_settings_node->take_child(5), nullptr);
+    delete taken_node;
+
+    for (int row = 0; row < m_settings_node->child_count(); row++)
+    {
+        EXPECT_EQ(m_settings_node->get_child(row)->row(), row);
+    }
+}
+
+// Test case for sharing group and key names between nodes
+TEST_F(SettingsNodeTest, InternsNamesTest)
+{
+    SettingsNode first_node("Window", QString("width"), 800);
+    SettingsNode second_node("Dialog", QString("wid") + QString("th"), 400);
+
+    EXPECT_EQ(first_node.get_key(), second_node.get_key());
+    EXPECT_EQ(first_node.get_key().constData(), second_node.get_key().constData());
+    EXPECT_NE(first_node.get_group().constData(), second_node.get_group().constData());
+
+    // Renaming a node interns the new name as well
+    second_node.set_data(0, QString("Win") + QString("dow"));
+    EXPECT_EQ(first_node.get_group().constData(), second_node.get_group().constData());
+    EXPECT_TRUE(SettingsNode("", "").get_group().isEmpty());
+}
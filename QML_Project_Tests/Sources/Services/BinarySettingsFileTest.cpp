@@ -0,0 +1,109 @@
+#include "Services/BinarySettingsFileTest.h"
+
+// Test case for writing and opening a binary settings file
+TEST_F(BinarySettingsFileTest, WriteAndOpenTest)
+{
+    SettingsSnapshot snapshot = {{"General/key1", "value1"},
+                                 {"Audio/volume", 42},
+                                 {"Audio/Effects/enabled", true},
+                                 {"Audio/volume", 43}};
+    ASSERT_TRUE(BinarySettingsFile::write(m_binary_file_path, snapshot));
+
+    BinarySettingsFile binary_file;
+    ASSERT_TRUE(binary_file.open(m_binary_file_path));
+    EXPECT_EQ(binary_file.key_count(), 3);
+
+    // The keys are sorted and the last duplicate wins
+    EXPECT_EQ(binary_file.key_at(0), QString("Audio/Effects/enabled"));
+    EXPECT_EQ(binary_file.key_at(1), QString("Audio/volume"));
+    EXPECT_EQ(binary_file.key_at(2), QString("General/key1"));
+    EXPECT_EQ(binary_file.value("Audio/volume"), QVariant(43));
+    EXPECT_EQ(binary_file.value("Audio/Effects/enabled"), QVariant(true));
+    EXPECT_EQ(binary_file.value("General/key1"), QVariant("value1"));
+    EXPECT_FALSE(binary_file.contains("General/missing"));
+    EXPECT_EQ(binary_file.value("General/missing", "default"), QVariant("default"));
+}
+
+// Test case for decoding values on first access only
+TEST_F(BinarySettingsFileTest, DecodesValuesLazilyTest)
+{
+    SettingsSnapshot snapshot;
+
+    for (int key = 0; key < 1000; key++)
+    {
+        snapshot.append(qMakePair(QString("Group/key%1").arg(key), QVariant(key)));
+    }
+
+    ASSERT_TRUE(BinarySettingsFile::write(m_binary_file_path, snapshot));
+
+    BinarySettingsFile binary_file;
+    ASSERT_TRUE(binary_file.open(m_binary_file_path));
+    EXPECT_EQ(binary_file.decoded_count(), 0);
+
+    EXPECT_EQ(binary_file.value("Group/key500"), QVariant(500));
+    EXPECT_EQ(binary_file.value("Group/key500"), QVariant(500));
+    EXPECT_TRUE(binary_file.contains("Group/key999"));
+    EXPECT_EQ(binary_file.decoded_count(), 1);
+}
+
+// Test case for rejecting files that are not binary settings files
+TEST_F(BinarySettingsFileTest, RejectsInvalidFileTest)
+{
+    QFile file(m_binary_file_path);
+
+    if (file.open(QIODevice::WriteOnly))
+    {
+        file.write("[General]\nkey1=value1\n");
+        file.close();
+    }
+
+    BinarySettingsFile binary_file;
+    EXPECT_FALSE(binary_file.open(m_binary_file_path));
+    EXPECT_FALSE(binary_file.is_open());
+    EXPECT_EQ(binary_file.key_count(), 0);
+    EXPECT_FALSE(binary_file.load(QByteArray("QASB", 4)));
+}
+
+// Test case for reading and writing through QSettings
+TEST_F(BinarySettingsFileTest, QSettingsFormatTest)
+{
+    ASSERT_NE(BinarySettingsFile::format(), QSettings::InvalidFormat);
+
+    {
+        QSettings settings(m_binary_file_path, BinarySettingsFile::format());
+        settings.setValue("TestGroup/Group/key1", "value1");
+        settings.setValue("TestGroup/key2", 2);
+    }
+
+    QSettings settings(m_binary_file_path, BinarySettingsFile::format());
+    EXPECT_EQ(settings.status(), QSettings::NoError);
+    EXPECT_EQ(settings.value("TestGroup/Group/key1"), QVariant("value1"));
+    EXPECT_EQ(settings.value("TestGroup/key2"), QVariant(2));
+}
+
+// Test case for converting between INI and binary settings files
+TEST_F(BinarySettingsFileTest, ConvertIniTest)
+{
+    {
+        QSettings ini_settings(m_ini_file_path, QSettings::IniFormat);
+        ini_settings.setValue("TestGroup/Group/key1", "value1");
+        ini_settings.setValue("TestGroup_2/key2", "value2");
+    }
+
+    ASSERT_TRUE(BinarySettingsFile::convert_ini_to_binary(m_ini_file_path, m_binary_file_path));
+
+    BinarySettingsFile binary_file;
+    ASSERT_TRUE(binary_file.open(m_binary_file_path));
+    EXPECT_EQ(binary_file.key_count(), 2);
+    EXPECT_EQ(binary_file.value("TestGroup/Group/key1"), QVariant("value1"));
+    binary_file.close();
+
+    QFile::remove(m_ini_file_path);
+    ASSERT_TRUE(BinarySettingsFile::convert_binary_to_ini(m_binary_file_path, m_ini_file_path));
+
+    QSettings ini_settings(m_ini_file_path, QSettings::IniFormat);
+    EXPECT_EQ(ini_settings.value("TestGroup/Group/key1"), QVariant("value1"));
+    EXPECT_EQ(ini_settings.value("TestGroup_2/key2"), QVariant("value2"));
+    EXPECT_FALSE(BinarySettingsFile::convert_ini_to_binary(m_ini_file_path + ".missing",
+                                                           m_binary_file_path));
+}
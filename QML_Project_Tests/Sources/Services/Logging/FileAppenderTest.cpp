@@ -3,6 +3,24 @@
 #include <QFile>
 #include <QTextStream>
 
+#include "Services/Logging/CrashHandler.h"
+
+namespace
+{
+auto read_file(const QString& file_path) -> QString
+{
+    QFile file(file_path);
+    QString content;
+
+    if (file.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        content = QString::fromUtf8(file.readAll());
+    }
+
+    return content;
+}
+}  // namespace
+
 void FileAppenderTest::SetUp()
 {
     m_test_file_path = "test_log_file.log";
@@ -203,3 +221,87 @@ TEST_F(FileAppenderTest, LogLevelCanBeChangedDynamically)
 
     EXPECT_TRUE(file_content.contains(expected_message));
 }
+
+/**
+ * @brief Tests that buffered messages reach the file on flush, and warnings immediately.
+ */
+TEST_F(FileAppenderTest, BufferedMessagesAreWrittenOnFlushOrWarning)
+{
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "category");
+    m_file_appender->set_buffer_size(4096);
+
+    m_file_appender->append(LogMessage(QtDebugMsg, "Buffered debug"), context);
+
+    EXPECT_EQ(m_file_appender->get_buffer_size(), 4096);
+    EXPECT_GT(m_file_appender->get_buffered_bytes(), 0);
+    EXPECT_FALSE(read_file(m_test_file_path).contains("Buffered debug"));
+
+    m_file_appender->flush();
+
+    EXPECT_EQ(m_file_appender->get_buffered_bytes(), 0);
+    EXPECT_TRUE(read_file(m_test_file_path).contains("Buffered debug"));
+
+    m_file_appender->append(LogMessage(QtInfoMsg, "Buffered info"), context);
+    m_file_appender->append(LogMessage(QtWarningMsg, "Urgent warning"), context);
+
+    QString content = read_file(m_test_file_path);
+    EXPECT_TRUE(content.contains("Buffered info"));
+    EXPECT_TRUE(content.contains("Urgent warning"));
+}
+
+/**
+ * @brief Tests that a full buffer is written out and messages larger than it are written directly.
+ */
+TEST_F(FileAppenderTest, FullBufferIsWrittenOut)
+{
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "category");
+    m_file_appender->set_buffer_size(256);
+
+    for (int i = 0; i < 20; i++)
+    {
+        m_file_appender->append(LogMessage(QtDebugMsg, QStringLiteral("Line %1").arg(i)), context);
+    }
+
+    EXPECT_TRUE(read_file(m_test_file_path).contains("Line 0"));
+    EXPECT_LE(m_file_appender->get_buffered_bytes(), 256);
+
+    m_file_appender->append(LogMessage(QtDebugMsg, QString(1000, QLatin1Char('x'))), context);
+
+    EXPECT_TRUE(read_file(m_test_file_path).contains(QString(1000, QLatin1Char('x'))));
+}
+
+/**
+ * @brief Tests that the crash handler's emergency flush writes the buffered messages.
+ */
+TEST_F(FileAppenderTest, EmergencyFlushWritesBufferedMessages)
+{
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "category");
+    m_file_appender->set_buffer_size(4096);
+    m_file_appender->append(LogMessage(QtDebugMsg, "Last words"), context);
+
+    ASSERT_TRUE(CrashHandler::register_appender(m_file_appender));
+    CrashHandler::emergency_flush();
+    CrashHandler::unregister_all();
+
+    EXPECT_TRUE(read_file(m_test_file_path).contains("Last words"));
+}
+
+/**
+ * @brief Tests that the emergency flush does not write messages a flush has written already.
+ */
+TEST_F(FileAppenderTest, EmergencyFlushDoesNotRepeatWrittenMessages)
+{
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "category");
+    m_file_appender->set_buffer_size(4096);
+    m_file_appender->append(LogMessage(QtDebugMsg, "Written once"), context);
+    m_file_appender->flush();
+    m_file_appender->append(LogMessage(QtDebugMsg, "Still buffered"), context);
+
+    ASSERT_TRUE(CrashHandler::register_appender(m_file_appender));
+    CrashHandler::emergency_flush();
+    CrashHandler::unregister_all();
+
+    QString content = read_file(m_test_file_path);
+    EXPECT_EQ(content.count("Written once"), 1);
+    EXPECT_EQ(content.count("Still buffered"), 1);
+}
@@ -0,0 +1,170 @@
+#include "Services/Logging/LocalSocketAppenderTest.h"
+
+#include <QCoreApplication>
+#include <QDeadlineTimer>
+#include <QThread>
+#include <QtEndian>
+
+TestLogCollector::TestLogCollector(QString server_name): m_server_name(std::move(server_name))
+{
+    QObject::connect(&m_server, &QLocalServer::newConnection, [this]() {
+        while (QLocalSocket* socket = m_server.nextPendingConnection())
+        {
+            QObject::connect(socket, &QLocalSocket::readyRead,
+                             [this, socket]() { read_frames(socket); });
+            QObject::connect(socket, &QLocalSocket::disconnected, socket,
+                             &QLocalSocket::deleteLater);
+        }
+    });
+}
+
+TestLogCollector::~TestLogCollector()
+{
+    close();
+}
+
+auto TestLogCollector::listen() -> bool
+{
+    QLocalServer::removeServer(m_server_name);
+    return m_server.listen(m_server_name);
+}
+
+auto TestLogCollector::close() -> void
+{
+    m_server.close();
+}
+
+auto TestLogCollector::get_messages() const -> const QStringList&
+{
+    return m_messages;
+}
+
+/**
+ * @brief Reads all complete frames that are available on the given socket.
+ *
+ * @param socket The socket to read from.
+ */
+auto TestLogCollector::read_frames(QLocalSocket* socket) -> void
+{
+    m_buffer.append(socket->readAll());
+
+    while (m_buffer.size() >= static_cast<qsizetype>(sizeof(quint32)))
+    {
+        auto frame_size = static_cast<qsizetype>(qFromBigEndian<quint32>(m_buffer.constData()));
+
+        if (m_buffer.size() < static_cast<qsizetype>(sizeof(quint32)) + frame_size)
+        {
+            break;
+        }
+
+        m_messages.append(QString::fromUtf8(m_buffer.mid(sizeof(quint32), frame_size)));
+        m_buffer.remove(0, static_cast<qsizetype>(sizeof(quint32)) + frame_size);
+    }
+}
+
+void LocalSocketAppenderTest::SetUp()
+{
+    m_server_name =
+        QStringLiteral("qmlapp_test_collector_%1").arg(QCoreApplication::applicationPid());
+}
+
+void LocalSocketAppenderTest::TearDown()
+{
+    QLocalServer::removeServer(m_server_name);
+}
+
+/**
+ * @brief Processes events until the condition is met or the timeout expires.
+ *
+ * @param condition The condition to wait for.
+ * @param timeout_ms The timeout in milliseconds.
+ * @return True if the condition was met, false if the timeout expired.
+ */
+auto LocalSocketAppenderTest::wait_until(const std::function<bool()>& condition,
+                                         int timeout_ms) -> bool
+{
+    QDeadlineTimer deadline(timeout_ms);
+
+    while (!condition() && !deadline.hasExpired())
+    {
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+        QThread::msleep(1);
+    }
+
+    return condition();
+}
+
+/**
+ * @brief Tests that a frame consists of a big-endian length prefix followed by the payload.
+ */
+TEST_F(LocalSocketAppenderTest, EncodeFrameAddsLengthPrefix)
+{
+    QByteArray payload = "hello";
+    QByteArray frame = LocalSocketAppender::encode_frame(payload);
+
+    ASSERT_EQ(frame.size(), static_cast<qsizetype>(sizeof(quint32)) + payload.size());
+    EXPECT_EQ(qFromBigEndian<quint32>(frame.constData()), static_cast<quint32>(payload.size()));
+    EXPECT_EQ(frame.mid(sizeof(quint32)), payload);
+}
+
+/**
+ * @brief Tests that appended messages arrive at a running collector in order.
+ */
+TEST_F(LocalSocketAppenderTest, MessagesAreShippedToCollector)
+{
+    TestLogCollector collector(m_server_name);
+    ASSERT_TRUE(collector.listen());
+
+    LocalSocketAppender appender(m_server_name, QSharedPointer<SimpleFormatter>::create(), 1024,
+                                 10);
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "category");
+
+    for (int i = 0; i < 100; i++)
+    {
+        appender.append(LogMessage(QtInfoMsg, QStringLiteral("message %1").arg(i)), context);
+    }
+
+    ASSERT_TRUE(wait_until([&collector]() { return collector.get_messages().size() == 100; }));
+    EXPECT_TRUE(collector.get_messages().first().contains("message 0"));
+    EXPECT_TRUE(collector.get_messages().last().contains("message 99"));
+    EXPECT_EQ(appender.get_dropped_count(), 0U);
+}
+
+/**
+ * @brief Tests that messages logged while the collector is down are delivered after it starts.
+ */
+TEST_F(LocalSocketAppenderTest, SpilledMessagesAreDeliveredAfterReconnect)
+{
+    LocalSocketAppender appender(m_server_name, QSharedPointer<SimpleFormatter>::create(), 1024,
+                                 10);
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "category");
+
+    appender.append(LogMessage(QtWarningMsg, "logged before collector"), context);
+    EXPECT_GT(appender.get_pending_bytes(), 0);
+
+    TestLogCollector collector(m_server_name);
+    ASSERT_TRUE(collector.listen());
+
+    ASSERT_TRUE(wait_until([&collector]() { return collector.get_messages().size() == 1; }));
+    EXPECT_TRUE(collector.get_messages().first().contains("logged before collector"));
+    EXPECT_EQ(appender.get_pending_bytes(), 0);
+}
+
+/**
+ * @brief Tests that the spill buffer is bounded and drops the oldest frames when full.
+ */
+TEST_F(LocalSocketAppenderTest, SpillBufferIsBounded)
+{
+    const qsizetype max_spill_bytes = 4096;
+    LocalSocketAppender appender(m_server_name, QSharedPointer<SimpleFormatter>::create(), 1024,
+                                 10, max_spill_bytes);
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "category");
+
+    for (int i = 0; i < 1000; i++)
+    {
+        appender.append(LogMessage(QtDebugMsg, QStringLiteral("message %1").arg(i)), context);
+    }
+
+    EXPECT_LE(appender.get_pending_bytes(), max_spill_bytes);
+    EXPECT_GT(appender.get_dropped_count(), 0U);
+}
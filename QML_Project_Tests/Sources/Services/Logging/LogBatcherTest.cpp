@@ -0,0 +1,278 @@
+#include "Services/Logging/LogBatcherTest.h"
+
+#include <QElapsedTimer>
+#include <QThread>
+#include <thread>
+#include <vector>
+
+#include "Services/Logging/ConsoleAppender.h"
+#include "Services/Logging/LogAppender.h"
+#include "Services/Logging/Logger.h"
+#include "Services/Logging/SimpleFormatter.h"
+
+namespace
+{
+auto make_record(QtMsgType type, const QString& message) -> LogRecord
+{
+    LogRecord record;
+    record.sequence = LogRecord::next_sequence();
+    record.type = type;
+    record.message = message;
+    return record;
+}
+
+class NullLogAppender: public LogAppender
+{
+    protected:
+        auto internal_append(const LogMessage& /*message*/,
+                             const QMessageLogContext& /*context*/) -> void override
+        {}
+};
+
+// Flushes the logger from the writer thread, like ConsoleAppender does before a fatal message
+class FlushingLogAppender: public LogAppender
+{
+    protected:
+        auto internal_append(const LogMessage& /*message*/,
+                             const QMessageLogContext& /*context*/) -> void override
+        {
+            Logger::get_instance().flush();
+        }
+};
+}  // namespace
+
+void LogBatcherTest::SetUp()
+{
+    m_consumed.clear();
+    Logger::get_instance().set_log_level(QtDebugMsg);
+}
+
+void LogBatcherTest::TearDown()
+{
+    Logger::get_instance().disable_batching();
+    Logger::get_instance().clear_appenders();
+}
+
+auto LogBatcherTest::make_batcher(qsizetype max_batch_size, int max_batch_delay_ms)
+    -> std::unique_ptr<LogBatcher>
+{
+    return std::make_unique<LogBatcher>(
+        [this](const LogRecord& record) {
+            QMutexLocker locker(&m_mutex);
+            m_consumed.append(record);
+        },
+        max_batch_size, max_batch_delay_ms);
+}
+
+auto LogBatcherTest::wait_for_consumed(qsizetype count, int timeout_ms) -> bool
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    while (consumed().size() < count && timer.elapsed() < timeout_ms)
+    {
+        QThread::msleep(1);
+    }
+
+    return consumed().size() >= count;
+}
+
+auto LogBatcherTest::consumed() -> QList<LogRecord>
+{
+    QMutexLocker locker(&m_mutex);
+    return m_consumed;
+}
+
+/**
+ * @brief Tests that records below the batch size stay staged until they are flushed.
+ */
+TEST_F(LogBatcherTest, KeepsRecordsStagedUntilFlushed)
+{
+    auto batcher = make_batcher(64, 60000);
+
+    batcher->stage(make_record(QtDebugMsg, "first"));
+    batcher->stage(make_record(QtInfoMsg, "second"));
+    batcher->stage(make_record(QtDebugMsg, "third"));
+    QThread::msleep(20);
+
+    EXPECT_EQ(batcher->pending_record_count(), 3);
+    EXPECT_TRUE(consumed().isEmpty());
+    EXPECT_EQ(batcher->get_staging_buffer_count(), 1);
+
+    batcher->flush();
+
+    ASSERT_EQ(consumed().size(), 3);
+    EXPECT_EQ(consumed()[0].message, "first");
+    EXPECT_EQ(consumed()[2].message, "third");
+    EXPECT_EQ(batcher->pending_record_count(), 0);
+}
+
+/**
+ * @brief Tests that a warning hands off the staged records immediately.
+ */
+TEST_F(LogBatcherTest, WarningTriggersImmediateHandOff)
+{
+    auto batcher = make_batcher(64, 60000);
+
+    batcher->stage(make_record(QtDebugMsg, "context"));
+    batcher->stage(make_record(QtWarningMsg, "warning"));
+
+    ASSERT_TRUE(wait_for_consumed(2));
+    EXPECT_EQ(consumed()[0].message, "context");
+    EXPECT_EQ(consumed()[1].message, "warning");
+}
+
+/**
+ * @brief Tests that a full staging buffer and the batch delay both trigger a hand-off.
+ */
+TEST_F(LogBatcherTest, BatchSizeAndDelayTriggerHandOff)
+{
+    auto by_size = make_batcher(4, 60000);
+
+    for (int i = 0; i < 4; i++)
+    {
+        by_size->stage(make_record(QtDebugMsg, QString::number(i)));
+    }
+
+    EXPECT_TRUE(wait_for_consumed(4));
+    by_size.reset();
+    m_consumed.clear();
+
+    auto by_delay = make_batcher(64, 10);
+    by_delay->stage(make_record(QtDebugMsg, "delayed"));
+
+    EXPECT_TRUE(wait_for_consumed(1));
+}
+
+/**
+ * @brief Tests that records from many threads are all consumed, each thread's in order.
+ */
+TEST_F(LogBatcherTest, MergesRecordsFromManyThreads)
+{
+    constexpr int thread_count = 8;
+    constexpr int records_per_thread = 1000;
+    auto batcher = make_batcher(32, 1);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < thread_count; t++)
+    {
+        threads.emplace_back([&batcher, t]() {
+            for (int i = 0; i < records_per_thread; i++)
+            {
+                batcher->stage(make_record(QtDebugMsg, QString::number(t)));
+            }
+        });
+    }
+
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    batcher.reset();
+
+    QList<LogRecord> records = consumed();
+    ASSERT_EQ(records.size(), thread_count * records_per_thread);
+
+    std::vector<quint64> last_sequence(thread_count, 0);
+
+    for (const LogRecord& record: records)
+    {
+        int thread = record.message.toInt();
+        EXPECT_GT(record.sequence, last_sequence[thread]);
+        last_sequence[thread] = record.sequence;
+    }
+}
+
+/**
+ * @brief Tests that the logger stages messages while batching and dispatches them on flush.
+ */
+TEST_F(LogBatcherTest, LoggerDispatchesStagedMessagesOnFlush)
+{
+    Logger& logger = Logger::get_instance();
+    auto appender = QSharedPointer<NullLogAppender>::create();
+    logger.clear_appenders();
+    logger.add_appender(appender);
+    logger.enable_batching(64, 60000);
+
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "batching");
+    logger.log(QtDebugMsg, context, "one");
+    logger.log(QtInfoMsg, context, "two");
+
+    EXPECT_TRUE(logger.is_batching());
+    EXPECT_EQ(logger.pending_record_count(), 2);
+    EXPECT_EQ(appender->get_metrics().snapshot().total_records(), 0U);
+
+    logger.flush();
+
+    EXPECT_EQ(logger.pending_record_count(), 0);
+    EXPECT_EQ(appender->get_metrics().snapshot().total_records(), 2U);
+
+    logger.disable_batching();
+    logger.log(QtDebugMsg, context, "three");
+
+    EXPECT_FALSE(logger.is_batching());
+    EXPECT_EQ(appender->get_metrics().snapshot().total_records(), 3U);
+}
+
+/**
+ * @brief Tests that a batched record is written once by a ConsoleAppender.
+ *
+ * The appender writes through qWarning() on the writer thread. That output must not be logged,
+ * staged and appended again.
+ */
+TEST_F(LogBatcherTest, ConsoleAppenderWritesBatchedRecordOnce)
+{
+    Logger& logger = Logger::get_instance();
+    auto formatter = QSharedPointer<SimpleFormatter>::create();
+    auto appender = QSharedPointer<ConsoleAppender>::create(formatter);
+    logger.clear_appenders();
+    logger.add_appender(appender);
+    logger.enable_batching(64, 1);
+
+    quint64 accepted_before = logger.get_metrics().snapshot().total_records();
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "batching");
+    logger.log(QtWarningMsg, context, "written once");
+
+    // The warning is handed to the writer thread at once; give a loop time to show up
+    QElapsedTimer timer;
+    timer.start();
+
+    while (appender->get_metrics().snapshot().total_records() == 0 && timer.elapsed() < 5000)
+    {
+        QThread::msleep(1);
+    }
+
+    QThread::msleep(50);
+    logger.flush();
+
+    EXPECT_EQ(appender->get_metrics().snapshot().total_records(), 1U);
+    EXPECT_EQ(logger.get_metrics().snapshot().total_records() - accepted_before, 1U);
+    EXPECT_EQ(logger.pending_record_count(), 0);
+}
+
+/**
+ * @brief Tests that an appender can flush the logger while the writer thread dispatches to it.
+ */
+TEST_F(LogBatcherTest, AppenderFlushOnWriterThreadDoesNotDeadlock)
+{
+    Logger& logger = Logger::get_instance();
+    auto appender = QSharedPointer<FlushingLogAppender>::create();
+    logger.clear_appenders();
+    logger.add_appender(appender);
+    logger.enable_batching(64, 1);
+
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "batching");
+    logger.log(QtWarningMsg, context, "first");
+    logger.log(QtWarningMsg, context, "second");
+
+    QElapsedTimer timer;
+    timer.start();
+
+    while (appender->get_metrics().snapshot().total_records() < 2 && timer.elapsed() < 5000)
+    {
+        QThread::msleep(1);
+    }
+
+    EXPECT_EQ(appender->get_metrics().snapshot().total_records(), 2U);
+}
@@ -0,0 +1,126 @@
+#include "Services/Logging/LogClockTest.h"
+
+#include <QDateTime>
+#include <QStringList>
+#include <QThread>
+
+#include "Services/Logging/LogMessage.h"
+#include "Services/Logging/LogModelAppender.h"
+#include "Services/Logging/LogRecord.h"
+#include "Services/Logging/Logger.h"
+
+void LogClockTest::SetUp()
+{
+    Logger::get_instance().set_log_level(QtDebugMsg);
+}
+
+void LogClockTest::TearDown()
+{
+    Logger::get_instance().clear_appenders();
+}
+
+/**
+ * @brief Tests that consecutive readings never go backwards.
+ */
+TEST_F(LogClockTest, NowIsMonotonic)
+{
+    quint64 previous = LogClock::now();
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        quint64 current = LogClock::now();
+        ASSERT_GE(current, previous);
+        previous = current;
+    }
+}
+
+/**
+ * @brief Tests that a fresh reading converts to the current wall time.
+ */
+TEST_F(LogClockTest, ConvertsToWallTime)
+{
+    qint64 converted = LogClock::to_msecs_since_epoch(LogClock::now());
+
+    EXPECT_LE(qAbs(converted - QDateTime::currentMSecsSinceEpoch()), 50);
+}
+
+/**
+ * @brief Tests that the difference of two converted readings matches the time in between.
+ */
+TEST_F(LogClockTest, MeasuresElapsedTime)
+{
+    quint64 start = LogClock::now();
+    QThread::msleep(50);
+    quint64 end = LogClock::now();
+
+    qint64 elapsed_ms = LogClock::to_msecs_since_epoch(end) - LogClock::to_msecs_since_epoch(start);
+
+    EXPECT_GE(elapsed_ms, 40);
+    EXPECT_LE(elapsed_ms, 1000);
+    EXPECT_GT(LogClock::ticks_per_second(), 0.0);
+}
+
+/**
+ * @brief Tests that refining the rate neither changes converted ticks nor makes later ticks
+ * convert to an earlier time.
+ */
+TEST_F(LogClockTest, ConversionIsStableAcrossRefinement)
+{
+    quint64 first = LogClock::now();
+    qint64 first_ms = LogClock::to_msecs_since_epoch(first);
+    qint64 previous_ms = first_ms;
+
+    // The sleeps add up to more than the first refinement interval of one second
+    for (int i = 0; i < 3; ++i)
+    {
+        QThread::msleep(600);
+        qint64 current_ms = LogClock::to_msecs_since_epoch(LogClock::now());
+
+        EXPECT_GE(current_ms, previous_ms);
+        EXPECT_EQ(LogClock::to_msecs_since_epoch(first), first_ms);
+        previous_ms = current_ms;
+    }
+}
+
+/**
+ * @brief Tests that the clock reports one of the known sources.
+ */
+TEST_F(LogClockTest, ReportsSource)
+{
+    QStringList names = {"tsc", "monotonic_coarse", "monotonic", "steady_clock"};
+
+    EXPECT_TRUE(names.contains(LogClock::source_name()));
+}
+
+/**
+ * @brief Tests that records keep the timestamp of their message and hand it back.
+ */
+TEST_F(LogClockTest, RecordsKeepMessageTimestamp)
+{
+    LogMessage message(QtInfoMsg, QStringLiteral("Stamped"));
+    message.set_timestamp(LogClock::now());
+    QMessageLogContext context("file.cpp", 1, "function", "category");
+
+    LogRecord record = LogRecord::capture(message, context);
+
+    EXPECT_EQ(record.timestamp_ticks, message.get_timestamp());
+    EXPECT_EQ(record.to_message().get_timestamp(), message.get_timestamp());
+    EXPECT_EQ(record.msecs_since_epoch(), LogClock::to_msecs_since_epoch(message.get_timestamp()));
+}
+
+/**
+ * @brief Tests that the logger stamps the messages it dispatches.
+ */
+TEST_F(LogClockTest, LoggerStampsMessages)
+{
+    auto appender = QSharedPointer<LogModelAppender>::create();
+    Logger::get_instance().add_appender(appender);
+    QMessageLogContext context("file.cpp", 1, "function", "category");
+
+    Logger::get_instance().log(QtInfoMsg, context, QStringLiteral("Stamped by the logger"));
+    QList<LogRecord> records = appender->take_pending();
+
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_NE(records.first().timestamp_ticks, 0U);
+    EXPECT_LE(qAbs(records.first().msecs_since_epoch() - QDateTime::currentMSecsSinceEpoch()), 50);
+}
@@ -0,0 +1,148 @@
+#include "Services/Logging/LogFileReaderTest.h"
+
+#include <QFile>
+
+void LogFileReaderTest::SetUp()
+{
+    ASSERT_TRUE(m_temp_dir.isValid());
+    m_file_path = m_temp_dir.filePath("QmlApp.log");
+    m_reader = new LogFileReader();
+}
+
+void LogFileReaderTest::TearDown()
+{
+    delete m_reader;
+    m_reader = nullptr;
+}
+
+auto LogFileReaderTest::append_to_file(const QByteArray& data) -> void
+{
+    QFile file(m_file_path);
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly | QIODevice::Append));
+    file.write(data);
+    file.close();
+}
+
+/**
+ * @brief Tests that the newline scan finds newlines at every position of a word and in the tail.
+ */
+TEST_F(LogFileReaderTest, FindNewlineFindsFirstNewline)
+{
+    QByteArray data(37, 'x');
+    const auto* begin = reinterpret_cast<const uchar*>(data.constData());
+    const uchar* end = begin + data.size();
+
+    EXPECT_EQ(LogFileReader::find_newline(begin, end), end);
+
+    for (int position = data.size() - 1; position >= 0; position--)
+    {
+        data[position] = '\n';
+        EXPECT_EQ(LogFileReader::find_newline(begin, end) - begin, position);
+    }
+
+    // Bytes just below and above '\n' must not be mistaken for it
+    QByteArray neighbours("\x09\x0b\x8a\x09\x0b\x8a\x09\x0b\x0a");
+    const auto* neighbours_begin = reinterpret_cast<const uchar*>(neighbours.constData());
+    EXPECT_EQ(LogFileReader::find_newline(neighbours_begin, neighbours_begin + neighbours.size()) -
+                  neighbours_begin,
+              8);
+}
+
+/**
+ * @brief Tests random access to the lines of a file, including CRLF lines and a last line
+ * without a line terminator.
+ */
+TEST_F(LogFileReaderTest, ReadsLinesByNumber)
+{
+    append_to_file("first line\nsecond line\r\n\nlast line");
+
+    ASSERT_TRUE(m_reader->open(m_file_path));
+    m_reader->wait_for_index();
+
+    ASSERT_EQ(m_reader->line_count(), 4);
+    EXPECT_EQ(m_reader->line(0), "first line");
+    EXPECT_EQ(m_reader->line(1), "second line");
+    EXPECT_EQ(m_reader->line(2), "");
+    EXPECT_EQ(m_reader->line(3), "last line");
+    EXPECT_EQ(m_reader->line(4), "");
+    EXPECT_EQ(m_reader->line(-1), "");
+}
+
+/**
+ * @brief Tests that a file larger than the synchronously indexed part is indexed completely in
+ * the background.
+ */
+TEST_F(LogFileReaderTest, IndexesLargeFileInBackground)
+{
+    constexpr int kLineCount = 200000;
+    QByteArray data;
+
+    for (int i = 0; i < kLineCount; i++)
+    {
+        data.append("2024-01-01 00:00:00 [Debug] line ");
+        data.append(QByteArray::number(i));
+        data.append('\n');
+    }
+
+    append_to_file(data);
+
+    ASSERT_TRUE(m_reader->open(m_file_path));
+    EXPECT_GT(m_reader->line_count(), 0);
+    EXPECT_TRUE(m_reader->line(0).endsWith("line 0"));
+
+    m_reader->wait_for_index();
+    ASSERT_EQ(m_reader->line_count(), kLineCount);
+    EXPECT_TRUE(m_reader->line(123456).endsWith("line 123456"));
+    EXPECT_TRUE(m_reader->line(kLineCount - 1).endsWith("line 199999"));
+}
+
+/**
+ * @brief Tests that appended data is indexed incrementally, including a line that was partially
+ * written when the file was opened.
+ */
+TEST_F(LogFileReaderTest, RefreshIndexesAppendedLines)
+{
+    append_to_file("line 0\nline 1\nline");
+
+    ASSERT_TRUE(m_reader->open(m_file_path));
+    m_reader->wait_for_index();
+    ASSERT_EQ(m_reader->line_count(), 3);
+    EXPECT_EQ(m_reader->line(2), "line");
+
+    append_to_file(" 2\nline 3\n");
+    m_reader->refresh();
+    m_reader->wait_for_index();
+
+    ASSERT_EQ(m_reader->line_count(), 4);
+    EXPECT_EQ(m_reader->line(2), "line 2");
+    EXPECT_EQ(m_reader->line(3), "line 3");
+}
+
+/**
+ * @brief Tests that a truncated file is reopened from scratch.
+ */
+TEST_F(LogFileReaderTest, RefreshReopensTruncatedFile)
+{
+#ifdef Q_OS_WIN
+    GTEST_SKIP() << "Windows does not allow truncating a file while it is mapped";
+#endif
+
+    append_to_file("old line 0\nold line 1\n");
+    ASSERT_TRUE(m_reader->open(m_file_path));
+    m_reader->wait_for_index();
+
+    bool reset = false;
+    QObject::connect(m_reader, &LogFileReader::fileReset, [&reset]() { reset = true; });
+
+    QFile file(m_file_path);
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write("new\n");
+    file.close();
+
+    m_reader->refresh();
+    m_reader->wait_for_index();
+
+    EXPECT_TRUE(reset);
+    ASSERT_EQ(m_reader->line_count(), 1);
+    EXPECT_EQ(m_reader->line(0), "new");
+}
@@ -0,0 +1,134 @@
+#include "Services/Logging/LogLineParserTest.h"
+
+#include <QDateTime>
+#include <QFile>
+
+#include "Services/Logging/JsonFormatter.h"
+#include "Services/Logging/LogMessage.h"
+#include "Services/Logging/SimpleFormatter.h"
+
+void LogLineParserTest::SetUp()
+{
+    m_test_file_path = "test_log_line_parser.log";
+}
+
+void LogLineParserTest::TearDown()
+{
+    QFile::remove(m_test_file_path);
+}
+
+void LogLineParserTest::write_test_file(const QList<QByteArray>& lines) const
+{
+    QFile file(m_test_file_path);
+
+    if (file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        for (const QByteArray& line: lines)
+        {
+            file.write(line + '\n');
+        }
+    }
+}
+
+/**
+ * @brief Tests that a line written by the SimpleFormatter, with color codes, is parsed back.
+ */
+TEST_F(LogLineParserTest, ParsesSimpleFormatterLine)
+{
+    SimpleFormatter formatter;
+    QMessageLogContext context("src/main.cpp", 42, "void Foo::bar(int, int)", "app");
+    LogMessage message(QtWarningMsg, QStringLiteral("Loaded (3) items"));
+    LogRecord record;
+
+    ASSERT_TRUE(LogLineParser::parse_text_line(formatter.format(message, context), record));
+
+    EXPECT_EQ(record.type, QtWarningMsg);
+    EXPECT_EQ(record.message, QStringLiteral("Loaded (3) items"));
+    EXPECT_EQ(record.file, QByteArray("src/main.cpp"));
+    EXPECT_EQ(record.line, 42);
+    EXPECT_EQ(record.function, QByteArray("void Foo::bar(int, int)"));
+    EXPECT_EQ(record.category, QByteArray("default"));
+    EXPECT_LE(qAbs(record.timestamp_ms - QDateTime::currentMSecsSinceEpoch()), 2000);
+}
+
+/**
+ * @brief Tests that a line written by the JsonFormatter is parsed back, including the category.
+ */
+TEST_F(LogLineParserTest, ParsesJsonFormatterLine)
+{
+    JsonFormatter formatter;
+    QMessageLogContext context("src/settings.cpp", 7, "load", "app.settings");
+    LogMessage message(QtInfoMsg, QStringLiteral("Settings \"loaded\""));
+    LogRecord record;
+
+    ASSERT_TRUE(
+        LogLineParser::parse_json_line(formatter.format(message, context).toUtf8(), record));
+
+    EXPECT_EQ(record.type, QtInfoMsg);
+    EXPECT_EQ(record.message, QStringLiteral("Settings \"loaded\""));
+    EXPECT_EQ(record.category, QByteArray("app.settings"));
+    EXPECT_EQ(record.file, QByteArray("src/settings.cpp"));
+    EXPECT_EQ(record.line, 7);
+    EXPECT_EQ(record.function, QByteArray("load"));
+}
+
+/**
+ * @brief Tests that lines in neither format are rejected.
+ */
+TEST_F(LogLineParserTest, RejectsUnknownLines)
+{
+    LogRecord record;
+
+    EXPECT_FALSE(LogLineParser::parse_text_line(QStringLiteral("just some text"), record));
+    EXPECT_FALSE(LogLineParser::parse_json_line(QByteArray("{\"message\": \"x\"}"), record));
+    EXPECT_FALSE(LogLineParser::parse_json_line(QByteArray("{broken"), record));
+}
+
+/**
+ * @brief Tests that level names are matched without regard to case.
+ */
+TEST_F(LogLineParserTest, ParsesLevelNames)
+{
+    QtMsgType level = QtDebugMsg;
+
+    EXPECT_TRUE(LogLineParser::parse_level(u"Critical", level));
+    EXPECT_EQ(level, QtCriticalMsg);
+    EXPECT_TRUE(LogLineParser::parse_level(u"warning", level));
+    EXPECT_EQ(level, QtWarningMsg);
+    EXPECT_FALSE(LogLineParser::parse_level(u"verbose", level));
+}
+
+/**
+ * @brief Tests that a file with both formats is parsed in order and continuation lines are kept.
+ */
+TEST_F(LogLineParserTest, ParsesMixedFileWithContinuationLines)
+{
+    write_test_file({
+        QByteArray("leading garbage"),
+        QByteArray("[Debug    ]: 2024-05-01 10:00:00 - First line (main.cpp:1, main)"),
+        QByteArray("second line of the message"),
+        QByteArray(R"({"time":"2024-05-01T10:00:01.250","level":"info","category":"app",)"
+                   R"("file":"a.cpp","line":2,"function":"f","message":"Json record"})"),
+    });
+    QList<LogRecord> records;
+
+    ASSERT_TRUE(LogLineParser::parse_file(m_test_file_path, records));
+
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0].message, QStringLiteral("First line\nsecond line of the message"));
+    EXPECT_EQ(records[0].sequence, 0U);
+    EXPECT_EQ(records[1].message, QStringLiteral("Json record"));
+    EXPECT_EQ(records[1].sequence, 1U);
+    EXPECT_EQ(records[1].timestamp_ms - records[0].timestamp_ms, 1250);
+}
+
+/**
+ * @brief Tests that a missing file is reported.
+ */
+TEST_F(LogLineParserTest, ReportsMissingFile)
+{
+    QList<LogRecord> records;
+
+    EXPECT_FALSE(LogLineParser::parse_file(QStringLiteral("does_not_exist.log"), records));
+    EXPECT_TRUE(records.isEmpty());
+}
@@ -0,0 +1,90 @@
+#include "Services/Logging/LogMetricsTest.h"
+
+void LogMetricsTest::SetUp()
+{
+    m_metrics.reset();
+}
+
+void LogMetricsTest::TearDown()
+{
+    m_metrics.reset();
+}
+
+/**
+ * @brief Tests that accepted records are counted per level and filtered records separately.
+ */
+TEST_F(LogMetricsTest, CountsRecordsByLevel)
+{
+    m_metrics.record_accepted(QtDebugMsg);
+    m_metrics.record_accepted(QtDebugMsg);
+    m_metrics.record_accepted(QtWarningMsg);
+    m_metrics.record_accepted(QtInfoMsg);
+    m_metrics.record_filtered();
+    m_metrics.record_bytes(42);
+
+    LogMetricsSnapshot snapshot = m_metrics.snapshot();
+    EXPECT_EQ(snapshot.records(QtDebugMsg), 2U);
+    EXPECT_EQ(snapshot.records(QtWarningMsg), 1U);
+    EXPECT_EQ(snapshot.records(QtInfoMsg), 1U);
+    EXPECT_EQ(snapshot.records(QtCriticalMsg), 0U);
+    EXPECT_EQ(snapshot.total_records(), 4U);
+    EXPECT_EQ(snapshot.records_filtered, 1U);
+    EXPECT_EQ(snapshot.bytes_emitted, 42U);
+}
+
+/**
+ * @brief Tests that reset sets all counters back to zero.
+ */
+TEST_F(LogMetricsTest, ResetClearsAllCounters)
+{
+    m_metrics.record_accepted(QtCriticalMsg);
+    m_metrics.record_filtered();
+    m_metrics.record_bytes(10);
+    m_metrics.record_latency(1000);
+
+    m_metrics.reset();
+
+    LogMetricsSnapshot snapshot = m_metrics.snapshot();
+    EXPECT_EQ(snapshot.total_records(), 0U);
+    EXPECT_EQ(snapshot.records_filtered, 0U);
+    EXPECT_EQ(snapshot.bytes_emitted, 0U);
+    EXPECT_EQ(snapshot.latency.count, 0U);
+}
+
+/**
+ * @brief Tests that every value lies within the bounds of the bucket it is counted in.
+ */
+TEST_F(LogMetricsTest, HistogramBucketsContainTheirValues)
+{
+    for (quint64 value: {quint64{0}, quint64{7}, quint64{8}, quint64{15}, quint64{16},
+                         quint64{1000}, quint64{123456789}, ~quint64{0}})
+    {
+        int index = LatencyHistogram::bucket_index(value);
+        ASSERT_GE(index, 0);
+        ASSERT_LT(index, LatencyHistogram::kBucketCount);
+        EXPECT_LE(value, LatencyHistogram::bucket_upper_bound(index));
+
+        if (index > 0)
+        {
+            EXPECT_GT(value, LatencyHistogram::bucket_upper_bound(index - 1));
+        }
+    }
+}
+
+/**
+ * @brief Tests that percentiles are reported within the relative error of the histogram.
+ */
+TEST_F(LogMetricsTest, HistogramPercentilesAreWithinRelativeError)
+{
+    for (quint64 value = 1; value <= 1000; value++)
+    {
+        m_metrics.record_latency(value * 1000);
+    }
+
+    LatencyHistogram::Snapshot latency = m_metrics.snapshot().latency;
+    EXPECT_EQ(latency.count, 1000U);
+    EXPECT_EQ(latency.max_ns, 1000000U);
+    EXPECT_NEAR(static_cast<double>(latency.percentile(0.5)), 500000.0, 500000.0 * 0.125);
+    EXPECT_NEAR(static_cast<double>(latency.percentile(0.99)), 990000.0, 990000.0 * 0.125);
+    EXPECT_EQ(latency.percentile(1.0), 1000000U);
+}
@@ -0,0 +1,75 @@
+#include "Services/Logging/LogRedactorTest.h"
+
+#include "Services/Logging/Logger.h"
+
+void LogRedactorTest::SetUp() {}
+
+void LogRedactorTest::TearDown()
+{
+    Logger::get_instance().set_redactor(nullptr);
+}
+
+/**
+ * @brief Tests that messages without sensitive data are returned unchanged.
+ */
+TEST_F(LogRedactorTest, KeepsMessagesWithoutMatches)
+{
+    QByteArray output;
+
+    EXPECT_FALSE(m_redactor.redact_utf8("Loaded 42 settings in 3 ms", output));
+    EXPECT_EQ(m_redactor.redact("Loaded 42 settings in 3 ms"), "Loaded 42 settings in 3 ms");
+    EXPECT_EQ(m_redactor.redact("Mail me @ noon"), "Mail me @ noon");
+    EXPECT_EQ(m_redactor.redact(""), "");
+}
+
+/**
+ * @brief Tests the default rules for tokens, credentials, email addresses and paths.
+ */
+TEST_F(LogRedactorTest, RedactsWithDefaultRules)
+{
+    EXPECT_EQ(m_redactor.redact("Authorization: Bearer eyJhbGciOi.J9x-_y== sent"),
+              "Authorization: Bearer <token> sent");
+    EXPECT_EQ(m_redactor.redact("GET /api?token=abc123&page=2"),
+              "GET /api?token=<redacted>&page=2");
+    EXPECT_EQ(m_redactor.redact("login password=hunter2 failed"),
+              "login password=<redacted> failed");
+    EXPECT_EQ(m_redactor.redact("Sent to jane.doe+logs@example.com."), "Sent to <email>");
+    EXPECT_EQ(m_redactor.redact("Opened /home/jane/.config/app.ini"), "Opened <path>");
+    EXPECT_EQ(m_redactor.redact("Opened C:\\Users\\Jane\\app.ini"), "Opened <path>");
+}
+
+/**
+ * @brief Tests that several matches in one message, including non-ASCII text around them, are
+ * all replaced in a single pass.
+ */
+TEST_F(LogRedactorTest, RedactsMultipleMatches)
+{
+    EXPECT_EQ(m_redactor.redact("Grüße an a@b.de und c@d.de, Datei /home/jörg/ö.txt"),
+              "Grüße an <email> und <email>, Datei <path>");
+}
+
+/**
+ * @brief Tests custom rules with overlapping triggers and a shared prefix.
+ */
+TEST_F(LogRedactorTest, CustomRulesWithOverlappingTriggers)
+{
+    LogRedactor redactor({{"secret", "<s>", {}, {}, false},
+                          {"secretary", "<role>", {}, {}, false},
+                          {"ret", "<r>", {}, {}, false}});
+
+    EXPECT_GT(redactor.get_state_count(), 1);
+    EXPECT_EQ(redactor.redact("top secret"), "top <s>");
+    EXPECT_EQ(redactor.redact("retry"), "<r>ry");
+    EXPECT_EQ(redactor.redact("a secretary"), "a <s>ary");
+}
+
+/**
+ * @brief Tests that the Logger passes redacted messages to its appenders.
+ */
+TEST_F(LogRedactorTest, LoggerRedactsBeforeDispatch)
+{
+    Logger::get_instance().set_redactor(QSharedPointer<const LogRedactor>::create());
+
+    EXPECT_NE(Logger::get_instance().get_redactor(), nullptr);
+    EXPECT_EQ(Logger::get_instance().get_redactor()->redact("token=abc"), "token=<redacted>");
+}
@@ -0,0 +1,169 @@
+#include "Services/Logging/LogRoutingTableTest.h"
+
+#include "Services/Logging/Logger.h"
+
+void LogRoutingTableTest::SetUp()
+{
+    Logger::get_instance().set_log_level(QtDebugMsg);
+
+    for (const QString& name: {QStringLiteral("console"), QStringLiteral("file"),
+                               QStringLiteral("model")})
+    {
+        auto appender = QSharedPointer<CountingLogAppender>::create();
+        appender->set_name(name);
+        m_appenders.append(appender);
+    }
+}
+
+void LogRoutingTableTest::TearDown()
+{
+    Logger::get_instance().disable_batching();
+    Logger::get_instance().set_routes({});
+    Logger::get_instance().clear_appenders();
+}
+
+auto LogRoutingTableTest::received(qsizetype index) const -> quint64
+{
+    return m_appenders[index]->get_metrics().snapshot().total_records();
+}
+
+/**
+ * @brief Tests that an empty table sends every record to all appenders.
+ */
+TEST_F(LogRoutingTableTest, EmptyTableRoutesToAllAppenders)
+{
+    LogRoutingTable table;
+    table.compile(m_appenders);
+
+    EXPECT_TRUE(table.is_empty());
+    EXPECT_EQ(table.route("app.settings", QtDebugMsg), 0b111U);
+    EXPECT_EQ(table.route(nullptr, QtCriticalMsg), 0b111U);
+}
+
+/**
+ * @brief Tests exact and prefix category patterns and the minimum level of a route.
+ */
+TEST_F(LogRoutingTableTest, MatchesExactAndPrefixCategories)
+{
+    LogRoutingTable table({{"qt.qml.*", QtWarningMsg, {"file"}},
+                           {"app.settings", QtDebugMsg, {"model"}}});
+    table.compile(m_appenders);
+
+    EXPECT_EQ(table.route("qt.qml.binding", QtWarningMsg), 0b010U);
+    EXPECT_EQ(table.route("qt.qml.binding", QtCriticalMsg), 0b010U);
+    EXPECT_EQ(table.route("app.settings", QtDebugMsg), 0b100U);
+
+    // Below the minimum level, or not matching at all, a record goes to all appenders
+    EXPECT_EQ(table.route("qt.qml.binding", QtInfoMsg), 0b111U);
+    EXPECT_EQ(table.route("app.settings.io", QtDebugMsg), 0b111U);
+    EXPECT_EQ(table.route("qt.qmlx", QtWarningMsg), 0b111U);
+}
+
+/**
+ * @brief Tests that a record matching several routes goes to the union of their appenders.
+ */
+TEST_F(LogRoutingTableTest, UnitesMatchingRoutes)
+{
+    LogRoutingTable table({{"*", QtDebugMsg, {"model"}},
+                           {"*", QtCriticalMsg, {"*"}},
+                           {"app.*", QtInfoMsg, {"console", "missing"}}});
+    table.compile(m_appenders);
+
+    EXPECT_EQ(table.route("net", QtDebugMsg), 0b100U);
+    EXPECT_EQ(table.route("app.ui", QtDebugMsg), 0b100U);
+    EXPECT_EQ(table.route("app.ui", QtInfoMsg), 0b101U);
+    EXPECT_EQ(table.route("net", QtCriticalMsg), 0b111U);
+    EXPECT_EQ(table.route("net", QtFatalMsg), 0b111U);
+}
+
+/**
+ * @brief Tests that masks are cached once per category string and dropped on recompilation.
+ */
+TEST_F(LogRoutingTableTest, CachesMasksPerCategory)
+{
+    static const char* const category = "app.cache";
+    LogRoutingTable table({{"app.*", QtDebugMsg, {"file"}}});
+    table.compile(m_appenders);
+
+    EXPECT_EQ(table.get_cached_category_count(), 0);
+    EXPECT_EQ(table.route(category, QtDebugMsg), 0b010U);
+    EXPECT_EQ(table.route(category, QtWarningMsg), 0b010U);
+    EXPECT_EQ(table.get_cached_category_count(), 1);
+
+    m_appenders.prepend(QSharedPointer<CountingLogAppender>::create());
+    table.compile(m_appenders);
+
+    EXPECT_EQ(table.get_cached_category_count(), 0);
+    EXPECT_EQ(table.route(category, QtDebugMsg), 0b100U);
+}
+
+/**
+ * @brief Tests that the logger only dispatches records to the appenders they are routed to.
+ */
+TEST_F(LogRoutingTableTest, LoggerDispatchesRoutedRecords)
+{
+    Logger& logger = Logger::get_instance();
+    logger.clear_appenders();
+
+    for (const auto& appender: m_appenders)
+    {
+        logger.add_appender(appender);
+    }
+
+    logger.set_routes({{"app.verbose", QtDebugMsg, {"file"}},
+                       {"*", QtWarningMsg, {"console", "model"}}});
+
+    QMessageLogContext verbose_context(__FILE__, __LINE__, Q_FUNC_INFO, "app.verbose");
+    QMessageLogContext other_context(__FILE__, __LINE__, Q_FUNC_INFO, "app.other");
+
+    logger.log(QtDebugMsg, verbose_context, "verbose detail");
+    logger.log(QtWarningMsg, verbose_context, "verbose warning");
+    logger.log(QtWarningMsg, other_context, "other warning");
+
+    EXPECT_EQ(received(0), 2U);
+    EXPECT_EQ(received(1), 2U);
+    EXPECT_EQ(received(2), 2U);
+
+    logger.set_routes({});
+    logger.log(QtDebugMsg, other_context, "unrouted");
+
+    EXPECT_EQ(received(0), 3U);
+    EXPECT_EQ(received(1), 3U);
+    EXPECT_EQ(received(2), 3U);
+}
+
+/**
+ * @brief Tests that batched records of two categories are routed by category name.
+ *
+ * Batched records carry their own copy of the category name, so every record has a different
+ * category address.
+ */
+TEST_F(LogRoutingTableTest, RoutesBatchedRecordsByCategoryName)
+{
+    Logger& logger = Logger::get_instance();
+    logger.clear_appenders();
+
+    for (const auto& appender: m_appenders)
+    {
+        logger.add_appender(appender);
+    }
+
+    logger.set_routes({{"app.file", QtDebugMsg, {"file"}}, {"app.model", QtDebugMsg, {"model"}}});
+    logger.enable_batching(16, 60000);
+
+    QMessageLogContext file_context(__FILE__, __LINE__, Q_FUNC_INFO, "app.file");
+    QMessageLogContext model_context(__FILE__, __LINE__, Q_FUNC_INFO, "app.model");
+
+    for (int i = 0; i < 200; i++)
+    {
+        logger.log(QtDebugMsg, file_context, "to file");
+        logger.log(QtDebugMsg, model_context, "to model");
+    }
+
+    logger.flush();
+
+    EXPECT_EQ(received(0), 0U);
+    EXPECT_EQ(received(1), 200U);
+    EXPECT_EQ(received(2), 200U);
+    EXPECT_EQ(logger.get_routing_table().get_cached_category_count(), 2);
+}
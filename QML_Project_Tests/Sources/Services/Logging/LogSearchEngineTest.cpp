@@ -0,0 +1,176 @@
+#include "Services/Logging/LogSearchEngineTest.h"
+
+#include <QFile>
+#include <QVariantMap>
+
+#ifdef QMLAPP_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+void LogSearchEngineTest::SetUp()
+{
+    ASSERT_TRUE(m_temp_dir.isValid());
+    m_engine = new LogSearchEngine();
+}
+
+void LogSearchEngineTest::TearDown()
+{
+    delete m_engine;
+    m_engine = nullptr;
+}
+
+auto LogSearchEngineTest::write_log(const QString& file_name, int line_count) -> QString
+{
+    QString file_path = m_temp_dir.filePath(file_name);
+    QFile file(file_path);
+    EXPECT_TRUE(file.open(QIODevice::WriteOnly));
+
+    for (int i = 0; i < line_count; i++)
+    {
+        QByteArray level = (i % 10 == 0) ? "Warning" : "Debug";
+        file.write("[" + level + "] " + file_name.toUtf8() + " line " + QByteArray::number(i) +
+                   "\n");
+    }
+
+    file.close();
+    return file_path;
+}
+
+auto LogSearchEngineTest::run_search(const QStringList& file_paths, const QString& pattern,
+                                     bool case_sensitive) -> QVariantList
+{
+    QVariantList matches;
+    QMetaObject::Connection connection =
+        QObject::connect(m_engine, &LogSearchEngine::matchesFound,
+                         [&matches](const QVariantList& found) { matches.append(found); });
+
+    EXPECT_TRUE(m_engine->search(file_paths, pattern, case_sensitive));
+    m_engine->wait_for_finished();
+    QObject::disconnect(connection);
+
+    return matches;
+}
+
+/**
+ * @brief Tests the literal prefix extraction used to prefilter lines.
+ */
+TEST_F(LogSearchEngineTest, LiteralPrefix)
+{
+    EXPECT_EQ(LogSearchEngine::literal_prefix(QRegularExpression("Connection lost")),
+              "Connection lost");
+    EXPECT_EQ(LogSearchEngine::literal_prefix(QRegularExpression("^\\[Warning\\] .*")),
+              "[Warning] ");
+    EXPECT_EQ(LogSearchEngine::literal_prefix(QRegularExpression("timeouts? after \\d+")),
+              "timeout");
+    EXPECT_EQ(LogSearchEngine::literal_prefix(QRegularExpression("ab+c")), "ab");
+    EXPECT_EQ(LogSearchEngine::literal_prefix(QRegularExpression("\\d+ ms")), "");
+    EXPECT_EQ(LogSearchEngine::literal_prefix(QRegularExpression("error|warning")), "");
+    EXPECT_EQ(LogSearchEngine::literal_prefix(
+                  QRegularExpression("error", QRegularExpression::CaseInsensitiveOption)),
+              "");
+}
+
+/**
+ * @brief Tests that matches from many small chunks of several files are reported in file and
+ * line order with correct line numbers.
+ */
+TEST_F(LogSearchEngineTest, ReportsMatchesInOrder)
+{
+    QString first = write_log("QmlApp.log.1", 500);
+    QString second = write_log("QmlApp.log", 300);
+    m_engine->set_chunk_size(97);
+
+    QVariantList matches = run_search({first, second}, "\\[Warning\\] .* line \\d+$");
+
+    ASSERT_EQ(matches.size(), 80);
+
+    for (int i = 0; i < 50; i++)
+    {
+        QVariantMap match = matches[i].toMap();
+        EXPECT_EQ(match["file"].toString(), first);
+        EXPECT_EQ(match["line"].toLongLong(), i * 10);
+        EXPECT_EQ(match["text"].toString(),
+                  "[Warning] QmlApp.log.1 line " + QString::number(i * 10));
+    }
+
+    QVariantMap last = matches.last().toMap();
+    EXPECT_EQ(last["file"].toString(), second);
+    EXPECT_EQ(last["line"].toLongLong(), 290);
+}
+
+/**
+ * @brief Tests that searching with and without a literal prefix finds the same lines.
+ */
+TEST_F(LogSearchEngineTest, PrefilterDoesNotChangeResults)
+{
+    QString file_path = write_log("QmlApp.log", 1000);
+    m_engine->set_chunk_size(1024);
+
+    QVariantList with_prefix = run_search({file_path}, "line 1\\d\\d$");
+    QVariantList without_prefix = run_search({file_path}, "LINE 1\\d\\d$", false);
+
+    ASSERT_EQ(with_prefix.size(), 100);
+    EXPECT_EQ(with_prefix, without_prefix);
+}
+
+/**
+ * @brief Tests that a cancelled search finishes as cancelled and reports no further matches.
+ */
+TEST_F(LogSearchEngineTest, CancelStopsSearch)
+{
+    QString file_path = write_log("QmlApp.log", 200000);
+    m_engine->set_chunk_size(4096);
+
+    bool finished = false;
+    bool cancelled = false;
+    QObject::connect(m_engine, &LogSearchEngine::finished, [&](bool was_cancelled) {
+        finished = true;
+        cancelled = was_cancelled;
+    });
+
+    ASSERT_TRUE(m_engine->search({file_path}, "line"));
+    EXPECT_TRUE(m_engine->isRunning());
+    m_engine->cancel();
+    m_engine->wait_for_finished();
+
+    EXPECT_TRUE(finished);
+    EXPECT_TRUE(cancelled);
+    EXPECT_FALSE(m_engine->isRunning());
+}
+
+/**
+ * @brief Tests that an invalid pattern is rejected.
+ */
+TEST_F(LogSearchEngineTest, RejectsInvalidPattern)
+{
+    QString file_path = write_log("QmlApp.log", 10);
+
+    EXPECT_FALSE(m_engine->search({file_path}, "line ("));
+    EXPECT_FALSE(m_engine->isRunning());
+}
+
+#ifdef QMLAPP_HAS_ZLIB
+/**
+ * @brief Tests that gzip-compressed segments are decompressed and searched.
+ */
+TEST_F(LogSearchEngineTest, SearchesCompressedSegments)
+{
+    QString plain_path = write_log("QmlApp.log", 1000);
+    QFile plain(plain_path);
+    ASSERT_TRUE(plain.open(QIODevice::ReadOnly));
+    QByteArray content = plain.readAll();
+    plain.close();
+
+    QString compressed_path = m_temp_dir.filePath("QmlApp.log.1.gz");
+    gzFile compressed = gzopen(compressed_path.toLocal8Bit().constData(), "wb");
+    ASSERT_NE(compressed, nullptr);
+    gzwrite(compressed, content.constData(), static_cast<unsigned>(content.size()));
+    gzclose(compressed);
+
+    QVariantList matches = run_search({compressed_path}, "line 99\\d$");
+
+    ASSERT_EQ(matches.size(), 10);
+    EXPECT_EQ(matches.first().toMap()["line"].toLongLong(), 990);
+    EXPECT_EQ(matches.first().toMap()["file"].toString(), compressed_path);
+}
+#endif
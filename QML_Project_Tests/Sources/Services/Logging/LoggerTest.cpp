@@ -115,3 +115,63 @@ TEST_F(LoggerTest, LogMessagesAtOrAboveLogLevelAreAppended)
 
     Logger::get_instance().log(type, context, message);
 }
+
+/**
+ * @brief Tests that the logger and appender metrics count accepted and filtered records.
+ *
+ * This test verifies that a record below the logger log level is counted as filtered by the
+ * logger, and that an accepted record is counted by level in both the logger and the appender.
+ */
+TEST_F(LoggerTest, MetricsCountAcceptedAndFilteredRecords)
+{
+    Logger::get_instance().set_log_level(QtWarningMsg);
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "category");
+    LogMetricsSnapshot before = Logger::get_instance().get_metrics().snapshot();
+
+    EXPECT_CALL(*m_mock_appender, internal_append(_, _)).Times(1);
+
+    Logger::get_instance().log(QtDebugMsg, context, "filtered");
+    Logger::get_instance().log(QtCriticalMsg, context, "accepted");
+
+    LogMetricsSnapshot after = Logger::get_instance().get_metrics().snapshot();
+    EXPECT_EQ(after.records_filtered - before.records_filtered, 1U);
+    EXPECT_EQ(after.records(QtCriticalMsg) - before.records(QtCriticalMsg), 1U);
+    EXPECT_EQ(after.latency.count - before.latency.count, 1U);
+
+    LogMetricsSnapshot appender_snapshot = m_mock_appender->get_metrics().snapshot();
+    EXPECT_EQ(appender_snapshot.records(QtCriticalMsg), 1U);
+    EXPECT_EQ(appender_snapshot.latency.count, 1U);
+
+    Logger::get_instance().set_log_level(QtDebugMsg);
+}
+
+/**
+ * @brief Tests that appenders only time a sample of the records they accept.
+ *
+ * This test verifies that with a sample interval of four, two of eight records are timed, and
+ * that no record is timed once timing is disabled.
+ */
+TEST_F(LoggerTest, AppenderLatencyIsSampled)
+{
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "category");
+    m_mock_appender->set_latency_sample_interval(4);
+
+    EXPECT_CALL(*m_mock_appender, internal_append(_, _)).Times(12);
+
+    for (int i = 0; i < 8; i++)
+    {
+        Logger::get_instance().log(QtWarningMsg, context, "sampled");
+    }
+
+    EXPECT_EQ(m_mock_appender->get_metrics().snapshot().latency.count, 2U);
+
+    m_mock_appender->set_latency_sample_interval(0);
+
+    for (int i = 0; i < 4; i++)
+    {
+        Logger::get_instance().log(QtWarningMsg, context, "not timed");
+    }
+
+    EXPECT_EQ(m_mock_appender->get_metrics().snapshot().latency.count, 2U);
+    EXPECT_EQ(m_mock_appender->get_metrics().snapshot().records(QtWarningMsg), 12U);
+}
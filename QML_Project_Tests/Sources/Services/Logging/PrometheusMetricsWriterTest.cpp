@@ -0,0 +1,62 @@
+#include "Services/Logging/PrometheusMetricsWriterTest.h"
+
+#include <QFile>
+
+void PrometheusMetricsWriterTest::SetUp()
+{
+    m_test_file_path = "test_log_metrics.prom";
+}
+
+void PrometheusMetricsWriterTest::TearDown()
+{
+    QFile::remove(m_test_file_path);
+}
+
+/**
+ * @brief Tests that logger and appender counters are formatted as Prometheus samples.
+ */
+TEST_F(PrometheusMetricsWriterTest, FormatsCountersAndHistograms)
+{
+    LogMetrics logger_metrics;
+    logger_metrics.record_accepted(QtWarningMsg);
+    logger_metrics.record_filtered();
+    logger_metrics.record_latency(2000);
+
+    LogMetrics appender_metrics;
+    appender_metrics.record_accepted(QtWarningMsg);
+    appender_metrics.record_bytes(128);
+    appender_metrics.record_latency(2000);
+
+    QString text = PrometheusMetricsWriter::format_exposition(
+        logger_metrics.snapshot(), {{QStringLiteral("file"), appender_metrics.snapshot()}});
+
+    QString latency_bucket = QStringLiteral("qmlapp_appender_append_latency_seconds_bucket") +
+                             QStringLiteral("{appender=\"file\",index=\"0\",");
+
+    EXPECT_TRUE(text.contains("# TYPE qmlapp_logger_records_total counter"));
+    EXPECT_TRUE(text.contains("qmlapp_logger_records_total{level=\"warning\"} 1"));
+    EXPECT_TRUE(text.contains("qmlapp_logger_records_filtered_total 1"));
+    EXPECT_TRUE(text.contains("qmlapp_appender_bytes_total{appender=\"file\",index=\"0\"} 128"));
+    EXPECT_TRUE(text.contains("# TYPE qmlapp_appender_append_latency_seconds histogram"));
+    EXPECT_TRUE(text.contains(latency_bucket + "le=\"+Inf\"} 1"));
+    EXPECT_TRUE(text.contains(latency_bucket + "le=\"1e-06\"} 0"));
+    EXPECT_TRUE(text.contains(latency_bucket + "le=\"2.5e-06\"} 1"));
+}
+
+/**
+ * @brief Tests that write_now creates the metrics file.
+ */
+TEST_F(PrometheusMetricsWriterTest, WriteNowCreatesFile)
+{
+    PrometheusMetricsWriter writer;
+    writer.start(m_test_file_path, 60000);
+    EXPECT_TRUE(writer.is_running());
+
+    QFile file(m_test_file_path);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly | QIODevice::Text));
+    EXPECT_TRUE(file.readAll().contains("qmlapp_logger_records_total"));
+    file.close();
+
+    writer.stop();
+    EXPECT_FALSE(writer.is_running());
+}
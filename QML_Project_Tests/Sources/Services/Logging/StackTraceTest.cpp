@@ -0,0 +1,92 @@
+#include "Services/Logging/StackTraceTest.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "Services/Logging/JsonFormatter.h"
+#include "Services/Logging/Logger.h"
+
+void StackTraceTest::SetUp()
+{
+    Logger::get_instance().set_log_level(QtDebugMsg);
+}
+
+void StackTraceTest::TearDown()
+{
+    Logger::get_instance().clear_appenders();
+}
+
+/**
+ * @brief Tests that a capture returns raw return addresses and the binary's load address.
+ */
+TEST_F(StackTraceTest, CapturesReturnAddresses)
+{
+    if (!StackTrace::is_supported())
+    {
+        GTEST_SKIP() << "Stack traces are not supported on this platform";
+    }
+
+    QList<quintptr> frames = StackTrace::capture();
+
+    ASSERT_FALSE(frames.isEmpty());
+    EXPECT_LE(frames.size(), StackTrace::kMaxFrames);
+    EXPECT_NE(frames.first(), 0U);
+    EXPECT_NE(StackTrace::image_base(), 0U);
+}
+
+/**
+ * @brief Tests the hexadecimal formatting of addresses.
+ */
+TEST_F(StackTraceTest, FormatsAddressesAsHex)
+{
+    EXPECT_EQ(StackTrace::to_hex(quintptr{0x1f2e}), "0x1f2e");
+    EXPECT_EQ(StackTrace::to_hex(QList<quintptr>{0x10, 0xff}), QStringList({"0x10", "0xff"}));
+}
+
+/**
+ * @brief Tests that the logger attaches stack frames to critical messages only.
+ */
+TEST_F(StackTraceTest, LoggerAttachesFramesToCriticalMessages)
+{
+    auto appender = QSharedPointer<StackFrameRecordingAppender>::create();
+    Logger::get_instance().clear_appenders();
+    Logger::get_instance().add_appender(appender);
+
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "stack");
+    Logger::get_instance().log(QtDebugMsg, context, "debug");
+    Logger::get_instance().log(QtWarningMsg, context, "warning");
+    Logger::get_instance().log(QtCriticalMsg, context, "critical");
+
+    ASSERT_EQ(appender->m_frame_counts.size(), 3);
+    EXPECT_EQ(appender->m_frame_counts[0], 0);
+    EXPECT_EQ(appender->m_frame_counts[1], 0);
+    EXPECT_EQ(appender->m_frame_counts[2] > 0, StackTrace::is_supported());
+}
+
+/**
+ * @brief Tests that the JSON formatter writes the context and, if present, the stack frames.
+ */
+TEST_F(StackTraceTest, JsonFormatterWritesStackFrames)
+{
+    JsonFormatter formatter;
+    QMessageLogContext context("main.cpp", 42, "main", "app");
+    LogMessage message(QtCriticalMsg, "Something \"broke\"");
+
+    QString formatted = formatter.format(message, context);
+    QJsonObject plain = QJsonDocument::fromJson(formatted.toUtf8()).object();
+
+    EXPECT_EQ(plain.value("level").toString(), "critical");
+    EXPECT_EQ(plain.value("category").toString(), "app");
+    EXPECT_EQ(plain.value("line").toInt(), 42);
+    EXPECT_EQ(plain.value("message").toString(), "Something \"broke\"");
+    EXPECT_FALSE(plain.contains("stack"));
+
+    message.set_stack_frames({0x1000, 0x2000});
+    formatted = formatter.format(message, context);
+    QJsonObject with_stack = QJsonDocument::fromJson(formatted.toUtf8()).object();
+
+    EXPECT_FALSE(formatted.contains('\n'));
+    EXPECT_TRUE(with_stack.contains("image_base"));
+    EXPECT_EQ(with_stack.value("stack").toArray(), QJsonArray({"0x1000", "0x2000"}));
+}
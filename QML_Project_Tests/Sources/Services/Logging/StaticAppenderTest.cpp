@@ -0,0 +1,88 @@
+#include "Services/Logging/StaticAppenderTest.h"
+
+#include <QFile>
+
+#include "Services/Logging/FileSink.h"
+#include "Services/Logging/SimpleFormatter.h"
+
+void StaticAppenderTest::SetUp()
+{
+    m_test_file_path = "test_static_appender.log";
+}
+
+void StaticAppenderTest::TearDown()
+{
+    QFile::remove(m_test_file_path);
+}
+
+/**
+ * @brief Tests that messages are formatted by the static formatter and written to the sink.
+ */
+TEST_F(StaticAppenderTest, FormatsAndWritesToSink)
+{
+    StaticAppender<MessageOnlyFormatter, RecordingSink> appender;
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "category");
+
+    appender.append(LogMessage(QtInfoMsg, "first"), context);
+    appender.append(LogMessage(QtWarningMsg, "second"), context);
+
+    EXPECT_EQ(appender.get_name(), "recording");
+    EXPECT_EQ(appender.get_sink().m_lines, QStringList({"first", "second"}));
+    EXPECT_EQ(appender.get_metrics().snapshot().total_records(), 2U);
+}
+
+/**
+ * @brief Tests that the log level of the appender still filters messages.
+ */
+TEST_F(StaticAppenderTest, RespectsLogLevel)
+{
+    StaticAppender<MessageOnlyFormatter, RecordingSink> appender;
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "category");
+    appender.set_log_level(QtWarningMsg);
+
+    appender.append(LogMessage(QtDebugMsg, "hidden"), context);
+    appender.append(LogMessage(QtCriticalMsg, "shown"), context);
+
+    EXPECT_EQ(appender.get_sink().m_lines, QStringList({"shown"}));
+}
+
+/**
+ * @brief Tests that flushes through the virtual appender interface reach the sink.
+ */
+TEST_F(StaticAppenderTest, ForwardsFlushesToSink)
+{
+    auto appender = QSharedPointer<StaticAppender<MessageOnlyFormatter, RecordingSink>>::create();
+    QSharedPointer<LogAppender> base = appender;
+
+    base->flush();
+    base->emergency_flush();
+
+    EXPECT_EQ(appender->get_sink().m_flush_count, 1);
+    EXPECT_EQ(appender->get_sink().m_emergency_flush_count, 1);
+}
+
+/**
+ * @brief Tests the composition of the SimpleFormatter with a buffered FileSink.
+ */
+TEST_F(StaticAppenderTest, WritesFormattedMessagesToFile)
+{
+    QMessageLogContext context(__FILE__, __LINE__, Q_FUNC_INFO, "category");
+    SimpleFormatter formatter;
+    QString expected = formatter.format(LogMessage(QtDebugMsg, "To the file"), context);
+
+    {
+        StaticAppender<SimpleFormatter, FileSink> appender(m_test_file_path, 1024);
+        appender.append(LogMessage(QtDebugMsg, "To the file"), context);
+
+        EXPECT_EQ(appender.get_name(), "file");
+        EXPECT_GT(appender.get_sink().get_buffered_bytes(), 0);
+    }
+
+    QFile file(m_test_file_path);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly | QIODevice::Text));
+    QString content = QString::fromUtf8(file.readAll());
+
+    // The timestamp has second resolution, so only compare the message and the context
+    EXPECT_TRUE(content.contains("To the file"));
+    EXPECT_TRUE(content.contains(expected.mid(expected.indexOf(" - "))));
+}
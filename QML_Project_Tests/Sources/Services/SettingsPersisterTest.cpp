@@ -0,0 +1,66 @@
+#include "Services/SettingsPersisterTest.h"
+
+// Test case for coalescing a burst of changes into one write
+TEST_F(SettingsPersisterTest, DebouncesChangesTest)
+{
+    m_settings_persister->set_delays(50, 1000);
+
+    for (int value = 0; value < 10; value++)
+    {
+        m_settings->setValue("Audio", "volume", value);
+    }
+
+    EXPECT_TRUE(m_settings_persister->is_dirty());
+    EXPECT_EQ(m_settings_persister->get_write_count(), 0);
+
+    EXPECT_TRUE(process_events_for(2000, [this]() {
+        return m_settings_persister->get_write_count() > 0;
+    }));
+    process_events_for(200);
+    m_settings_persister->wait_for_pending_writes();
+
+    EXPECT_EQ(m_settings_persister->get_write_count(), 1);
+    EXPECT_FALSE(m_settings_persister->is_dirty());
+
+    BinarySettingsFile binary_file;
+    ASSERT_TRUE(binary_file.open(m_file_path));
+    EXPECT_EQ(binary_file.value("Audio/volume"), QVariant(9));
+}
+
+// Test case for writing continuous changes after the maximum delay
+TEST_F(SettingsPersisterTest, MaxDelayTest)
+{
+    m_settings_persister->set_delays(200, 100);
+
+    // Changes every 10 ms never let the idle delay expire
+    for (int value = 0; value < 50; value++)
+    {
+        m_settings->setValue("Audio", "volume", value);
+        process_events_for(10);
+    }
+
+    m_settings_persister->wait_for_pending_writes();
+    EXPECT_GE(m_settings_persister->get_write_count(), 1);
+}
+
+// Test case for save_now() method
+TEST_F(SettingsPersisterTest, SaveNowTest)
+{
+    bool saved_success = false;
+    QObject::connect(m_settings_persister, &SettingsPersister::saved,
+                     [&saved_success](bool success) { saved_success = success; });
+
+    m_settings->setValue("Audio", "volume", 42);
+    EXPECT_TRUE(m_settings_persister->save_now());
+    EXPECT_TRUE(saved_success);
+    EXPECT_FALSE(m_settings_persister->is_dirty());
+    EXPECT_EQ(m_settings_persister->get_write_count(), 1);
+
+    BinarySettingsFile binary_file;
+    ASSERT_TRUE(binary_file.open(m_file_path));
+    EXPECT_EQ(binary_file.value("Audio/volume"), QVariant(42));
+
+    // Nothing is left for the timers to write
+    process_events_for(1000);
+    EXPECT_EQ(m_settings_persister->get_write_count(), 1);
+}
@@ -1,5 +1,8 @@
 #include "Services/SettingsTest.h"
 
+#include <atomic>
+#include <thread>
+
 // Test case for getValue() method
 TEST_F(SettingsTest, GetValueTest)
 {
@@ -227,3 +230,256 @@ TEST_F(SettingsTest, SaveToFileTest)
 
     QFile::remove(file_path);
 }
+
+// Test case for snapshot() method
+TEST_F(SettingsTest, SnapshotTest)
+{
+    m_settings->setValue("key1", "value1");
+    m_settings->setValue("TestGroup", "Group/key2", "value2");
+
+    SettingsSnapshot snapshot = m_settings->snapshot();
+
+    ASSERT_EQ(snapshot.size(), 2);
+    EXPECT_TRUE(snapshot.contains(qMakePair(QString("key1"), QVariant("value1"))));
+    EXPECT_TRUE(snapshot.contains(qMakePair(QString("TestGroup/Group/key2"), QVariant("value2"))));
+}
+
+// Test case for saving and loading deeply nested settings
+TEST_F(SettingsTest, LoadAndSaveNestedSettingsTest)
+{
+    QString file_path = QCoreApplication::applicationDirPath() + "/appsettingstest_nested.ini";
+    QFile::remove(file_path);
+    m_settings->clear();
+
+    // 10 groups of 1000 keys, four levels deep
+    for (int group = 0; group < 10; group++)
+    {
+        for (int key = 0; key < 1000; key++)
+        {
+            QString path =
+                QString("Sub%1/Deep%2/key%3").arg(key / 100).arg(key / 10 % 10).arg(key % 10);
+            m_settings->setValue(QString("Group%1").arg(group), path, key);
+        }
+    }
+
+    m_settings->saveToFile(file_path);
+    m_settings->clear();
+    m_settings->loadFromFile(file_path);
+
+    EXPECT_EQ(m_settings->allKeys().size(), 10000);
+    EXPECT_EQ(m_settings->getValue("Group0", "Sub0/Deep0/key0").toInt(), 0);
+    EXPECT_EQ(m_settings->getValue("Group9", "Sub9/Deep9/key9").toInt(), 999);
+    EXPECT_EQ(m_settings->getValue("Group4", "Sub5/Deep6/key7").toInt(), 567);
+
+    QFile::remove(file_path);
+}
+
+// Test case for answering repeated reads from the cache
+TEST_F(SettingsTest, CacheHitsAndMissesTest)
+{
+    m_settings->setValue("Audio", "volume", 10);
+    qint64 hits = m_settings->get_cache_hit_count();
+    qint64 misses = m_settings->get_cache_miss_count();
+
+    EXPECT_EQ(m_settings->getValue("Audio", "volume"), QVariant(10));
+    EXPECT_EQ(m_settings->get_cache_miss_count(), misses + 1);
+
+    // Different spellings of the same key share the cache entry
+    EXPECT_EQ(m_settings->getValue("Audio/volume"), QVariant(10));
+    EXPECT_EQ(m_settings->getValue("/Audio//", "volume"), QVariant(10));
+    EXPECT_TRUE(m_settings->contains("Audio", "volume"));
+    EXPECT_EQ(m_settings->get_cache_hit_count(), hits + 3);
+    EXPECT_EQ(m_settings->get_cache_miss_count(), misses + 1);
+
+    // Missing keys are cached too
+    EXPECT_EQ(m_settings->getValue("Audio", "balance", 5), QVariant(5));
+    EXPECT_FALSE(m_settings->contains("Audio", "balance"));
+    EXPECT_EQ(m_settings->get_cache_hit_count(), hits + 4);
+    EXPECT_EQ(m_settings->get_cache_miss_count(), misses + 2);
+}
+
+// Test case for invalidating the cache on setValue(), clear() and loadFromFile()
+TEST_F(SettingsTest, CacheInvalidationTest)
+{
+    m_settings->setValue("Audio", "volume", 10);
+    m_settings->setValue("Audio", "balance", 0);
+    EXPECT_EQ(m_settings->getValue("Audio", "volume"), QVariant(10));
+    EXPECT_EQ(m_settings->getValue("Audio", "balance"), QVariant(0));
+    EXPECT_FALSE(m_settings->contains("Audio", "muted"));
+
+    // Only the changed key is read again
+    qint64 misses = m_settings->get_cache_miss_count();
+    m_settings->setValue("Audio/volume", 20);
+    EXPECT_EQ(m_settings->getValue("Audio", "volume"), QVariant(20));
+    EXPECT_EQ(m_settings->getValue("Audio", "balance"), QVariant(0));
+    EXPECT_EQ(m_settings->get_cache_miss_count(), misses + 1);
+
+    // A cached missing key is invalidated when it is set
+    m_settings->setValue("Audio", "muted", true);
+    EXPECT_TRUE(m_settings->contains("Audio", "muted"));
+
+    m_settings->clear();
+    EXPECT_FALSE(m_settings->contains("Audio", "volume"));
+    EXPECT_EQ(m_settings->getValue("Audio", "balance"), QVariant());
+
+    QString file_path = QCoreApplication::applicationDirPath() + "/appsettingstest_cache.ini";
+    QFile file(file_path);
+
+    if (file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        QTextStream stream(&file);
+        stream << "[Audio]\n";
+        stream << "volume=30\n";
+        file.close();
+    }
+
+    m_settings->loadFromFile(file_path);
+    EXPECT_EQ(m_settings->getValue("Audio", "volume").toInt(), 30);
+    EXPECT_TRUE(m_settings->contains("Audio", "volume"));
+
+    QFile::remove(file_path);
+}
+
+// Test case for sharing the cache between Settings objects on the same store
+TEST_F(SettingsTest, CacheIsSharedBetweenInstancesTest)
+{
+    Settings other_settings;
+    EXPECT_FALSE(other_settings.contains("Audio", "volume"));
+
+    // A missing key cached by one object is invalidated by a write through another
+    m_settings->setValue("Audio", "volume", 10);
+    EXPECT_EQ(other_settings.getValue("Audio", "volume"), QVariant(10));
+
+    // So is a cached value
+    m_settings->setValue("Audio", "volume", 20);
+    EXPECT_EQ(other_settings.getValue("Audio", "volume"), QVariant(20));
+
+    other_settings.clear();
+    EXPECT_FALSE(m_settings->contains("Audio", "volume"));
+}
+
+// Test case for reading through one Settings object while another one writes on another thread
+TEST_F(SettingsTest, CacheIsSharedBetweenThreadsTest)
+{
+    Settings reader;
+    std::atomic<bool> done = false;
+    std::thread reader_thread([&reader, &done]() {
+        while (!done.load())
+        {
+            int volume = reader.getInt("Audio", "volume", -1);
+            EXPECT_GE(volume, -1);
+            EXPECT_LT(volume, 1000);
+        }
+    });
+
+    for (int i = 0; i < 1000; i++)
+    {
+        m_settings->setValue("Audio", "volume", i);
+    }
+
+    done = true;
+    reader_thread.join();
+
+    EXPECT_EQ(reader.getInt("Audio", "volume", -1), 999);
+    EXPECT_GT(reader.get_cache_hit_count() + reader.get_cache_miss_count(), 0);
+}
+
+// Test case for typed accessors
+TEST_F(SettingsTest, TypedAccessorsTest)
+{
+    m_settings->setValue("Window", "width", 800);
+    m_settings->setValue("Window", "scale", "1.5");
+    m_settings->setValue("Window", "maximized", true);
+    m_settings->setValue("Window", "title", "Main");
+
+    EXPECT_EQ(m_settings->getInt("Window", "width"), 800);
+    EXPECT_DOUBLE_EQ(m_settings->getDouble("Window", "scale"), 1.5);
+    EXPECT_TRUE(m_settings->getBool("Window", "maximized"));
+    EXPECT_EQ(m_settings->getString("Window", "title"), QString("Main"));
+
+    // Missing keys and values that are not numbers return the default value
+    EXPECT_EQ(m_settings->getInt("Window", "height", 600), 600);
+    EXPECT_EQ(m_settings->getInt("Window", "title", 7), 7);
+    EXPECT_DOUBLE_EQ(m_settings->getDouble("Window", "title", 2.0), 2.0);
+    EXPECT_TRUE(m_settings->getBool("Window", "fullscreen", true));
+    EXPECT_EQ(m_settings->getString("Window", "icon", "none"), QString("none"));
+}
+
+// Test case for saving the changes made through another Settings object on the same store
+TEST_F(SettingsTest, SaveToFileIncludesChangesOfOtherInstancesTest)
+{
+    QString file_path = QCoreApplication::applicationDirPath() + "/appsettingstest_shared.ini";
+    QFile::remove(file_path);
+    m_settings->setValue("Audio", "volume", 10);
+    m_settings->setValue("Audio", "balance", 0);
+    m_settings->saveToFile(file_path);
+
+    // A change through another object is saved through this one
+    Settings other_settings;
+    other_settings.setValue("Audio", "volume", 42);
+    EXPECT_EQ(m_settings->get_unsaved_key_count(), 1);
+    m_settings->saveToFile(file_path);
+    EXPECT_EQ(m_settings->get_last_save_key_count(), 1);
+    EXPECT_EQ(QSettings(file_path, QSettings::IniFormat).value("Audio/volume").toInt(), 42);
+
+    // After clear() the store no longer matches the file, so all keys are compared again
+    m_settings->clear();
+    EXPECT_EQ(m_settings->get_unsaved_key_count(), 0);
+    QSettings(QCoreApplication::organizationName(), QCoreApplication::applicationName())
+        .setValue("Video/width", 800);
+    m_settings->saveToFile(file_path);
+    EXPECT_EQ(m_settings->get_last_save_key_count(), 1);
+    EXPECT_EQ(QSettings(file_path, QSettings::IniFormat).value("Video/width").toInt(), 800);
+
+    QFile::remove(file_path);
+}
+
+// Test case for loading a binary settings file, which is mapped instead of copied
+TEST_F(SettingsTest, LoadFromBinaryFileTest)
+{
+    QString file_path = QCoreApplication::applicationDirPath() + "/appsettingstest_load.bin";
+    SettingsSnapshot file_values = {{"key1", "value1"}, {"TestGroup/key2", 2}};
+
+    for (int key = 0; key < 1000; key++)
+    {
+        file_values.append(qMakePair(QString("TestGroup/Group/key%1").arg(key), QVariant(key)));
+    }
+
+    ASSERT_TRUE(BinarySettingsFile::write(file_path, file_values));
+    m_settings->loadFromFile(file_path, BinarySettingsFile::format());
+
+    EXPECT_EQ(m_settings->getValue("key1"), QVariant("value1"));
+    EXPECT_EQ(m_settings->getInt("TestGroup", "Group/key500"), 500);
+    EXPECT_FALSE(m_settings->contains("TestGroup", "missing"));
+    EXPECT_EQ(m_settings->childGroups(), QStringList({"TestGroup"}));
+    EXPECT_EQ(m_settings->childGroups("TestGroup"), QStringList({"Group"}));
+    EXPECT_EQ(m_settings->childKeys("TestGroup"), QStringList({"key2"}));
+    EXPECT_EQ(m_settings->childKeys(""), QStringList({"key1"}));
+    EXPECT_EQ(m_settings->childKeys("TestGroup/Group").size(), 1000);
+    EXPECT_EQ(m_settings->allKeys().size(), 1002);
+
+    // Keys set afterwards shadow the file without being listed twice
+    m_settings->setValue("TestGroup", "key2", 3);
+    m_settings->setValue("TestGroup", "key3", 4);
+    EXPECT_EQ(m_settings->getInt("TestGroup", "key2"), 3);
+    EXPECT_EQ(m_settings->childKeys("TestGroup").size(), 2);
+    EXPECT_EQ(m_settings->allKeys().size(), 1003);
+    EXPECT_EQ(m_settings->snapshot().size(), 1003);
+
+    // Saving to another file writes the keys of both
+    QString ini_file_path = QCoreApplication::applicationDirPath() + "/appsettingstest_load.ini";
+    QFile::remove(ini_file_path);
+    m_settings->saveToFile(ini_file_path);
+    QSettings ini_settings(ini_file_path, QSettings::IniFormat);
+    EXPECT_EQ(ini_settings.allKeys().size(), 1003);
+    EXPECT_EQ(ini_settings.value("TestGroup/Group/key999").toInt(), 999);
+    EXPECT_EQ(ini_settings.value("TestGroup/key2").toInt(), 3);
+
+    // After clear() the file is no longer part of the settings
+    m_settings->clear();
+    EXPECT_FALSE(m_settings->contains("key1"));
+    EXPECT_TRUE(m_settings->allKeys().isEmpty());
+
+    QFile::remove(file_path);
+    QFile::remove(ini_file_path);
+}
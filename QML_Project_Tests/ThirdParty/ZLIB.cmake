@@ -0,0 +1,9 @@
+# zlib is optional: without it, gzip-compressed rotated log segments are skipped by the log search
+find_package(ZLIB)
+
+if (ZLIB_FOUND)
+	target_link_libraries(${PROJECT_NAME} PRIVATE ZLIB::ZLIB)
+	target_compile_definitions(${PROJECT_NAME} PRIVATE QMLAPP_HAS_ZLIB)
+else(ZLIB_FOUND)
+	message("zlib was not found, searching gzip-compressed log segments is disabled")
+endif(ZLIB_FOUND)
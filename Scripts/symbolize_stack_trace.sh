@@ -0,0 +1,72 @@
+#!/bin/bash
+
+# Resolves the raw stack traces in a JSON log, as written by the JsonFormatter, against the debug
+# info of the application binary.
+#
+# Usage: symbolize_stack_trace.sh <binary> [log.jsonl]
+#
+# Reads the log from stdin if no log file is given. Only records with a "stack" key are printed.
+
+# Function to check if a command exists
+command_exists() {
+    command -v "$1" >/dev/null 2>&1
+}
+
+if [ $# -lt 1 ]; then
+    echo "Usage: $0 <binary> [log.jsonl]"
+    exit 1
+fi
+
+BINARY="$1"
+LOG_FILE="$2"
+
+if [ ! -f "${BINARY}" ]; then
+    echo "Error: binary ${BINARY} does not exist."
+    exit 1
+fi
+
+if ! command_exists jq; then
+    echo "Error: jq is not installed or not in the PATH."
+    exit 1
+fi
+
+if [ "$(uname)" = "Darwin" ]; then
+    SYMBOLIZER="atos"
+else
+    SYMBOLIZER="addr2line"
+fi
+
+if ! command_exists "${SYMBOLIZER}"; then
+    echo "Error: ${SYMBOLIZER} is not installed or not in the PATH."
+    exit 1
+fi
+
+# Symbols of position-independent executables are relative to the load address
+IS_PIE=0
+if command_exists readelf && readelf -h "${BINARY}" 2>/dev/null | grep -q "DYN"; then
+    IS_PIE=1
+fi
+
+jq -c 'select(.stack != null)' ${LOG_FILE:+"${LOG_FILE}"} | while IFS= read -r record; do
+    jq -r '"\(.time) [\(.level)] \(.message) (\(.file):\(.line))"' <<< "${record}"
+    image_base=$(jq -r '.image_base' <<< "${record}")
+
+    jq -r '.stack[]' <<< "${record}" | while read -r address; do
+        if [ "${SYMBOLIZER}" = "atos" ]; then
+            location=$(atos -o "${BINARY}" -l "${image_base}" "${address}")
+        else
+            # Return addresses point behind the call instruction, so step back into it
+            if [ "${IS_PIE}" -eq 1 ]; then
+                offset=$(printf '0x%x' $((address - image_base - 1)))
+            else
+                offset=$(printf '0x%x' $((address - 1)))
+            fi
+
+            location=$(addr2line -C -f -p -e "${BINARY}" "${offset}")
+        fi
+
+        echo "    ${address}  ${location}"
+    done
+
+    echo ""
+done